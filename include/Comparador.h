@@ -0,0 +1,225 @@
+/**
+ * @file Comparador.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições do comparador das implementações alternativas com as de referência
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+
+// Headers
+#include "../include/Listas_Ligadas.h"
+#include "../include/Grafos.h"
+#include "../include/Grafos_Compactos.h"
+#include "../include/Procura_Paralela.h"
+#include "../include/Fecho_Transitivo.h"
+#include "../include/Componentes.h"
+#include "../include/Nefastos_Externos.h"
+#include "../include/Formatos.h"
+
+/**
+ * @def CP_NUM_MAPAS
+ * @brief Número de mapas aleatórios comparados, por defeito.
+ */
+#define CP_NUM_MAPAS 4
+
+/**
+ * @def CP_LARGURA
+ * @brief Largura, por defeito, dos mapas aleatórios.
+ */
+#define CP_LARGURA 160
+
+/**
+ * @def CP_ALTURA
+ * @brief Altura, por defeito, dos mapas aleatórios.
+ */
+#define CP_ALTURA 160
+
+/**
+ * @def CP_DENSIDADE
+ * @brief Posições ocupadas por antenas nos mapas aleatórios, em permilagem.
+ */
+#define CP_DENSIDADE 12
+
+/**
+ * @def CP_NUM_FREQUENCIAS
+ * @brief Número de frequências diferentes nos mapas aleatórios.
+ */
+#define CP_NUM_FREQUENCIAS 8
+
+/**
+ * @def CP_RAIO
+ * @brief Raio das ligações da cidade usada nas procuras em largura e em profundidade.
+ */
+#define CP_RAIO 12
+
+/**
+ * @def CP_MAX_VIZINHOS
+ * @brief Número máximo de vizinhos de cada antena nas comparações de "interligarAntenasRaio" com limite.
+ */
+#define CP_MAX_VIZINHOS 3
+
+/**
+ * @def CP_RAIO_ASCENDENTE
+ * @brief Raio das ligações (entre os grupos de frequência) da cidade usada na procura em largura com expansão ascendente.
+ */
+#define CP_RAIO_ASCENDENTE 4
+
+/**
+ * @def CP_LARGURA_ASCENDENTE
+ * @brief Largura do mapa da procura em largura com expansão ascendente (maior do que os restantes, para que
+ *        o grafo tenha mais de PP_LIMIAR_SEQUENCIAL arestas).
+ */
+#define CP_LARGURA_ASCENDENTE 400
+
+/**
+ * @def CP_ALTURA_ASCENDENTE
+ * @brief Altura do mapa da procura em largura com expansão ascendente.
+ */
+#define CP_ALTURA_ASCENDENTE 400
+
+/**
+ * @def CP_NUM_CONSULTAS
+ * @brief Número de consultas espaciais de cada tipo (raio, retângulo, mais próximos) em cada mapa.
+ */
+#define CP_NUM_CONSULTAS 200
+
+/**
+ * @def CP_MAX_PROXIMOS
+ * @brief Valor máximo de "k" nas consultas dos mais próximos.
+ */
+#define CP_MAX_PROXIMOS 10
+
+/**
+ * @def CP_ALTERACOES_INDICE
+ * @brief Número de inserções/remoções de antenas feitas depois de criar o índice espacial da cidade.
+ */
+#define CP_ALTERACOES_INDICE 50
+
+/**
+ * @def CP_TAMANHO_LOTE
+ * @brief Número de registos (em posições ao acaso, algumas já ocupadas) do lote inserido em cada mapa.
+ */
+#define CP_TAMANHO_LOTE 400
+
+/**
+ * @def CP_ALTERACOES_FECHO
+ * @brief Número de arestas acrescentadas à cidade entre as duas rondas de consultas do fecho transitivo.
+ */
+#define CP_ALTERACOES_FECHO 10
+
+/**
+ * @def CP_ANTENAS_CAMINHOS
+ * @brief Número de antenas da cidade (pequena) usada na procura de caminhos, cujo custo é exponencial.
+ */
+#define CP_ANTENAS_CAMINHOS 11
+
+/**
+ * @def CP_MAX_ANTENAS_CAMINHO
+ * @brief Número máximo de antenas por caminho na procura de caminhos limitada.
+ */
+#define CP_MAX_ANTENAS_CAMINHO 6
+
+/**
+ * @def CP_MAX_CAMINHOS
+ * @brief Número de caminhos pedidos na procura de caminhos limitada aos primeiros caminhos.
+ */
+#define CP_MAX_CAMINHOS 100
+
+/**
+ * @def CP_MAX_COMPARACOES
+ * @brief Número máximo de comparações diferentes (linhas do relatório).
+ */
+#define CP_MAX_COMPARACOES 64
+
+/**
+ * @struct ElementoComparado
+ * @brief Elemento de uma saída comparada: uma antena, um efeito nefasto (frequência '#'), uma aresta
+ *        ("origem" -> "destino") ou uma antena com a sua distância (em "destino.x").
+ */
+typedef struct ElementoComparado
+{
+    RegistoAntena origem;
+    RegistoAntena destino;
+
+} ElementoComparado;
+
+/**
+ * @struct ListaComparada
+ * @brief Saída completa de uma implementação, pela ordem em que é comparada.
+ */
+typedef struct ListaComparada
+{
+    ElementoComparado *elementos;
+    int quantidade;
+    int capacidade;
+
+} ListaComparada;
+
+/**
+ * @struct Comparacao
+ * @brief Totais de uma comparação (implementação alternativa vs. referência) em todos os mapas.
+ */
+typedef struct Comparacao
+{
+    const char *nome;
+    const char *referencia;
+    double tempoReferencia;
+    double tempoAlternativa;
+    long numElementos;
+    int numMapas;
+    int numFalhas;
+
+} Comparacao;
+
+/**
+ * @struct VarianteThreads
+ * @brief Número de threads de uma variante da procura em largura paralela e o nome da sua comparação.
+ */
+typedef struct VarianteThreads
+{
+    const char *nome;
+    int numThreads;
+
+} VarianteThreads;
+
+/**
+ * @struct IntersecoesCompactas
+ * @brief Contexto da leitura das interseções de um grafo compacto (o grafo, para obter as antenas, e a lista de saída).
+ */
+typedef struct IntersecoesCompactas
+{
+    const GrafoCompacto *grafo;
+    ListaComparada *lista;
+
+} IntersecoesCompactas;
+
+/**
+ * @struct MapaAleatorio
+ * @brief Ficheiros de um mapa aleatório (o mesmo mapa em texto, RLE e lista de coordenadas desordenada).
+ */
+typedef struct MapaAleatorio
+{
+    char texto[64];
+    char rle[64];
+    char coordenadas[64];
+    char nefastos[64];
+    char caminhos[64];
+
+    int largura;
+    int altura;
+    int numAntenas;
+
+} MapaAleatorio;
@@ -0,0 +1,77 @@
+/**
+ * @file Componentes.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações da identificação de componentes conexas do grafo compacto
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Headers
+#include "../include/Grafos_Compactos.h"
+
+// Lista de Erros
+#define CC_ERRO_GRAFO_PONTEIRO_INVALIDO -20
+#define CC_ERRO_COMPONENTES_PONTEIRO_INVALIDO -27
+#define CC_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @def CC_NUM_COMPONENTES_APRESENTAR
+ * @brief Número de componentes (as maiores) apresentadas por defeito.
+ */
+#define CC_NUM_COMPONENTES_APRESENTAR 10
+
+/**
+ * @struct FrequenciaComponente
+ * @brief Número de antenas de uma frequência numa componente.
+ */
+typedef struct FrequenciaComponente
+{
+    char frequencia;
+    uint32_t quantidade;
+
+} FrequenciaComponente;
+
+/**
+ * @struct Componentes
+ * @brief Componentes conexas (ignorando o sentido das arestas) de um grafo compacto.
+ *
+ * "componente[v]" é a componente do vértice "v"; as componentes são numeradas pela ordem do seu
+ * primeiro vértice ("representante"). A mistura de frequências da componente "c" está em
+ * "frequencias[inicioFrequencias[c]]" a "frequencias[inicioFrequencias[c + 1] - 1]", da frequência
+ * com mais antenas para a com menos.
+ *
+ * @note "numMonofrequencia" conta as componentes com uma só frequência e "numMistas" as restantes.
+ */
+typedef struct Componentes
+{
+    uint32_t numVertices;
+    uint32_t numComponentes;
+    uint32_t *componente;
+    uint32_t *tamanho;
+    uint32_t *representante;
+
+    uint32_t *inicioFrequencias;
+    FrequenciaComponente *frequencias;
+
+    uint32_t numMonofrequencia;
+    uint32_t numMistas;
+
+} Componentes;
+
+// Declaração das funções
+Componentes *CC_calcularComponentes(const GrafoCompacto *grafo, int *erro);
+Componentes *CC_libertarComponentes(Componentes *componentes);
+
+int CC_ordenarComponentes(const Componentes *componentes, uint32_t *ordem);
+int CC_apresentarComponentes(const GrafoCompacto *grafo, const Componentes *componentes, int maximo);
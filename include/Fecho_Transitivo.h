@@ -0,0 +1,73 @@
+/**
+ * @file Fecho_Transitivo.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações do fecho transitivo (matriz de alcançabilidade) da cidade
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Headers
+#include "../include/Grafos.h"
+
+// Lista de Erros
+#define FT_ERRO_CIDADE_PONTEIRO_INVALIDO -1
+#define FT_ERRO_ANTENA_INICIO_INVALIDA -3
+#define FT_ERRO_ANTENA_DESTINO_INVALIDA -4
+#define FT_ERRO_FECHO_PONTEIRO_INVALIDO -25
+#define FT_ERRO_LIMITE_ANTENAS -26
+#define FT_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @def FT_LIMITE_PREDEFINIDO
+ * @brief Número máximo de antenas, por defeito, para construir o fecho transitivo.
+ *
+ * A matriz ocupa (componentes² / 8) bytes, no pior caso 32 MiB para 16384 antenas.
+ */
+#define FT_LIMITE_PREDEFINIDO 16384
+
+/**
+ * @struct FechoTransitivo
+ * @brief Matriz de alcançabilidade entre as componentes fortemente conexas de uma cidade.
+ *
+ * As antenas são agrupadas nas suas componentes fortemente conexas (Tarjan), numeradas pela ordem
+ * em que terminam: uma componente só tem arestas para componentes com número menor. A linha "c" de
+ * "alcance" ("palavrasPorLinha" palavras de 64 bits) tem o bit "d" ativo se a componente "c" alcança
+ * a componente "d", e é calculada com o OU das linhas das componentes sucessoras (64 bits de cada vez).
+ *
+ * @note A matriz é construída na primeira consulta e reconstruída na primeira consulta depois de uma
+ *       alteração da cidade (ver "geracaoCidade"). Enquanto a cidade não mudar, cada consulta é um teste de bit.
+ * @note "componente" está indexado por "Vertice.indice" (ver "numerarAntenas").
+ */
+typedef struct FechoTransitivo
+{
+    Grafo *cidade;
+    int limiteAntenas;
+    uint64_t geracao;
+
+    uint32_t numAntenas;
+    uint32_t numComponentes;
+    uint32_t palavrasPorLinha;
+    uint32_t *componente;
+    uint32_t *tamanhoComponente;
+    uint64_t *alcance;
+
+} FechoTransitivo;
+
+// Declaração das funções
+FechoTransitivo *FT_criarFechoTransitivo(Grafo *cidade, int limiteAntenas, int *erro);
+FechoTransitivo *FT_libertarFechoTransitivo(FechoTransitivo *fecho);
+int FT_atualizarFechoTransitivo(FechoTransitivo *fecho);
+
+int FT_alcancavel(FechoTransitivo *fecho, Vertice *inicio, Vertice *destino);
+int FT_contarAlcancaveis(FechoTransitivo *fecho, Vertice *inicio);
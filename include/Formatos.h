@@ -0,0 +1,122 @@
+/**
+ * @file Formatos.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações dos formatos alternativos dos ficheiros de mapas
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Headers
+#include "../include/Listas_Ligadas.h"
+#include "../include/Grafos.h"
+
+// Lista de Erros
+#define FM_ERRO_ESCRITA -29
+#define FM_ERRO_FORMATO_INVALIDO -32
+#define FM_ERRO_ABRIR_FICHEIRO -100
+#define FM_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @def FM_CABECALHO_RLE
+ * @brief Identificador da primeira linha dos mapas RLE ("RLE1 largura altura").
+ */
+#define FM_CABECALHO_RLE "RLE1"
+
+/**
+ * @def FM_COLUNAS_RLE
+ * @brief Número (aproximado) de caracteres por linha nos ficheiros RLE escritos.
+ */
+#define FM_COLUNAS_RLE 70
+
+/**
+ * @def FM_TAMANHO_LEITURA
+ * @brief Tamanho do buffer de leitura dos ficheiros RLE.
+ */
+#define FM_TAMANHO_LEITURA 65536
+
+/**
+ * @def FM_CABECALHO_COORDENADAS
+ * @brief Primeira linha das listas de coordenadas escritas (ignorada na leitura).
+ */
+#define FM_CABECALHO_COORDENADAS "frequencia,x,y"
+
+/*
+ * Formato RLE (mapas esparsos)
+ *
+ *     RLE1 <largura> <altura>
+ *     <símbolos>!
+ *
+ * Os símbolos descrevem a grelha por ordem (y, x), cada um precedido de um número de repetições
+ * opcional (1 por defeito):
+ *     '.'           posições vazias (avança x)
+ *     'A'-'Z', 'a'-'z', '#'   antenas ou nefastos (um por posição)
+ *     '$'           fim de linha (avança y e volta a x = 0)
+ *     '!'           fim do mapa
+ * As posições vazias no fim de cada linha e as linhas vazias no fim do mapa são omitidas, e as mudanças de
+ * linha do ficheiro são ignoradas. Ex.: "3.A$$2.#!" tem uma antena 'A' em (3, 0) e um '#' em (2, 2).
+ */
+
+/*
+ * Lista de coordenadas (CSV/TSV)
+ *
+ *     frequencia,x,y
+ *     A,6,5
+ *     O,8,1
+ *
+ * Um registo por linha, com os campos separados por ',', ';' ou tabulação (e espaços opcionais à volta).
+ * As linhas vazias e as começadas por '#' são ignoradas, tal como a primeira linha se o seu primeiro campo
+ * tiver mais do que um caracter (cabeçalho). As coordenadas são inteiros não negativos.
+ */
+
+/**
+ * @struct ResumoCoordenadas
+ * @brief Resumo do carregamento de uma lista de coordenadas (opcional).
+ *
+ * @note "ordenado" indica que os registos do ficheiro já estavam por ordem (y, x) e sem repetições
+ *       (não foi preciso ordená-los antes da inserção direta no fim).
+ * @note "numRepetidas" conta os registos não inseridos (repetidos no ficheiro ou já existentes).
+ * @note "linhaErro" é a linha do primeiro registo inválido (0 se não existir).
+ */
+typedef struct ResumoCoordenadas
+{
+    int numRegistos;
+    int numInseridas;
+    int numRepetidas;
+    bool ordenado;
+    int linhaErro;
+
+} ResumoCoordenadas;
+
+/**
+ * @brief Função chamada para cada posição ocupada de um mapa RLE.
+ *
+ * @return Valor negativo para interromper a leitura (devolvido pela função de leitura).
+ */
+typedef int (*FuncaoPosicaoRLE)(char simbolo, int x, int y, void *contexto);
+
+// Declaração das funções
+int FM_percorrerMapaRLE(const char *localizacaoFicheiro, FuncaoPosicaoRLE funcao, void *contexto, int *largura, int *altura);
+
+int FM_converterTextoRLE(const char *localizacaoTexto, const char *localizacaoRLE);
+int FM_converterRLETexto(const char *localizacaoRLE, const char *localizacaoTexto);
+
+int FM_carregarCidadeRLE(Grafo *cidade, const char *localizacaoFicheiro);
+int FM_carregarAntenasRLE(Rede *rede, const char *localizacaoFicheiro);
+int FM_carregarNefastosRLE(Rede *rede, const char *localizacaoFicheiro);
+
+int FM_lerCoordenadas(const char *localizacaoFicheiro, RegistoAntena **registos, ResumoCoordenadas *resumo);
+int FM_converterTextoCoordenadas(const char *localizacaoTexto, const char *localizacaoCoordenadas);
+
+int FM_carregarCidadeCoordenadas(Grafo *cidade, const char *localizacaoFicheiro, ResumoCoordenadas *resumo);
+int FM_carregarAntenasCoordenadas(Rede *rede, const char *localizacaoFicheiro, ResumoCoordenadas *resumo);
@@ -15,8 +15,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
+#include <limits.h>
 #include <unistd.h>
 
+// Headers
+#include "../include/Registos.h"
+#include "../include/Indice_Espacial.h"
+#include "../include/Saidas.h"
+
 // Lista de Erros
 #define ERRO_CIDADE_PONTEIRO_INVALIDO -1
 #define ERRO_ANTENAS_INICIO_DESTINO_INVALIDAS -2
@@ -26,24 +33,73 @@
 #define ERRO_ANTENA_NAO_EXISTE -6
 #define ERRO_ARESTA_JA_EXISTE -7
 #define ERRO_ARESTA_NAO_EXISTE -8
+#define ERRO_ANTENA_REPETIDA_LOTE -9
 #define ERRO_OVERFLOW_LISTA -10
+#define ERRO_CIDADE_NAO_VAZIA -14
 #define ERRO_ABRIR_FICHEIRO -100
 #define ERRO_ALOCACAO_MEMORIA -404
 
+/**
+ * @def LIMIAR_TABELA_ARESTAS
+ * @brief Grau de saída a partir do qual um vértice passa a indexar as suas arestas numa tabela de dispersão.
+ *
+ * Abaixo deste valor a lista de adjacência é percorrida diretamente (mais barato para graus pequenos).
+ */
+#define LIMIAR_TABELA_ARESTAS 16
+
+/**
+ * @def NUM_FREQUENCIAS
+ * @brief Número de frequências possíveis (uma por valor de "char"), usado no índice por frequência do grafo.
+ */
+#define NUM_FREQUENCIAS 256
+
+/**
+ * @def ARESTAS_POR_BLOCO
+ * @brief Número de arestas de cada bloco da reserva de arestas de uma cidade (um só "malloc" por bloco).
+ */
+#define ARESTAS_POR_BLOCO 1024
+
 /**
  * @struct Aresta
  * @brief Representa uma ligação entre duas antenas (vértices) no grafo.
  *
  * Cada aresta aponta para o vértice de destino e para a próxima aresta na lista de adjacência,
  * permitindo representar múltiplas conexões a partir de um vértice.
+ *
+ * @note Com "ADJACENCIA_INVERSA" definida na compilação (make ADJACENCIA_INVERSA=1), a mesma aresta
+ *       pertence também à lista de entrada do destino, ambas duplamente ligadas, para poder ser desligada
+ *       em O(1) de qualquer um dos lados (e "removerAntena" é proporcional ao grau da antena). Sem ela a
+ *       aresta só tem "prox" e "destino", e as operações que precisam dos predecessores percorrem as
+ *       listas de saída ou constroem a adjacência inversa quando são chamadas.
+ * @note As arestas das antenas de uma cidade são reservadas dos blocos da cidade (ver "BlocoArestas") e
+ *       são sempre libertadas com "libertarAresta".
  */
 typedef struct Aresta
 {
     struct Aresta *prox;
     struct Vertice *destino;
+#ifdef ADJACENCIA_INVERSA
+    struct Aresta *anterior;
+    struct Vertice *origem;
+    struct Aresta *proxEntrada;
+    struct Aresta *anteriorEntrada;
+#endif
 
 } Aresta;
 
+/**
+ * @struct BlocoArestas
+ * @brief Bloco de "ARESTAS_POR_BLOCO" arestas alocado de uma só vez (ver "blocosArestas" em "Grafo").
+ *
+ * @note "prox" liga os blocos de uma cidade, do mais recente para o mais antigo.
+ */
+typedef struct BlocoArestas
+{
+    struct BlocoArestas *prox;
+    Aresta arestas[];
+
+} BlocoArestas;
+
 /**
  * @struct Vertice
  * @brief Representa uma antena no grafo com os seus atributos e ligações.
@@ -51,6 +107,21 @@ typedef struct Aresta
  * Cada vértice contém a frequência da antena, a sua posição na grelha,
  * um indicador de visitação (útil para percursos no grafo), e a lista de arestas
  * que representam as suas ligações a outras antenas.
+ *
+ * @note "primeiraArestaEntrada" é a lista das arestas que chegam ao vértice (predecessores), só com
+ *       "ADJACENCIA_INVERSA" (ver "Aresta").
+ * @note Quando "numArestas" ultrapassa "LIMIAR_TABELA_ARESTAS", as arestas de saída são também
+ *       indexadas por destino em "tabelaArestas" (endereçamento aberto com sondagem linear, com
+ *       "capacidadeTabela" posições, potência de 2, no máximo meio cheia).
+ * @note "proxFrequencia" e "anteriorFrequencia" ligam as antenas com a mesma frequência.
+ * @note "indice" é a posição da antena na lista, atribuída por "numerarAntenas" (usada pelas
+ *       representações indexadas do grafo; só é válida até à próxima inserção/remoção).
+ * @note "cidade" é a cidade onde a antena foi inserida (NULL fora de uma cidade), cuja geração é
+ *       incrementada quando as arestas da antena mudam (ver "geracaoCidade").
+ * @note "arestasPendentes" indica que as arestas para as antenas com a mesma frequência ainda não
+ *       foram criadas (ver "interligarAntenasPendente" e "materializarArestas").
+ * @note "geracaoInsercao" é a geração da cidade em que a antena foi inserida (distingue as antenas
+ *       inseridas depois de "interligarAntenasPendente").
  */
 typedef struct Vertice
 {
@@ -58,8 +129,20 @@ typedef struct Vertice
     int x;
     int y;
     bool visitada;
+    bool arestasPendentes;
+    int indice;
     Aresta *primeiraAresta;
+#ifdef ADJACENCIA_INVERSA
+    Aresta *primeiraArestaEntrada;
+#endif
+    int numArestas;
+    int capacidadeTabela;
+    Aresta **tabelaArestas;
     struct Vertice *prox;
+    struct Vertice *proxFrequencia;
+    struct Vertice *anteriorFrequencia;
+    struct Grafo *cidade;
+    uint64_t geracaoInsercao;
 
 } Vertice;
 
@@ -70,43 +153,152 @@ typedef struct Vertice
  * O grafo é composto por um conjunto de antenas (vértices) e o número total
  * de antenas presentes. É a estrutura para representar a conexão
  * entre antenas com a mesma frequência.
+ *
+ * @note As antenas estão também agrupadas por frequência ("primeiraAntenaFrequencia[frequencia]" a
+ *       "ultimaAntenaFrequencia[frequencia]", com "numAntenasFrequencia[frequencia]" elementos), pela
+ *       ordem da lista, para consultas que só envolvem algumas frequências.
+ * @note "indiceEspacial" (opcional, criado com "criarIndiceCidade") indexa as antenas por posição e é
+ *       atualizado em cada inserção/remoção; sem ele, as consultas espaciais percorrem a lista.
+ * @note "geracao" é incrementada em cada alteração das antenas ou arestas da cidade (ver "geracaoCidade").
+ * @note "geracaoPendente" é a geração da última chamada a "interligarAntenasPendente" (0 se nunca foi chamada).
+ * @note "largura" e "altura" guardam as dimensões da grelha do último mapa carregado com
+ *       "carregarCidade" (usadas pelas redes partilhadas, ver "LL_criarRedePartilhada").
+ * @note As arestas das antenas são reservadas de "blocosArestas": primeiro das arestas libertadas
+ *       ("arestasLivres", ligadas por "prox"), depois das "ARESTAS_POR_BLOCO" - "arestasUsadasBloco"
+ *       posições livres do bloco atual (o primeiro da lista) e só então de um bloco novo. Os blocos são
+ *       libertados todos de uma vez por "libertarArestas" e "libertarAntenas".
  */
 typedef struct Grafo
 {
     int numAntenas;
     Vertice *primeiraAntena;
+    Vertice *primeiraAntenaFrequencia[NUM_FREQUENCIAS];
+    Vertice *ultimaAntenaFrequencia[NUM_FREQUENCIAS];
+    int numAntenasFrequencia[NUM_FREQUENCIAS];
+    IndiceEspacial *indiceEspacial;
+
+    BlocoArestas *blocosArestas;
+    int arestasUsadasBloco;
+    Aresta *arestasLivres;
+
+    int largura;
+    int altura;
+    uint64_t geracao;
+    uint64_t geracaoPendente;
 
 } Grafo;
 
+/**
+ * @struct OpcoesCaminhos
+ * @brief Opções (e contagem) da procura de caminhos com poda ("procurarCaminhosPodados").
+ *
+ * @note "apenasContar" conta os caminhos sem os enviar para a saída.
+ * @note "maxAntenas" limita o número de antenas de cada caminho e "maxCaminhos" termina a procura
+ *       ao fim de tantos caminhos (0 para não limitar).
+ * @note "numCaminhos" é preenchido pela procura com o número de caminhos encontrados.
+ */
+typedef struct OpcoesCaminhos
+{
+    bool apenasContar;
+    int maxAntenas;
+    int64_t maxCaminhos;
+
+    int64_t numCaminhos;
+
+} OpcoesCaminhos;
+
+/**
+ * @def PONTO_MEDIO_VAZIO
+ * @brief Chave que marca as posições vazias do conjunto de pontos médios.
+ */
+#define PONTO_MEDIO_VAZIO INT64_MIN
+
+/**
+ * @struct PontosMedios
+ * @brief Conjunto de pontos médios já encontrados (usado para não repetir interseções).
+ *
+ * @note A chave "PONTO_MEDIO_VAZIO" (que marca as posições vazias) é registada em "temVazio".
+ */
+typedef struct PontosMedios
+{
+    int64_t *chaves;
+    size_t capacidade;
+    size_t numChaves;
+    bool temVazio;
+
+} PontosMedios;
+
+/**
+ * @struct Intersecao
+ * @brief Ponto de interseção (ponto médio) entre duas antenas de frequências indicadas.
+ */
+typedef struct Intersecao
+{
+    Vertice *antena1;
+    Vertice *antena2;
+    int x;
+    int y;
+
+} Intersecao;
+
+/**
+ * @brief Função chamada para cada interseção encontrada.
+ *
+ * @return Valor negativo para interromper a procura (devolvido pela função de procura).
+ */
+typedef int (*FuncaoIntersecao)(const Intersecao *intersecao, void *contexto);
+
 // Declaração das funções
 Grafo *criarCidade();
 Vertice *criarAntena(char frequencia, int x, int y);
-Aresta *criarAresta(Vertice *destino);
+Aresta *criarAresta(Vertice *origem, Vertice *destino);
+void libertarAresta(Vertice *origem, Aresta *aresta);
 
 Grafo *libertarCidade(Grafo *cidade);
 int libertarAntenas(Grafo *cidade);
 int libertarArestas(Grafo *cidade);
 
 int resetVisitados(Grafo *cidade);
+int numerarAntenas(Grafo *cidade);
+uint64_t geracaoCidade(const Grafo *cidade);
+
+int criarIndiceCidade(Grafo *cidade, int tamanhoCelula);
 
 int carregarCidade(Grafo *cidade, const char *localizacaoFicheiro);
 
 int interligarAntenas(Grafo *cidade, bool FrequenciasIguais, bool FrequenciasDiferentes, bool verificarRepetidas);
+int interligarAntenasGenerica(Grafo *cidade, bool FrequenciasIguais, bool FrequenciasDiferentes, bool verificarRepetidas);
+int interligarAntenasRaio(Grafo *cidade, bool FrequenciasIguais, bool FrequenciasDiferentes, bool verificarRepetidas, int raio, int maxVizinhos);
+int interligarAntenasPendente(Grafo *cidade);
+int materializarArestas(Vertice *antena);
+int materializarTodasArestas(Grafo *cidade);
 
 int adicionarAntenaOrdenada(Grafo *cidade, char *frequencia, int x, int y);
 Vertice *adicionarAntenaFim(Grafo *cidade, Vertice *ultimaAntena, char frequencia, int x, int y, int *erro);
+int adicionarAntenasLote(Grafo *cidade, const RegistoAntena *lote, int quantidade, int *resultados);
 int adicionarAresta(Vertice *inicio, Vertice *destino, bool verificarRepetidas);
+void ligarAresta(Vertice *origem, Aresta *aresta);
 
 int removerAntena(Grafo *cidade, char *frequencia, int x, int y);
 int removerAresta(Vertice *inicio, Vertice *destino);
+void desligarAresta(Vertice *origem, Aresta *aresta);
 
 Vertice *procurarAntena(Grafo *cidade, int x, int y, int *erro);
 Aresta *procurarAresta(Vertice *inicio, Vertice *destino, int *erro);
-int procurarProfundidade(Vertice *inicio);
-int procurarLargura(Vertice *inicio, int numeroAntenas);
-int procurarCaminhos(Vertice *inicio, Vertice *destino, int numeroAntenas);
-int procurarCaminhosRecursiva(Vertice *inicio, Vertice *destino, Vertice **caminho, int tamanho); /* Nunca deve ser chamada, use a "procurarCaminhos" */
-
-int listarIntersecoes(Grafo *cidade, char frequencia1, char frequencia2);
-int listarAntenas(Grafo *cidade);
-int listarArestasAntena(Vertice *antena);
\ No newline at end of file
+int procurarProfundidade(Vertice *inicio, Saida *saida);
+int procurarLargura(Vertice *inicio, int numeroAntenas, Saida *saida);
+int procurarCaminhos(Vertice *inicio, Vertice *destino, int numeroAntenas, Saida *saida);
+int procurarCaminhosRecursiva(Vertice *inicio, Vertice *destino, Vertice **caminho, int tamanho, Saida *saida); /* Nunca deve ser chamada, use a "procurarCaminhos" */
+int procurarCaminhosPodados(Grafo *cidade, Vertice *inicio, Vertice *destino, OpcoesCaminhos *opcoes, Saida *saida);
+
+int inserirPontoMedio(PontosMedios *pontos, int x, int y);
+int procurarIntersecoes(Grafo *cidade, char frequencia1, char frequencia2, FuncaoIntersecao funcao, void *contexto);
+int procurarTodasIntersecoes(Grafo *cidade, FuncaoIntersecao funcao, void *contexto);
+int procurarAntenasRaio(Grafo *cidade, int x, int y, int raio, Vertice **resultados, int capacidade);
+int procurarAntenasRetangulo(Grafo *cidade, int x1, int y1, int x2, int y2, Vertice **resultados, int capacidade);
+int procurarAntenasProximas(Grafo *cidade, int x, int y, int k, Vertice **resultados);
+int listarIntersecoes(Grafo *cidade, char frequencia1, char frequencia2, Saida *saida);
+int listarTodasIntersecoes(Grafo *cidade, Saida *saida);
+int listarAntenas(Grafo *cidade, Saida *saida);
+int listarArestasAntena(Vertice *antena, Saida *saida);
+int listarArestasEntradaAntena(Vertice *antena, Saida *saida);
\ No newline at end of file
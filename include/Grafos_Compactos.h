@@ -0,0 +1,123 @@
+/**
+ * @file Grafos_Compactos.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações da representação compacta (indexada) dos grafos
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Headers
+#include "../include/Grafos.h"
+
+// Lista de Erros
+#define GC_ERRO_CIDADE_PONTEIRO_INVALIDO -1
+#define GC_ERRO_ANTENA_INICIO_INVALIDA -3
+#define GC_ERRO_ANTENA_DESTINO_INVALIDA -4
+#define GC_ERRO_GRAFO_PONTEIRO_INVALIDO -20
+#define GC_ERRO_LIMITE_IDENTIFICADORES -21
+#define GC_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @def GC_SEM_VERTICE
+ * @brief Identificador devolvido quando uma antena não existe no grafo compacto.
+ */
+#define GC_SEM_VERTICE UINT32_MAX
+
+/**
+ * @struct GrafoCompacto
+ * @brief Representação compacta e imutável de um "Grafo".
+ *
+ * As antenas ficam em vetores paralelos, identificadas por um número de 32 bits (a sua posição na
+ * lista ordenada por (y, x) do grafo original). As arestas ficam em formato CSR: as arestas de saída
+ * da antena "v" são os destinos "destinos[inicioArestas[v]]" a "destinos[inicioArestas[v + 1] - 1]".
+ *
+ * @note Se "coordenadas16" for "true", as coordenadas são guardadas em 16 bits ("x16" e "y16")
+ *       relativamente a ("origemX", "origemY"); caso contrário ficam em "x" e "y" (32 bits).
+ * @note As arestas de entrada (CSR inverso: "origens[inicioArestasEntrada[v]]" a
+ *       "origens[inicioArestasEntrada[v + 1] - 1]") só existem depois de "GC_criarArestasEntrada".
+ * @note As antenas de cada frequência "f" ("verticesFrequencias[inicioFrequencias[f]]" a
+ *       "verticesFrequencias[inicioFrequencias[f + 1] - 1]", por ordem crescente de identificador) só
+ *       existem depois de "GC_criarIndiceFrequencias".
+ */
+typedef struct GrafoCompacto
+{
+    uint32_t numVertices;
+    uint32_t numArestas;
+
+    bool coordenadas16;
+    int32_t origemX;
+    int32_t origemY;
+    int32_t *x;
+    int32_t *y;
+    uint16_t *x16;
+    uint16_t *y16;
+    char *frequencias;
+
+    uint32_t *inicioArestas;
+    uint32_t *destinos;
+
+    uint32_t *inicioArestasEntrada;
+    uint32_t *origens;
+
+    uint32_t *inicioFrequencias;
+    uint32_t *verticesFrequencias;
+
+} GrafoCompacto;
+
+/**
+ * @struct RelatorioMemoria
+ * @brief Memória ocupada por uma representação do grafo (sem contar o overhead do alocador).
+ */
+typedef struct RelatorioMemoria
+{
+    size_t numVertices;
+    size_t numArestas;
+    size_t bytesVertices;
+    size_t bytesArestas;
+    double bytesPorVertice;
+    double bytesPorAresta;
+
+} RelatorioMemoria;
+
+/**
+ * @brief Função chamada para cada caminho encontrado por "GC_procurarCaminhos".
+ *
+ * @return Valor negativo para interromper a procura.
+ */
+typedef int (*FuncaoCaminho)(const uint32_t *caminho, int tamanho, void *contexto);
+
+/**
+ * @brief Função chamada para cada interseção encontrada por "GC_procurarIntersecoes" (com o par de antenas que a origina).
+ *
+ * @return Valor negativo para interromper a procura.
+ */
+typedef int (*FuncaoIntersecaoCompacta)(uint32_t antena1, uint32_t antena2, int x, int y, void *contexto);
+
+// Declaração das funções
+GrafoCompacto *GC_criarGrafoCompacto(Grafo *cidade, bool coordenadas16, int *erro);
+GrafoCompacto *GC_libertarGrafoCompacto(GrafoCompacto *grafo);
+int GC_criarArestasEntrada(GrafoCompacto *grafo);
+int GC_criarIndiceFrequencias(GrafoCompacto *grafo);
+
+int GC_coordenadaX(const GrafoCompacto *grafo, uint32_t vertice);
+int GC_coordenadaY(const GrafoCompacto *grafo, uint32_t vertice);
+uint32_t GC_procurarAntena(const GrafoCompacto *grafo, int x, int y);
+
+int GC_procurarLargura(const GrafoCompacto *grafo, uint32_t inicio, uint32_t *ordem);
+int GC_procurarProfundidade(const GrafoCompacto *grafo, uint32_t inicio, uint32_t *ordem);
+int GC_procurarCaminhos(const GrafoCompacto *grafo, uint32_t inicio, uint32_t destino, FuncaoCaminho funcao, void *contexto);
+int GC_procurarIntersecoes(const GrafoCompacto *grafo, char frequencia1, char frequencia2, FuncaoIntersecaoCompacta funcao, void *contexto);
+
+int GC_calcularMemoria(const GrafoCompacto *grafo, RelatorioMemoria *relatorio);
+int GC_calcularMemoriaGrafo(Grafo *cidade, RelatorioMemoria *relatorio);
+int GC_apresentarMemoria(Grafo *cidade, const GrafoCompacto *grafo);
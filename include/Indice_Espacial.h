@@ -0,0 +1,77 @@
+/**
+ * @file Indice_Espacial.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações do índice espacial (grelha uniforme)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Lista de Erros
+#define INDICE_ERRO_PONTEIRO_INVALIDO -12
+#define INDICE_ERRO_PONTO_NAO_EXISTE -13
+#define INDICE_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @def TAMANHO_CELULA_PREDEFINIDO
+ * @brief Lado (em unidades da grelha do mapa) de cada célula do índice, quando não é indicado outro.
+ */
+#define TAMANHO_CELULA_PREDEFINIDO 16
+
+/**
+ * @struct PontoEspacial
+ * @brief Ponto (x, y) guardado no índice, com um apontador para o elemento que representa.
+ */
+typedef struct PontoEspacial
+{
+    int x;
+    int y;
+    void *dados;
+    struct PontoEspacial *prox;
+
+} PontoEspacial;
+
+/**
+ * @struct IndiceEspacial
+ * @brief Índice espacial em grelha uniforme.
+ *
+ * O plano é dividido em células quadradas de lado "tamanhoCelula". Cada célula (cx, cy) é dispersa
+ * por "capacidade" baldes (potência de 2), pelo que coordenadas negativas ou muito afastadas não
+ * exigem uma grelha densa. Um balde pode conter pontos de várias células.
+ */
+typedef struct IndiceEspacial
+{
+    int tamanhoCelula;
+    int numPontos;
+    int capacidade;
+    PontoEspacial **baldes;
+
+} IndiceEspacial;
+
+/**
+ * @brief Função chamada para cada ponto encontrado numa consulta.
+ *
+ * @return Valor negativo para interromper a consulta (devolvido pela função de consulta).
+ */
+typedef int (*FuncaoPonto)(int x, int y, void *dados, void *contexto);
+
+// Declaração das funções
+IndiceEspacial *criarIndiceEspacial(int tamanhoCelula);
+IndiceEspacial *libertarIndiceEspacial(IndiceEspacial *indice);
+int limparIndiceEspacial(IndiceEspacial *indice);
+
+int inserirIndiceEspacial(IndiceEspacial *indice, int x, int y, void *dados);
+int removerIndiceEspacial(IndiceEspacial *indice, int x, int y, void *dados);
+
+int consultarRetangulo(IndiceEspacial *indice, int x1, int y1, int x2, int y2, FuncaoPonto funcao, void *contexto);
+int consultarRaio(IndiceEspacial *indice, int x, int y, int raio, FuncaoPonto funcao, void *contexto);
+int consultarVizinhosProximos(IndiceEspacial *indice, int x, int y, int k, PontoEspacial **resultados);
@@ -13,16 +13,28 @@
 // Bibliotecas
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <unistd.h>
 
+// Headers
+#include "../include/Registos.h"
+#include "../include/Indice_Espacial.h"
+#include "../include/Saidas.h"
+#include "../include/Tabelas.h"
+#include "../include/Grafos.h"
+
 // Lista de Erros
 #define LL_ERRO_REDE_PONTEIRO_INVALIDO -11
 #define LL_ERRO_ANTENA_JA_EXISTE -5
 #define LL_ERRO_ANTENA_NAO_EXISTE -6
 #define LL_ERRO_NEFASTO_JA_EXISTE -17
 #define LL_ERRO_NEFASTO_NAO_EXISTE -18
+#define LL_ERRO_OPERACAO_NAO_SUPORTADA -19
+#define LL_ERRO_ANTENA_REPETIDA_LOTE -9
 #define LL_ERRO_ABRIR_FICHEIRO -100
+#define LL_ERRO_ESCRITA_FICHEIRO -29
 #define LL_ERRO_ALOCACAO_MEMORIA -404
 
 /**  
@@ -52,6 +64,17 @@ typedef struct Nefasto
 
 /**
  * @brief Estrutura para conter Antenas, Nefastos e número de cada
+ * 
+ * @note Se "vetorial" for "true" (rede criada com "LL_criarRedeVetorial"), as antenas não usam a
+ *       lista ligada: ficam em vetores paralelos ("antenasX", "antenasY" e "antenasFrequencia"),
+ *       ordenados pela chave (y, x), com "capacidadeAntenas" posições alocadas.
+ * @note "largura" e "altura" guardam as dimensões da grelha do último mapa carregado
+ *       com "LL_carregarAntenas" (0 se nenhum mapa foi carregado).
+ * @note "indiceNefastos" (opcional, criado com "LL_criarIndiceNefastos") indexa os nefastos por posição
+ *       e é atualizado em cada inserção; sem ele, as consultas espaciais percorrem a lista.
+ * @note Se "cidade" não for NULL (rede criada com "LL_criarRedePartilhada"), as antenas são os vértices
+ *       dessa cidade: não há cópias "Antena", as funções "LL_" de antenas atuam sobre a cidade e
+ *       "numAntenas", "largura" e "altura" são copiados da cidade em cada chamada "LL_".
  */
 typedef struct Rede
 {
@@ -60,10 +83,25 @@ typedef struct Rede
     Nefasto *primeiroNefasto;
     int numNefastos;
 
+    bool vetorial;
+    int capacidadeAntenas;
+    int *antenasX;
+    int *antenasY;
+    char *antenasFrequencia;
+
+    int largura;
+    int altura;
+
+    IndiceEspacial *indiceNefastos;
+
+    Grafo *cidade;
+
 } Rede;
 
 // Declaração das funções
 Rede *LL_criarRede();
+Rede *LL_criarRedeVetorial();
+Rede *LL_criarRedePartilhada(Grafo *cidade);
 Antena *LL_criarAntena(char frequencia, int x, int y);
 Nefasto *LL_criarNefasto(int x, int y);
 
@@ -73,15 +111,27 @@ int LL_libertarNefastos(Rede *rede);
 
 int LL_adicionarAntenaOrdenada(Rede *rede, char *frequencia, int x, int y);
 Antena *LL_adicionarAntenaFim(Rede *rede, Antena *ultimaAntena, char frequencia, int x, int y, int *erro);
+int LL_adicionarAntenasLote(Rede *rede, const RegistoAntena *lote, int quantidade, int *resultados);
 int LL_adicionarNefastoOrdenado(Rede *rede, int x, int y);
 Nefasto *LL_adicionarNefastoFim(Rede *rede, Nefasto *ultimoNefasto, int x, int y, int *erro);
 
 int LL_removerAntena(Rede *rede, char *frequencia, int x, int y);
 
 int LL_calcularNefastos(Rede *rede, bool coordenadasNegativas);
+int LL_calcularNefastosMapa(Rede *rede);
+
+int LL_criarIndiceNefastos(Rede *rede, int tamanhoCelula);
+int LL_procurarNefastosRaio(Rede *rede, int x, int y, int raio, Nefasto **resultados, int capacidade);
+int LL_procurarNefastosRetangulo(Rede *rede, int x1, int y1, int x2, int y2, Nefasto **resultados, int capacidade);
+int LL_procurarNefastosProximos(Rede *rede, int x, int y, int k, Nefasto **resultados);
 
 int LL_carregarAntenas(Rede *rede, const char *localizacaoFicheiro);
 int LL_carregarNefastos(Rede *rede, const char *localizacaoFicheiro);
 
-bool LL_apresentarAntenas(Rede *rede);
-bool LL_apresentarNefastos(Rede *rede);
\ No newline at end of file
+int LL_desenharMapa(Rede *rede, FILE *ficheiro);
+int LL_guardarMapa(Rede *rede, const char *localizacaoFicheiro);
+
+bool LL_apresentarAntenas(Rede *rede, Saida *saida);
+bool LL_apresentarNefastos(Rede *rede, Saida *saida);
+int LL_apresentarAntenasTabela(Rede *rede, Tabela *tabela);
+int LL_apresentarNefastosTabela(Rede *rede, Tabela *tabela);
\ No newline at end of file
@@ -20,6 +20,12 @@
 // Headers
 #include "../include/Listas_Ligadas.h"
 #include "../include/Grafos.h"
+#include "../include/Grafos_Compactos.h"
+#include "../include/Fecho_Transitivo.h"
+#include "../include/Componentes.h"
+#include "../include/Nefastos_Externos.h"
+#include "../include/Formatos.h"
+#include "../include/Servidor.h"
 
 /**
  * @def MAX_CAMINHO
@@ -35,8 +41,10 @@
 #define MAX_RESULTADOS 2
 
 #define QUESTAO_INTERLIGAR_ANTENAS "Pretende interligar as antenas da cidade com a mesma frequência (s/n)?"
+#define QUESTAO_INTERLIGAR_PENDENTE "Pretende interligar as antenas apenas quando forem percorridas (s/n)?"
 #define QUESTAO_ADICIONAR_ARESTA_RETORNO "Pretende adicionar a aresta de retorno (s/n)?"
 #define QUESTAO_REMOVER_ARESTA_RETORNO "Pretende remover a aresta de retorno (s/n)?"
+#define QUESTAO_PAGINAR_LISTAS "Pretende apresentar as listas por páginas (s/n)?"
 
 typedef struct Dados
 {
@@ -52,5 +60,6 @@ int limparEcra();
 Vertice *procurarAntenaMenu(Grafo *cidade, Dados *dados, int x, int y);
 bool requesitarDados(Grafo *cidade, Dados *dados, int numFrequencias, int numCoordenadas, bool procurarAntena);
 bool requesitarResposta(const char *questao);
+bool continuarPagina(int pagina, void *contexto);
 int imprimirErros(Dados *dados, int resultado);
 void menuPrincipal();
\ No newline at end of file
@@ -0,0 +1,61 @@
+/**
+ * @file Nefastos_Externos.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações do cálculo dos efeitos nefastos em disco (fora da memória)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <unistd.h>
+
+// Lista de Erros
+#define NE_ERRO_ESCRITA -29
+#define NE_ERRO_FICHEIRO_TEMPORARIO -31
+#define NE_ERRO_ABRIR_FICHEIRO -100
+#define NE_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @def NE_CHAVES_BLOCO
+ * @brief Número de nefastos candidatos ordenados em memória de cada vez (8 MiB de chaves).
+ */
+#define NE_CHAVES_BLOCO (1 << 20)
+
+/**
+ * @def NE_CHAVES_LEITURA
+ * @brief Número de chaves lidas de cada vez de cada bloco ordenado, durante a junção.
+ */
+#define NE_CHAVES_LEITURA 4096
+
+/**
+ * @struct EstatisticasExternas
+ * @brief Resumo de um cálculo em disco (opcional).
+ *
+ * @note "maiorFrequencia" é o número de antenas da maior partição, o que limita a memória usada
+ *       (juntamente com "NE_CHAVES_BLOCO" e "NE_CHAVES_LEITURA" por bloco).
+ * @note "numBlocos" é o número de blocos ordenados guardados em disco (0 se os candidatos couberam num só bloco).
+ */
+typedef struct EstatisticasExternas
+{
+    int numAntenas;
+    int numFrequencias;
+    int maiorFrequencia;
+    int numBlocos;
+    int64_t numCandidatos;
+    int numNefastos;
+    int largura;
+    int altura;
+
+} EstatisticasExternas;
+
+// Declaração das funções
+int NE_calcularNefastosFicheiro(const char *localizacaoMapa, const char *localizacaoSaida, bool limitarMapa, EstatisticasExternas *estatisticas);
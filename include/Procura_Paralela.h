@@ -0,0 +1,70 @@
+/**
+ * @file Procura_Paralela.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações da procura em largura paralela sobre o grafo compacto
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+// Headers
+#include "../include/Grafos_Compactos.h"
+
+/**
+ * @def PP_BLOCO
+ * @brief Número de elementos (antenas da fronteira ou do grafo) que cada thread reserva de cada vez.
+ */
+#define PP_BLOCO 256
+
+/**
+ * @def PP_ALFA
+ * @brief Passa de expansão descendente (top-down) para ascendente (bottom-up) quando as arestas da
+ *        fronteira excedem 1/PP_ALFA das arestas das antenas ainda não visitadas.
+ */
+#define PP_ALFA 14
+
+/**
+ * @def PP_BETA
+ * @brief Volta à expansão descendente quando a fronteira tem menos de 1/PP_BETA das antenas.
+ */
+#define PP_BETA 24
+
+/**
+ * @def PP_LIMIAR_SEQUENCIAL
+ * @brief Número de arestas abaixo do qual a procura é feita com uma fila simples, sem threads nem mapas de bits.
+ */
+#define PP_LIMIAR_SEQUENCIAL (1 << 15)
+
+/**
+ * @def PP_ARESTAS_POR_THREAD
+ * @brief Número mínimo de arestas por thread (limita as threads criadas nos grafos médios).
+ */
+#define PP_ARESTAS_POR_THREAD (1 << 16)
+
+/**
+ * @struct EstatisticasLargura
+ * @brief Resumo de uma procura em largura paralela.
+ */
+typedef struct EstatisticasLargura
+{
+    int numAlcancadas;
+    int numNiveis;
+    int niveisAscendentes;
+    int numThreads;
+
+} EstatisticasLargura;
+
+// Declaração das funções
+int PP_procurarLarguraParalela(const GrafoCompacto *grafo, uint32_t inicio, int32_t *distancias, int numThreads, EstatisticasLargura *estatisticas);
+int PP_numeroProcessadores();
@@ -0,0 +1,25 @@
+/**
+ * @file Registos.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com os registos de antenas partilhados pelas listas ligadas e pelos grafos
+ * @version 2.0
+ * @date 2025-05-25
+ * 
+ * @copyright Copyright (c) 2025
+ * 
+ */
+#pragma once
+
+/**
+ * @struct RegistoAntena
+ * @brief Registo (frequência, x, y) de uma antena, independente da estrutura que a guarda.
+ *
+ * Usado pelas operações em lote ("LL_adicionarAntenasLote" e "adicionarAntenasLote").
+ */
+typedef struct RegistoAntena
+{
+    char frequencia;
+    int x;
+    int y;
+
+} RegistoAntena;
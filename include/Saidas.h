@@ -0,0 +1,130 @@
+/**
+ * @file Saidas.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações dos destinos (saídas) dos resultados das consultas
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+
+// Headers
+#include "../include/Registos.h"
+
+// Lista de Erros
+#define SAIDA_ERRO_PONTEIRO_INVALIDO -28
+#define SAIDA_ERRO_ESCRITA -29
+#define SAIDA_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @def TAMANHO_BUFFER_SAIDA
+ * @brief Tamanho, por defeito, do buffer das saídas para ficheiro.
+ */
+#define TAMANHO_BUFFER_SAIDA 65536
+
+/**
+ * @enum TipoResultado
+ * @brief Tipo de um resultado produzido por uma consulta.
+ */
+typedef enum TipoResultado
+{
+    RESULTADO_ANTENA,     /* "antena" */
+    RESULTADO_ARESTA,     /* "antena" -> "outra" */
+    RESULTADO_CAMINHO,    /* "caminho[0]" -> ... -> "caminho[tamanho - 1]" */
+    RESULTADO_INTERSECAO, /* "antena" -x- "outra", no ponto ("x", "y") */
+    RESULTADO_NEFASTO     /* ("x", "y") */
+
+} TipoResultado;
+
+/**
+ * @struct Resultado
+ * @brief Um resultado de uma consulta (só são preenchidos os campos do seu tipo).
+ *
+ * @note "caminho" só é válido durante a chamada que recebe o resultado. Nas saídas para vetor, o caminho
+ *       é copiado e o resultado guarda a posição da cópia ("inicioCaminho"); use "lerResultado".
+ */
+typedef struct Resultado
+{
+    TipoResultado tipo;
+    RegistoAntena antena;
+    RegistoAntena outra;
+    int x;
+    int y;
+    const RegistoAntena *caminho;
+    int tamanho;
+    int inicioCaminho;
+
+} Resultado;
+
+/**
+ * @brief Função chamada para cada resultado de uma saída "SAIDA_FUNCAO".
+ *
+ * @return Valor negativo para interromper a consulta (devolvido pela função de consulta).
+ */
+typedef int (*FuncaoResultado)(const Resultado *resultado, void *contexto);
+
+/**
+ * @enum TipoSaida
+ * @brief Destino dos resultados.
+ */
+typedef enum TipoSaida
+{
+    SAIDA_TERMINAL, /* Texto no "stdout", escrito no fim de cada resultado */
+    SAIDA_FUNCAO,   /* Chama "funcao" para cada resultado */
+    SAIDA_VETOR,    /* Guarda os resultados em "resultados" */
+    SAIDA_FICHEIRO  /* Texto num ficheiro, escrito quando o buffer enche (e em "despejarSaida") */
+
+} TipoSaida;
+
+/**
+ * @struct Saida
+ * @brief Destino dos resultados das consultas ("procurarLargura", "listarAntenas", "LL_apresentarAntenas", ...).
+ *
+ * As consultas recebem um apontador para uma saída; NULL equivale a uma saída para o terminal.
+ *
+ * @note Nas saídas de texto os resultados são formatados como no terminal (ex.: "'A'(1, 2)").
+ * @note Nas saídas para vetor, os caminhos são copiados para "antenasCaminhos" e cada resultado guarda
+ *       a posição ("inicioCaminho") da sua cópia, que "lerResultado" converte em apontador.
+ */
+typedef struct Saida
+{
+    TipoSaida tipo;
+    int numResultados;
+
+    FuncaoResultado funcao;
+    void *contexto;
+
+    Resultado *resultados;
+    int capacidadeResultados;
+    RegistoAntena *antenasCaminhos;
+    int numAntenasCaminhos;
+    int capacidadeCaminhos;
+
+    FILE *ficheiro;
+    char *buffer;
+    size_t usado;
+    size_t tamanhoBuffer;
+
+} Saida;
+
+// Declaração das funções
+Saida *criarSaidaTerminal();
+Saida *criarSaidaFuncao(FuncaoResultado funcao, void *contexto);
+Saida *criarSaidaVetor();
+Saida *criarSaidaFicheiro(FILE *ficheiro, size_t tamanhoBuffer);
+Saida *libertarSaida(Saida *saida);
+
+int escreverResultado(Saida *saida, const Resultado *resultado);
+int lerResultado(const Saida *saida, int indice, Resultado *resultado);
+int escreverAntena(Saida *saida, char frequencia, int x, int y);
+int escreverAresta(Saida *saida, char frequencia1, int x1, int y1, char frequencia2, int x2, int y2);
+int escreverNefasto(Saida *saida, int x, int y);
+int despejarSaida(Saida *saida);
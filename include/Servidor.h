@@ -0,0 +1,131 @@
+/**
+ * @file Servidor.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações do servidor de consultas (socket UNIX)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Protocolo (uma linha por pedido, uma ou mais linhas por resposta, a última "OK <n>" ou "ERRO <código> <mensagem>"):
+ *
+ *   PROCURAR x y                 -> "f x y" da antena
+ *   LARGURA x y                  -> "f x y" de cada antena alcançada (procura em largura)
+ *   PROFUNDIDADE x y             -> "f x y" de cada antena alcançada (procura em profundidade)
+ *   DISTANCIAS x y               -> "f x y d" de cada antena alcançada, com a distância "d" em arestas
+ *                                   (procura em largura paralela, pela ordem (y, x) das antenas)
+ *   CAMINHOS x1 y1 x2 y2 [max]   -> "x,y x,y ..." de cada caminho (no máximo "max", por defeito "SERVIDOR_MAX_CAMINHOS")
+ *   INTERSECOES f1 f2            -> "x y" de cada ponto de interseção
+ *   NEFASTOS                     -> "x y" de cada efeito nefasto da rede
+ *   COMPONENTES [max]            -> "tamanho x y f:n f:n ..." das maiores componentes conexas (no máximo "max",
+ *                                   por defeito "CC_NUM_COMPONENTES_APRESENTAR"), com a antena de menor
+ *                                   posição e o número de antenas de cada frequência
+ *   INSERIR f x y                -> insere a antena na cidade e na rede (ou em nenhuma, se falhar numa delas)
+ *   REMOVER x y                  -> remove a antena da cidade e da rede ("f x y" da antena removida; ou de
+ *                                   nenhuma, se não existir numa delas)
+ *   SAIR                         -> termina a ligação
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+
+// Headers
+#include "../include/Grafos.h"
+#include "../include/Grafos_Compactos.h"
+#include "../include/Componentes.h"
+#include "../include/Procura_Paralela.h"
+#include "../include/Listas_Ligadas.h"
+#include "../include/Versoes.h"
+
+// Lista de Erros
+#define SERVIDOR_ERRO_PONTEIRO_INVALIDO -23
+#define SERVIDOR_ERRO_PEDIDO_INVALIDO -24
+#define SERVIDOR_ERRO_SOCKET -120
+#define SERVIDOR_ERRO_TRABALHADORES -121
+#define SERVIDOR_ERRO_ALOCACAO_MEMORIA -404
+
+#define SERVIDOR_CAMINHO_PREDEFINIDO "/tmp/gestor_estruturas.sock"
+#define SERVIDOR_NUM_TRABALHADORES 4
+#define SERVIDOR_CAPACIDADE_FILA 64
+#define SERVIDOR_TAMANHO_LINHA 256
+#define SERVIDOR_MAX_CAMINHOS 100
+#define SERVIDOR_TEMPO_INATIVIDADE 60
+
+/**
+ * @struct LigacaoServidor
+ * @brief Ligação de um cliente, com o pedido que ainda está a ser recebido.
+ *
+ * @note "pedido" guarda os "tamanho" bytes já recebidos de um pedido incompleto; "descartar" indica que o
+ *       pedido excedeu "SERVIDOR_TAMANHO_LINHA" e é ignorado até ao fim da linha.
+ * @note "ultimaAtividade" é o instante do último pedido (a ligação é fechada ao fim de
+ *       "SERVIDOR_TEMPO_INATIVIDADE" segundos sem pedidos) e "prox" liga as ligações devolvidas.
+ */
+typedef struct LigacaoServidor
+{
+    int descritor;
+    FILE *saida;
+    char pedido[SERVIDOR_TAMANHO_LINHA];
+    int tamanho;
+    bool descartar;
+    time_t ultimaAtividade;
+    struct LigacaoServidor *prox;
+
+} LigacaoServidor;
+
+/**
+ * @struct Servidor
+ * @brief Servidor de consultas sobre a cidade e a rede, com um conjunto fixo de trabalhadores.
+ *
+ * As consultas (LARGURA, PROFUNDIDADE, DISTANCIAS, CAMINHOS, PROCURAR, COMPONENTES, INTERSECOES) usam a versão
+ * publicada da cidade ("publicador"), com o estado de cada procura alocado por pedido, e não bloqueiam com as
+ * edições (INTERSECOES usa o índice por frequência da versão).
+ * A rede ("rede") é protegida por "trincoRede".
+ *
+ * @note "executarServidor" espera (com "poll") por novas ligações e por pedidos nas ligações inativas; as
+ *       ligações com pedidos esperam em "fila" (circular, com "SERVIDOR_CAPACIDADE_FILA" posições) até um
+ *       trabalhador ficar livre. O trabalhador responde aos pedidos completos e devolve a ligação
+ *       ("devolvidas", avisando pelo "despertar"), pelo que nenhuma ligação ocupa um trabalhador enquanto
+ *       está inativa.
+ */
+typedef struct Servidor
+{
+    PublicadorVersoes *publicador;
+    Rede *rede;
+    pthread_mutex_t trincoRede;
+    bool nefastosAtualizados;
+
+    int descritor;
+    int despertar[2];
+    char caminho[108];
+    atomic_bool terminar;
+
+    int numTrabalhadores;
+    pthread_t *trabalhadores;
+    int *ligacoesAtivas;
+
+    LigacaoServidor *fila[SERVIDOR_CAPACIDADE_FILA];
+    int inicioFila;
+    int numFila;
+    LigacaoServidor *devolvidas;
+    pthread_mutex_t trincoFila;
+    pthread_cond_t filaComLigacoes;
+    pthread_cond_t filaComEspaco;
+
+} Servidor;
+
+// Declaração das funções
+Servidor *criarServidor(const char *caminho, Grafo *cidade, Rede *rede, int numTrabalhadores, int *erro);
+Servidor *libertarServidor(Servidor *servidor);
+
+int executarServidor(Servidor *servidor);
+int pararServidor(Servidor *servidor);
+int responderPedido(Servidor *servidor, const char *linha, FILE *saida);
+
+int iniciarServidor(const char *caminho, const char *ficheiroCidade, const char *ficheiroAntenas, int numTrabalhadores);
@@ -0,0 +1,109 @@
+/**
+ * @file Tabelas.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações da apresentação de tabelas (com buffer e paginação)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdbool.h>
+#include <unistd.h>
+#include <errno.h>
+
+// Lista de Erros
+#define TB_ERRO_ESCRITA -29
+#define TB_ERRO_TABELA_PONTEIRO_INVALIDO -30
+#define TB_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @def TB_TAMANHO_BUFFER
+ * @brief Tamanho, por defeito, do buffer das tabelas (1 MiB).
+ */
+#define TB_TAMANHO_BUFFER (1 << 20)
+
+/**
+ * @def TB_LARGURA_COLUNA
+ * @brief Largura do conteúdo de cada coluna (como "%-11d"); cada coluna ocupa "| " + 11 caracteres.
+ */
+#define TB_LARGURA_COLUNA 11
+
+/**
+ * @def TB_LINHAS_PAGINA
+ * @brief Número de linhas por página usado pelo menu.
+ */
+#define TB_LINHAS_PAGINA 40
+
+/**
+ * @brief Função chamada no fim de cada página (depois de a página ser escrita).
+ *
+ * @return "true" para continuar com a página seguinte, "false" para terminar a tabela.
+ */
+typedef bool (*FuncaoPagina)(int pagina, void *contexto);
+
+/**
+ * @struct Tabela
+ * @brief Apresentação de tabelas de colunas com largura fixa num descritor de ficheiro.
+ *
+ * As linhas são formatadas num buffer (sem "printf") e escritas com "write" apenas quando o buffer
+ * enche, no fim de cada página e no fim da tabela. A mesma tabela pode apresentar várias tabelas
+ * seguidas ("TB_iniciarTabela" ... "TB_terminarTabela"), reaproveitando o buffer.
+ *
+ * @note Só são apresentadas as linhas "primeiraLinha" a "primeiraLinha + maximoLinhas - 1"
+ *       (contadas a partir de 0; "maximoLinhas" < 0 apresenta até ao fim). Quem produz as linhas
+ *       começa em "TB_saltarLinhas", para não percorrer as anteriores linha a linha.
+ * @note Com "linhasPorPagina" > 0, a tabela é fechada no fim de cada página, "funcaoPagina" é
+ *       chamada e o cabeçalho é repetido na página seguinte.
+ * @note "interrompida" indica que "funcaoPagina" terminou a tabela atual antes do fim (para quem
+ *       apresenta várias tabelas seguidas poder parar também as seguintes).
+ */
+typedef struct Tabela
+{
+    int descritor;
+    char *buffer;
+    size_t usado;
+    size_t tamanhoBuffer;
+    int erro;
+
+    int linhasPorPagina;
+    FuncaoPagina funcaoPagina;
+    void *contexto;
+
+    int primeiraLinha;
+    int maximoLinhas;
+
+    const char *cabecalho;
+    int numColunas;
+    int colunaAtual;
+    int numLinhas;
+    int linhasApresentadas;
+    int linhasPagina;
+    int pagina;
+    bool terminada;
+    bool interrompida;
+
+} Tabela;
+
+// Declaração das funções
+Tabela *TB_criarTabela(int descritor, size_t tamanhoBuffer);
+Tabela *TB_libertarTabela(Tabela *tabela);
+
+int TB_definirPaginacao(Tabela *tabela, int linhasPorPagina, FuncaoPagina funcaoPagina, void *contexto);
+int TB_definirIntervalo(Tabela *tabela, int primeiraLinha, int maximoLinhas);
+
+int TB_iniciarTabela(Tabela *tabela, const char *cabecalho, int numColunas);
+int TB_saltarLinhas(Tabela *tabela);
+bool TB_iniciarLinha(Tabela *tabela);
+int TB_colunaCaracter(Tabela *tabela, char caracter);
+int TB_colunaInteiro(Tabela *tabela, int valor);
+int TB_terminarTabela(Tabela *tabela);
+
+int TB_escreverTexto(Tabela *tabela, const char *texto);
+int TB_despejarTabela(Tabela *tabela);
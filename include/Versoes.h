@@ -0,0 +1,75 @@
+/**
+ * @file Versoes.h
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Cabeçalho com definições e declarações da publicação de versões (snapshots) da cidade
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#pragma once
+
+// Bibliotecas
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdatomic.h>
+#include <pthread.h>
+
+// Headers
+#include "../include/Grafos.h"
+#include "../include/Grafos_Compactos.h"
+
+// Lista de Erros
+#define VERSOES_ERRO_PUBLICADOR_PONTEIRO_INVALIDO -22
+#define VERSOES_ERRO_ALOCACAO_MEMORIA -404
+
+/**
+ * @struct Versao
+ * @brief Versão imutável da cidade, partilhada pelos leitores através de uma contagem de referências.
+ *
+ * @note A versão (e o seu grafo compacto) é libertada quando a última referência é devolvida
+ *       com "libertarVersao".
+ * @note O grafo compacto já inclui as arestas de entrada ("GC_criarArestasEntrada") e o índice por
+ *       frequência ("GC_criarIndiceFrequencias").
+ */
+typedef struct Versao
+{
+    GrafoCompacto *grafo;
+    uint64_t numero;
+    atomic_int referencias;
+
+} Versao;
+
+/**
+ * @struct PublicadorVersoes
+ * @brief Dono da cidade editável e da versão publicada mais recente.
+ *
+ * Os escritores editam "cidade" entre "iniciarEdicao" e "terminarEdicao" (serializados por
+ * "trincoEscrita") e, no fim, publicam uma nova versão. Os leitores obtêm a versão atual com
+ * "adquirirVersao": "trincoVersao" só protege a troca do apontador e o incremento da referência,
+ * pelo que nunca espera pela construção de uma versão nem por uma edição em curso.
+ */
+typedef struct PublicadorVersoes
+{
+    Grafo *cidade;
+    pthread_mutex_t trincoEscrita;
+
+    Versao *atual;
+    pthread_mutex_t trincoVersao;
+    uint64_t proximoNumero;
+
+} PublicadorVersoes;
+
+// Declaração das funções
+PublicadorVersoes *criarPublicador(Grafo *cidade, int *erro);
+PublicadorVersoes *libertarPublicador(PublicadorVersoes *publicador);
+
+Grafo *iniciarEdicao(PublicadorVersoes *publicador);
+int terminarEdicao(PublicadorVersoes *publicador, bool publicar);
+int publicarVersao(PublicadorVersoes *publicador);
+
+Versao *adquirirVersao(PublicadorVersoes *publicador);
+Versao *libertarVersao(Versao *versao);
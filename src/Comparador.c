@@ -0,0 +1,2131 @@
+/**
+ * @file Comparador.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Comparação das implementações alternativas com as implementações de referência (listas ligadas)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ * Gera mapas aleatórios, executa sobre cada um as implementações de referência ("carregarCidade",
+ * "LL_carregarAntenas", "LL_calcularNefastos", "interligarAntenasGenerica", "procurarLargura", ...) e as
+ * implementações alternativas, compara as saídas elemento a elemento e apresenta a aceleração de cada uma.
+ *
+ * Utilização: ./Comparador [número de mapas] [semente] [largura] [altura]
+ *
+ * @note Só é medido o tempo das operações comparadas (não a criação dos grafos compactos ou a leitura das saídas).
+ * @note Devolve EXIT_FAILURE se alguma implementação alternativa produzir uma saída diferente da referência.
+ */
+#include "../include/Comparador.h"
+
+/*---- Relatório -------------------------------------------------------------------------------------------------------------*/
+
+static Comparacao comparacoes[CP_MAX_COMPARACOES];
+static int numComparacoes = 0;
+static int mapaAtual = 0;
+
+// Números de threads comparados na procura em largura paralela (0 usa o número de processadores)
+static const VarianteThreads variantesThreads[] = {
+    { "PP_procurarLarguraParalela (1 thread)", 1 },
+    { "PP_procurarLarguraParalela (2 threads)", 2 },
+    { "PP_procurarLarguraParalela (4 threads)", 4 },
+    { "PP_procurarLarguraParalela", 0 },
+};
+#define CP_NUM_VARIANTES_THREADS ((int)(sizeof(variantesThreads) / sizeof(variantesThreads[0])))
+
+/**
+ * @brief Devolve o tempo atual (monotónico), em segundos.
+ */
+static double CP_agora()
+{
+    struct timespec tempo;
+    clock_gettime(CLOCK_MONOTONIC, &tempo);
+
+    return tempo.tv_sec + tempo.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Termina o comparador se uma operação de preparação falhar (não é uma diferença entre implementações).
+ */
+static void CP_verificar(int resultado, const char *operacao)
+{
+    if (resultado >= 0) return;
+
+    fprintf(stderr, "❌ %s falhou (%d) no mapa %d.\n", operacao, resultado, mapaAtual);
+    exit(EXIT_FAILURE);
+}
+
+/**
+ * @brief Acrescenta um elemento a uma lista comparada.
+ */
+static void CP_acrescentar(ListaComparada *lista, RegistoAntena origem, RegistoAntena destino)
+{
+    if ((*lista).quantidade == (*lista).capacidade)
+    {
+        int capacidade = ((*lista).capacidade > 0) ? (*lista).capacidade * 2 : 1024;
+        ElementoComparado *temp = realloc((*lista).elementos, capacidade * sizeof(ElementoComparado));
+
+        if (temp == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "realloc");
+
+        (*lista).elementos = temp;
+        (*lista).capacidade = capacidade;
+    }
+
+    (*lista).elementos[(*lista).quantidade++] = (ElementoComparado){ origem, destino };
+}
+
+/**
+ * @brief Acrescenta uma antena (ou um efeito nefasto) a uma lista comparada.
+ */
+static void CP_acrescentarAntena(ListaComparada *lista, char frequencia, int x, int y)
+{
+    CP_acrescentar(lista, (RegistoAntena){ frequencia, x, y }, (RegistoAntena){ 0 });
+}
+
+/**
+ * @brief Compara dois registos pela ordem (y, x) e, em empate, pela frequência.
+ */
+static int CP_compararRegistos(const RegistoAntena *a, const RegistoAntena *b)
+{
+    if ((*a).y != (*b).y) return ((*a).y < (*b).y) ? -1 : 1;
+    if ((*a).x != (*b).x) return ((*a).x < (*b).x) ? -1 : 1;
+
+    return (*a).frequencia - (*b).frequencia;
+}
+
+/**
+ * @brief Compara dois elementos para o "qsort" (origem e, depois, destino).
+ */
+static int CP_compararElementos(const void *a, const void *b)
+{
+    const ElementoComparado *elementoA = a, *elementoB = b;
+    int resultado = CP_compararRegistos(&(*elementoA).origem, &(*elementoB).origem);
+
+    return (resultado != 0) ? resultado : CP_compararRegistos(&(*elementoA).destino, &(*elementoB).destino);
+}
+
+/**
+ * @brief Escreve um elemento de uma lista comparada (ou "(fim)" se não existir).
+ */
+static void CP_escreverElemento(const ListaComparada *lista, int indice)
+{
+    if (indice >= (*lista).quantidade)
+    {
+        printf("(fim, %d elementos)", (*lista).quantidade);
+        return;
+    }
+
+    const ElementoComparado *elemento = &(*lista).elementos[indice];
+    printf("'%c'(%d, %d)", (*elemento).origem.frequencia, (*elemento).origem.x, (*elemento).origem.y);
+    if ((*elemento).destino.frequencia != '\0') printf(" -> '%c'(%d, %d)", (*elemento).destino.frequencia, (*elemento).destino.x, (*elemento).destino.y);
+    else if ((*elemento).destino.x != 0 || (*elemento).destino.y != 0) printf(" [%d]", (*elemento).destino.x);
+}
+
+/**
+ * @brief Compara a saída de uma implementação alternativa com a da referência e regista os tempos.
+ *
+ * @param nome Nome da implementação alternativa.
+ * @param referencia Nome da implementação de referência.
+ * @param esperada Saída da referência.
+ * @param obtida Saída da implementação alternativa.
+ * @param tempoReferencia Tempo da referência (segundos).
+ * @param tempoAlternativa Tempo da implementação alternativa (segundos).
+ */
+static void CP_registar(const char *nome, const char *referencia, const ListaComparada *esperada, const ListaComparada *obtida, double tempoReferencia, double tempoAlternativa)
+{
+    Comparacao *comparacao = NULL;
+
+    for (int i = 0; i < numComparacoes && comparacao == NULL; i++)
+    {
+        if (strcmp(comparacoes[i].nome, nome) == 0) comparacao = &comparacoes[i];
+    }
+
+    if (comparacao == NULL)
+    {
+        if (numComparacoes == CP_MAX_COMPARACOES) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "registo da comparação");
+        comparacao = &comparacoes[numComparacoes++];
+        *comparacao = (Comparacao){ .nome = nome, .referencia = referencia };
+    }
+
+    (*comparacao).tempoReferencia += tempoReferencia;
+    (*comparacao).tempoAlternativa += tempoAlternativa;
+    (*comparacao).numElementos += (*esperada).quantidade;
+    (*comparacao).numMapas++;
+
+    // Procura a primeira diferença
+    int diferenca = -1;
+    int minimo = ((*esperada).quantidade < (*obtida).quantidade) ? (*esperada).quantidade : (*obtida).quantidade;
+
+    for (int i = 0; i < minimo && diferenca < 0; i++)
+    {
+        if (CP_compararElementos(&(*esperada).elementos[i], &(*obtida).elementos[i]) != 0) diferenca = i;
+    }
+    if (diferenca < 0 && (*esperada).quantidade != (*obtida).quantidade) diferenca = minimo;
+
+    if (diferenca >= 0)
+    {
+        (*comparacao).numFalhas++;
+        printf("❌ %s (mapa %d): diferença no elemento %d: esperado ", nome, mapaAtual, diferenca);
+        CP_escreverElemento(esperada, diferenca);
+        printf(", obtido ");
+        CP_escreverElemento(obtida, diferenca);
+        printf("\n");
+    }
+}
+
+/**
+ * @brief Apresenta os totais de todas as comparações.
+ *
+ * @return Número de comparações com diferenças.
+ */
+static int CP_apresentarRelatorio()
+{
+    int numFalhas = 0;
+
+    printf("\n%-46s %-31s %10s %12s %12s %9s  %s\n", "Implementação", "Referência", "Elementos", "Ref. (ms)", "Alt. (ms)", "Aceler.", "Resultado");
+
+    for (int i = 0; i < numComparacoes; i++)
+    {
+        const Comparacao *comparacao = &comparacoes[i];
+        double aceleracao = ((*comparacao).tempoAlternativa > 0) ? (*comparacao).tempoReferencia / (*comparacao).tempoAlternativa : 0;
+
+        printf("%-44s %-30s %10ld %12.3f %12.3f %8.2fx  ", (*comparacao).nome, (*comparacao).referencia, (*comparacao).numElementos,
+               (*comparacao).tempoReferencia * 1e3, (*comparacao).tempoAlternativa * 1e3, aceleracao);
+
+        if ((*comparacao).numFalhas == 0) printf("✅ %d/%d\n", (*comparacao).numMapas, (*comparacao).numMapas);
+        else printf("❌ %d/%d\n", (*comparacao).numMapas - (*comparacao).numFalhas, (*comparacao).numMapas);
+
+        if ((*comparacao).numFalhas > 0) numFalhas++;
+    }
+
+    return numFalhas;
+}
+
+/*---- Leitura das saídas ----------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Lê as antenas de uma cidade, pela ordem da lista.
+ */
+static void CP_antenasCidade(Grafo *cidade, ListaComparada *lista)
+{
+    (*lista).quantidade = 0;
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) CP_acrescentarAntena(lista, (*antena).frequencia, (*antena).x, (*antena).y);
+}
+
+/**
+ * @brief Lê as antenas de uma rede (em qualquer um dos modos), pela ordem em que estão guardadas.
+ */
+static void CP_antenasRede(Rede *rede, ListaComparada *lista)
+{
+    if ((*rede).cidade != NULL)
+    {
+        CP_antenasCidade((*rede).cidade, lista);
+        return;
+    }
+
+    (*lista).quantidade = 0;
+
+    if ((*rede).vetorial)
+    {
+        for (int i = 0; i < (*rede).numAntenas; i++) CP_acrescentarAntena(lista, (*rede).antenasFrequencia[i], (*rede).antenasX[i], (*rede).antenasY[i]);
+    }
+    else
+    {
+        for (Antena *antena = (*rede).primeiraAntena; antena != NULL; antena = (*antena).prox) CP_acrescentarAntena(lista, (*antena).frequencia, (*antena).x, (*antena).y);
+    }
+}
+
+/**
+ * @brief Lê os efeitos nefastos de uma rede, pela ordem da lista.
+ */
+static void CP_nefastosRede(Rede *rede, ListaComparada *lista)
+{
+    (*lista).quantidade = 0;
+
+    for (Nefasto *nefasto = (*rede).primeiroNefasto; nefasto != NULL; nefasto = (*nefasto).prox) CP_acrescentarAntena(lista, '#', (*nefasto).x, (*nefasto).y);
+}
+
+/**
+ * @brief Lê os efeitos nefastos de um ficheiro CSV ("x,y" por linha), pela ordem do ficheiro.
+ */
+static void CP_nefastosFicheiro(const char *localizacaoFicheiro, ListaComparada *lista)
+{
+    (*lista).quantidade = 0;
+
+    FILE *ficheiro = fopen(localizacaoFicheiro, "r");
+    if (ficheiro == NULL) CP_verificar(LL_ERRO_ABRIR_FICHEIRO, localizacaoFicheiro);
+
+    int x, y;
+    while (fscanf(ficheiro, "%d,%d", &x, &y) == 2) CP_acrescentarAntena(lista, '#', x, y);
+
+    fclose(ficheiro);
+}
+
+/**
+ * @brief Lê todas as arestas de uma cidade, ordenadas por (origem, destino).
+ */
+static void CP_arestasCidade(Grafo *cidade, ListaComparada *lista)
+{
+    (*lista).quantidade = 0;
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox)
+        {
+            Vertice *destino = (*aresta).destino;
+            CP_acrescentar(lista, (RegistoAntena){ (*antena).frequencia, (*antena).x, (*antena).y }, (RegistoAntena){ (*destino).frequencia, (*destino).x, (*destino).y });
+        }
+    }
+
+    qsort((*lista).elementos, (*lista).quantidade, sizeof(ElementoComparado), CP_compararElementos);
+}
+
+/**
+ * @brief Lê as listas de adjacência de uma cidade pela ordem em que estão (saídas e depois entradas de cada antena).
+ *
+ * @note As listas de entrada só existem com "ADJACENCIA_INVERSA" (ver "Aresta").
+ */
+static void CP_adjacenciasCidade(Grafo *cidade, ListaComparada *lista)
+{
+    (*lista).quantidade = 0;
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        RegistoAntena registo = { (*antena).frequencia, (*antena).x, (*antena).y };
+
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox)
+        {
+            Vertice *destino = (*aresta).destino;
+            CP_acrescentar(lista, registo, (RegistoAntena){ (*destino).frequencia, (*destino).x, (*destino).y });
+        }
+
+#ifdef ADJACENCIA_INVERSA
+        for (Aresta *aresta = (*antena).primeiraArestaEntrada; aresta != NULL; aresta = (*aresta).proxEntrada)
+        {
+            Vertice *origem = (*aresta).origem;
+            CP_acrescentar(lista, (RegistoAntena){ (*origem).frequencia, (*origem).x, (*origem).y }, registo);
+        }
+#endif
+    }
+}
+
+/**
+ * @brief Converte a ordem de visita de um grafo compacto numa lista de antenas.
+ */
+static void CP_antenasCompacto(const GrafoCompacto *grafo, const uint32_t *ordem, int quantidade, ListaComparada *lista)
+{
+    (*lista).quantidade = 0;
+
+    for (int i = 0; i < quantidade; i++) CP_acrescentarAntena(lista, (*grafo).frequencias[ordem[i]], GC_coordenadaX(grafo, ordem[i]), GC_coordenadaY(grafo, ordem[i]));
+}
+
+/**
+ * @brief Converte as distâncias de uma procura no grafo compacto numa lista (antena e distância + 1), pela ordem dos identificadores.
+ */
+static void CP_distanciasCompacto(const GrafoCompacto *grafo, const int32_t *distancias, ListaComparada *lista)
+{
+    (*lista).quantidade = 0;
+
+    for (uint32_t v = 0; v < (*grafo).numVertices; v++)
+    {
+        RegistoAntena antena = { (*grafo).frequencias[v], GC_coordenadaX(grafo, v), GC_coordenadaY(grafo, v) };
+        CP_acrescentar(lista, antena, (RegistoAntena){ '\0', distancias[v] + 1, 1 });
+    }
+}
+
+/**
+ * @brief Guarda cada antena de uma saída (procuras em largura e profundidade) na lista do contexto.
+ */
+static int CP_guardarAntena(const Resultado *resultado, void *contexto)
+{
+    CP_acrescentar(contexto, (*resultado).antena, (RegistoAntena){ 0 });
+
+    return 0;
+}
+
+/**
+ * @brief Guarda cada aresta de uma saída ("antena" -> "outra") na lista do contexto.
+ */
+static int CP_guardarAresta(const Resultado *resultado, void *contexto)
+{
+    CP_acrescentar(contexto, (*resultado).antena, (*resultado).outra);
+
+    return 0;
+}
+
+/**
+ * @brief Guarda cada caminho de uma saída na lista do contexto (seguido de um separador '|').
+ */
+static int CP_guardarCaminho(const Resultado *resultado, void *contexto)
+{
+    for (int i = 0; i < (*resultado).tamanho; i++) CP_acrescentar(contexto, (*resultado).caminho[i], (RegistoAntena){ 0 });
+    CP_acrescentarAntena(contexto, '|', 0, 0);
+
+    return 0;
+}
+
+/**
+ * @struct ContextoCaminhoCompacto
+ * @brief Lista e grafo usados para converter os caminhos de "GC_procurarCaminhos".
+ */
+typedef struct ContextoCaminhoCompacto
+{
+    const GrafoCompacto *grafo;
+    ListaComparada *lista;
+
+} ContextoCaminhoCompacto;
+
+/**
+ * @brief Guarda cada caminho de "GC_procurarCaminhos" na lista do contexto (seguido de um separador '|').
+ */
+static int CP_guardarCaminhoCompacto(const uint32_t *caminho, int tamanho, void *contexto)
+{
+    ContextoCaminhoCompacto *caminhos = contexto;
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        uint32_t vertice = caminho[i];
+        CP_acrescentarAntena((*caminhos).lista, (*(*caminhos).grafo).frequencias[vertice], GC_coordenadaX((*caminhos).grafo, vertice), GC_coordenadaY((*caminhos).grafo, vertice));
+    }
+    CP_acrescentarAntena((*caminhos).lista, '|', 0, 0);
+
+    return 0;
+}
+
+/**
+ * @brief Copia os caminhos de uma lista (separados por '|') com até "maxAntenas" antenas, parando ao fim de
+ *        "maxCaminhos" (0 para não limitar).
+ *
+ * @return Número de caminhos copiados.
+ */
+static int CP_filtrarCaminhos(const ListaComparada *caminhos, ListaComparada *lista, int maxAntenas, int maxCaminhos)
+{
+    int numCaminhos = 0, inicio = 0;
+
+    (*lista).quantidade = 0;
+
+    for (int i = 0; i < (*caminhos).quantidade && (maxCaminhos == 0 || numCaminhos < maxCaminhos); i++)
+    {
+        if ((*caminhos).elementos[i].origem.frequencia != '|') continue;
+
+        if (maxAntenas == 0 || i - inicio <= maxAntenas)
+        {
+            for (int j = inicio; j <= i; j++) CP_acrescentar(lista, (*caminhos).elementos[j].origem, (*caminhos).elementos[j].destino);
+            numCaminhos++;
+        }
+        inicio = i + 1;
+    }
+
+    return numCaminhos;
+}
+
+/**
+ * @brief Guarda uma interseção (frequências do par por ordem, ponto médio) na lista do contexto.
+ *
+ * @note Se o ponto não for o ponto médio do par entregue, é guardado com "x" = -1 (a comparação falha).
+ */
+static int CP_guardarIntersecao(const Intersecao *intersecao, void *contexto)
+{
+    Vertice *antena1 = (*intersecao).antena1, *antena2 = (*intersecao).antena2;
+    bool correta = ((*antena1).x + (*antena2).x) / 2 == (*intersecao).x && ((*antena1).y + (*antena2).y) / 2 == (*intersecao).y;
+    char frequencia1 = ((*antena1).frequencia < (*antena2).frequencia) ? (*antena1).frequencia : (*antena2).frequencia;
+    char frequencia2 = ((*antena1).frequencia < (*antena2).frequencia) ? (*antena2).frequencia : (*antena1).frequencia;
+
+    CP_acrescentar(contexto, (RegistoAntena){ frequencia1, correta ? (*intersecao).x : -1, (*intersecao).y }, (RegistoAntena){ frequencia2, 0, 0 });
+
+    return 0;
+}
+
+/**
+ * @brief Guarda uma interseção de um grafo compacto na lista do contexto (como "CP_guardarIntersecao").
+ */
+static int CP_guardarIntersecaoCompacta(uint32_t antena1, uint32_t antena2, int x, int y, void *contexto)
+{
+    const IntersecoesCompactas *intersecoes = contexto;
+    const GrafoCompacto *grafo = (*intersecoes).grafo;
+    int x1 = GC_coordenadaX(grafo, antena1), y1 = GC_coordenadaY(grafo, antena1);
+    int x2 = GC_coordenadaX(grafo, antena2), y2 = GC_coordenadaY(grafo, antena2);
+    bool correta = (x1 + x2) / 2 == x && (y1 + y2) / 2 == y;
+    char frequencia1 = ((*grafo).frequencias[antena1] < (*grafo).frequencias[antena2]) ? (*grafo).frequencias[antena1] : (*grafo).frequencias[antena2];
+    char frequencia2 = ((*grafo).frequencias[antena1] < (*grafo).frequencias[antena2]) ? (*grafo).frequencias[antena2] : (*grafo).frequencias[antena1];
+
+    CP_acrescentar((*intersecoes).lista, (RegistoAntena){ frequencia1, correta ? x : -1, y }, (RegistoAntena){ frequencia2, 0, 0 });
+
+    return 0;
+}
+
+/*---- Mapas aleatórios ------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Gera um mapa aleatório e escreve-o em texto, em RLE e numa lista de coordenadas desordenada.
+ *
+ * Gera também uma cidade pequena ("caminhos", com "CP_ANTENAS_CAMINHOS" antenas) para a procura de caminhos.
+ */
+static void CP_gerarMapa(MapaAleatorio *mapa, const char *pasta, int indice, int largura, int altura)
+{
+    snprintf((*mapa).texto, sizeof((*mapa).texto), "%s/mapa%d.txt", pasta, indice);
+    snprintf((*mapa).rle, sizeof((*mapa).rle), "%s/mapa%d.rle", pasta, indice);
+    snprintf((*mapa).coordenadas, sizeof((*mapa).coordenadas), "%s/mapa%d.csv", pasta, indice);
+    snprintf((*mapa).nefastos, sizeof((*mapa).nefastos), "%s/nefastos%d.csv", pasta, indice);
+    snprintf((*mapa).caminhos, sizeof((*mapa).caminhos), "%s/caminhos%d.txt", pasta, indice);
+
+    (*mapa).largura = largura;
+    (*mapa).altura = altura;
+    (*mapa).numAntenas = 0;
+
+    char *linha = malloc((size_t)largura + 2);
+    RegistoAntena *registos = malloc((size_t)largura * altura * sizeof(RegistoAntena));
+    FILE *texto = fopen((*mapa).texto, "w");
+
+    if (linha == NULL || registos == NULL || texto == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "geração do mapa");
+
+    for (int y = 0; y < altura; y++)
+    {
+        for (int x = 0; x < largura; x++)
+        {
+            linha[x] = '.';
+            if (rand() % 1000 < CP_DENSIDADE)
+            {
+                linha[x] = (char)('A' + rand() % CP_NUM_FREQUENCIAS);
+                registos[(*mapa).numAntenas++] = (RegistoAntena){ linha[x], x, y };
+            }
+        }
+        linha[largura] = '\n';
+        fwrite(linha, 1, (size_t)largura + 1, texto);
+    }
+    fclose(texto);
+
+    // Lista de coordenadas por ordem aleatória (testa a ordenação dos carregamentos)
+    for (int i = (*mapa).numAntenas - 1; i > 0; i--)
+    {
+        int j = rand() % (i + 1);
+        RegistoAntena temp = registos[i];
+        registos[i] = registos[j];
+        registos[j] = temp;
+    }
+
+    FILE *coordenadas = fopen((*mapa).coordenadas, "w");
+    if (coordenadas == NULL) CP_verificar(LL_ERRO_ABRIR_FICHEIRO, (*mapa).coordenadas);
+
+    fprintf(coordenadas, "%s\n", FM_CABECALHO_COORDENADAS);
+    for (int i = 0; i < (*mapa).numAntenas; i++) fprintf(coordenadas, "%c\t%d\t%d\n", registos[i].frequencia, registos[i].x, registos[i].y);
+    fclose(coordenadas);
+
+    CP_verificar(FM_converterTextoRLE((*mapa).texto, (*mapa).rle), "FM_converterTextoRLE");
+
+    // Cidade pequena para os caminhos (grelha de 8 x 8, com poucas frequências)
+    FILE *caminhos = fopen((*mapa).caminhos, "w");
+    if (caminhos == NULL) CP_verificar(LL_ERRO_ABRIR_FICHEIRO, (*mapa).caminhos);
+
+    char grelha[8][8];
+    memset(grelha, '.', sizeof(grelha));
+    for (int colocadas = 0; colocadas < CP_ANTENAS_CAMINHOS; )
+    {
+        int posicao = rand() % 64;
+        if (grelha[posicao / 8][posicao % 8] != '.') continue;
+
+        grelha[posicao / 8][posicao % 8] = (char)('A' + rand() % 3);
+        colocadas++;
+    }
+    for (int y = 0; y < 8; y++) fprintf(caminhos, "%.8s\n", grelha[y]);
+    fclose(caminhos);
+
+    free(registos);
+    free(linha);
+}
+
+/**
+ * @brief Apaga os ficheiros de um mapa aleatório.
+ */
+static void CP_apagarMapa(const MapaAleatorio *mapa)
+{
+    remove((*mapa).texto);
+    remove((*mapa).rle);
+    remove((*mapa).coordenadas);
+    remove((*mapa).nefastos);
+    remove((*mapa).caminhos);
+}
+
+/*---- Comparações -----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Compara os carregamentos da cidade ("carregarCidade") e da rede ("LL_carregarAntenas").
+ */
+static void CP_compararCarregamentos(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    double inicio, tempoReferencia;
+
+    // Cidade
+    Grafo *referencia = criarCidade();
+    inicio = CP_agora();
+    CP_verificar(carregarCidade(referencia, (*mapa).texto), "carregarCidade");
+    tempoReferencia = CP_agora() - inicio;
+    CP_antenasCidade(referencia, esperada);
+    referencia = libertarCidade(referencia);
+
+    Grafo *cidade = criarCidade();
+    inicio = CP_agora();
+    CP_verificar(FM_carregarCidadeRLE(cidade, (*mapa).rle), "FM_carregarCidadeRLE");
+    double tempo = CP_agora() - inicio;
+    CP_antenasCidade(cidade, obtida);
+    CP_registar("FM_carregarCidadeRLE", "carregarCidade", esperada, obtida, tempoReferencia, tempo);
+    cidade = libertarCidade(cidade);
+
+    // Cidade que já tem uma das antenas do mapa (a do meio da lista): o resultado tem de ser o mesmo
+    cidade = criarCidade();
+    if ((*esperada).quantidade > 0)
+    {
+        RegistoAntena registo = (*esperada).elementos[(*esperada).quantidade / 2].origem;
+        CP_verificar(adicionarAntenaOrdenada(cidade, &registo.frequencia, registo.x, registo.y), "adicionarAntenaOrdenada");
+    }
+    inicio = CP_agora();
+    CP_verificar(FM_carregarCidadeRLE(cidade, (*mapa).rle), "FM_carregarCidadeRLE");
+    tempo = CP_agora() - inicio;
+    CP_antenasCidade(cidade, obtida);
+    CP_registar("FM_carregarCidadeRLE (cidade com antenas)", "carregarCidade", esperada, obtida, tempoReferencia, tempo);
+    cidade = libertarCidade(cidade);
+
+    cidade = criarCidade();
+    inicio = CP_agora();
+    CP_verificar(FM_carregarCidadeCoordenadas(cidade, (*mapa).coordenadas, NULL), "FM_carregarCidadeCoordenadas");
+    tempo = CP_agora() - inicio;
+    CP_antenasCidade(cidade, obtida);
+    CP_registar("FM_carregarCidadeCoordenadas", "carregarCidade", esperada, obtida, tempoReferencia, tempo);
+    cidade = libertarCidade(cidade);
+
+    // Rede (lista ligada como referência)
+    Rede *rede = LL_criarRede();
+    inicio = CP_agora();
+    CP_verificar(LL_carregarAntenas(rede, (*mapa).texto), "LL_carregarAntenas");
+    tempoReferencia = CP_agora() - inicio;
+    CP_antenasRede(rede, esperada);
+    rede = LL_libertarRede(rede);
+
+    for (int modo = 0; modo < 3; modo++)
+    {
+        const char *nomes[3][3] =
+        {
+            { "LL_carregarAntenas (vetorial)", "FM_carregarAntenasRLE (vetorial)", "FM_carregarAntenasCoordenadas (vetorial)" },
+            { "LL_carregarAntenas (partilhada)", "FM_carregarAntenasRLE (partilhada)", "FM_carregarAntenasCoordenadas (partilhada)" },
+            { NULL, "FM_carregarAntenasRLE", "FM_carregarAntenasCoordenadas" }
+        };
+
+        for (int carregamento = 0; carregamento < 3; carregamento++)
+        {
+            if (nomes[modo][carregamento] == NULL) continue;
+
+            Grafo *partilhada = (modo == 1) ? criarCidade() : NULL;
+            rede = (modo == 0) ? LL_criarRedeVetorial() : (modo == 1) ? LL_criarRedePartilhada(partilhada) : LL_criarRede();
+
+            inicio = CP_agora();
+            if (carregamento == 0) CP_verificar(LL_carregarAntenas(rede, (*mapa).texto), nomes[modo][carregamento]);
+            else if (carregamento == 1) CP_verificar(FM_carregarAntenasRLE(rede, (*mapa).rle), nomes[modo][carregamento]);
+            else CP_verificar(FM_carregarAntenasCoordenadas(rede, (*mapa).coordenadas, NULL), nomes[modo][carregamento]);
+            tempo = CP_agora() - inicio;
+
+            CP_antenasRede(rede, obtida);
+            CP_registar(nomes[modo][carregamento], "LL_carregarAntenas", esperada, obtida, tempoReferencia, tempo);
+
+            rede = LL_libertarRede(rede);
+            partilhada = libertarCidade(partilhada);
+        }
+    }
+}
+
+/**
+ * @brief Compara o cálculo dos efeitos nefastos (com e sem o limite do mapa) nos vários modos da rede e em disco.
+ */
+static void CP_compararNefastos(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    for (int limitarMapa = 0; limitarMapa <= 1; limitarMapa++)
+    {
+        const char *nomeReferencia = limitarMapa ? "LL_calcularNefastosMapa" : "LL_calcularNefastos";
+
+        Rede *referencia = LL_criarRede();
+        CP_verificar(LL_carregarAntenas(referencia, (*mapa).texto), "LL_carregarAntenas");
+
+        double inicio = CP_agora();
+        CP_verificar(limitarMapa ? LL_calcularNefastosMapa(referencia) : LL_calcularNefastos(referencia, true), nomeReferencia);
+        double tempoReferencia = CP_agora() - inicio;
+
+        CP_nefastosRede(referencia, esperada);
+        referencia = LL_libertarRede(referencia);
+
+        // Redes vetorial e partilhada
+        for (int modo = 0; modo < 2; modo++)
+        {
+            const char *nomes[2][2] =
+            {
+                { "LL_calcularNefastos (vetorial)", "LL_calcularNefastos (partilhada)" },
+                { "LL_calcularNefastosMapa (vetorial)", "LL_calcularNefastosMapa (partilhada)" }
+            };
+
+            Grafo *partilhada = (modo == 1) ? criarCidade() : NULL;
+            Rede *rede = (modo == 0) ? LL_criarRedeVetorial() : LL_criarRedePartilhada(partilhada);
+            CP_verificar(LL_carregarAntenas(rede, (*mapa).texto), "LL_carregarAntenas");
+
+            inicio = CP_agora();
+            CP_verificar(limitarMapa ? LL_calcularNefastosMapa(rede) : LL_calcularNefastos(rede, true), nomes[limitarMapa][modo]);
+            double tempo = CP_agora() - inicio;
+
+            CP_nefastosRede(rede, obtida);
+            CP_registar(nomes[limitarMapa][modo], nomeReferencia, esperada, obtida, tempoReferencia, tempo);
+
+            rede = LL_libertarRede(rede);
+            partilhada = libertarCidade(partilhada);
+        }
+
+        // Em disco (a referência inclui o carregamento, tal como "NE_calcularNefastosFicheiro" inclui a leitura do mapa)
+        if (limitarMapa)
+        {
+            double inicioDisco = CP_agora();
+            CP_verificar(NE_calcularNefastosFicheiro((*mapa).texto, (*mapa).nefastos, true, NULL), "NE_calcularNefastosFicheiro");
+            double tempo = CP_agora() - inicioDisco;
+
+            referencia = LL_criarRede();
+            inicio = CP_agora();
+            CP_verificar(LL_carregarAntenas(referencia, (*mapa).texto), "LL_carregarAntenas");
+            CP_verificar(LL_calcularNefastosMapa(referencia), nomeReferencia);
+            tempoReferencia = CP_agora() - inicio;
+            referencia = LL_libertarRede(referencia);
+
+            CP_nefastosFicheiro((*mapa).nefastos, obtida);
+            CP_registar("NE_calcularNefastosFicheiro", "LL_carregarAntenas + ...Mapa", esperada, obtida, tempoReferencia, tempo);
+        }
+    }
+}
+
+/**
+ * @brief Prepara uma cidade para a interligação (0: sem arestas, 1: ligada por frequências iguais, 2: com arestas pendentes).
+ */
+static Grafo *CP_prepararCidade(const MapaAleatorio *mapa, int preparacao)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+
+    if (preparacao == 1) CP_verificar(interligarAntenasGenerica(cidade, true, false, false), "interligarAntenasGenerica");
+    if (preparacao == 2) CP_verificar(interligarAntenasPendente(cidade), "interligarAntenasPendente");
+
+    return cidade;
+}
+
+/**
+ * @brief Compara um critério de "interligarAntenas" (núcleo especializado) com "interligarAntenasGenerica".
+ *
+ * As listas de adjacência são comparadas pela ordem exata (saídas e entradas de cada antena), que
+ * determina a ordem pela qual as procuras apresentam as antenas.
+ */
+static void CP_compararNucleo(const MapaAleatorio *mapa, const char *nome, int preparacao, bool iguais, bool diferentes, bool verificar, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *referencia = CP_prepararCidade(mapa, preparacao);
+
+    double inicio = CP_agora();
+    CP_verificar(interligarAntenasGenerica(referencia, iguais, diferentes, verificar), "interligarAntenasGenerica");
+    double tempoReferencia = CP_agora() - inicio;
+
+    CP_verificar(materializarTodasArestas(referencia), "materializarTodasArestas");
+    CP_adjacenciasCidade(referencia, esperada);
+    referencia = libertarCidade(referencia);
+
+    Grafo *cidade = CP_prepararCidade(mapa, preparacao);
+
+    inicio = CP_agora();
+    CP_verificar(interligarAntenas(cidade, iguais, diferentes, verificar), "interligarAntenas");
+    double tempo = CP_agora() - inicio;
+
+    CP_verificar(materializarTodasArestas(cidade), "materializarTodasArestas");
+    CP_adjacenciasCidade(cidade, obtida);
+    CP_registar(nome, "interligarAntenasGenerica", esperada, obtida, tempoReferencia, tempo);
+    cidade = libertarCidade(cidade);
+}
+
+/**
+ * @brief Compara os núcleos de "interligarAntenas" e a interligação diferida ("interligarAntenasPendente")
+ *        com a interligação genérica.
+ */
+static void CP_compararInterligacoes(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    CP_compararNucleo(mapa, "interligarAntenas (iguais)", 0, true, false, false, esperada, obtida);
+    CP_compararNucleo(mapa, "interligarAntenas (diferentes)", 0, false, true, false, esperada, obtida);
+    CP_compararNucleo(mapa, "interligarAntenas (todas)", 0, true, true, false, esperada, obtida);
+    CP_compararNucleo(mapa, "interligarAntenas (todas, verificar)", 1, true, true, true, esperada, obtida);
+    CP_compararNucleo(mapa, "interligarAntenas (diferentes, verificar)", 2, false, true, true, esperada, obtida);
+
+    Grafo *referencia = criarCidade();
+    CP_verificar(carregarCidade(referencia, (*mapa).texto), "carregarCidade");
+
+    double inicio = CP_agora();
+    CP_verificar(interligarAntenasGenerica(referencia, true, false, false), "interligarAntenasGenerica");
+    double tempoReferencia = CP_agora() - inicio;
+
+    CP_arestasCidade(referencia, esperada);
+    referencia = libertarCidade(referencia);
+
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+
+    inicio = CP_agora();
+    CP_verificar(interligarAntenasPendente(cidade), "interligarAntenasPendente");
+    CP_verificar(materializarTodasArestas(cidade), "materializarTodasArestas");
+    double tempo = CP_agora() - inicio;
+
+    CP_arestasCidade(cidade, obtida);
+    CP_registar("interligarAntenasPendente + materializar", "interligarAntenasGenerica", esperada, obtida, tempoReferencia, tempo);
+    cidade = libertarCidade(cidade);
+}
+
+/**
+ * @brief Compara a ordem das procuras (profundidade, largura e caminhos) depois de "interligarAntenas" com a
+ *        ordem depois da interligação genérica (frequências iguais).
+ *
+ * As procuras em profundidade e em largura partem da primeira antena de cada frequência do mapa. Os caminhos
+ * são procurados numa cidade pequena, com as frequências diferentes também ligadas (por raio) nos dois casos.
+ */
+static void CP_compararOrdemProcuras(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    ListaComparada *listas[2] = { esperada, obtida };
+    double tempos[2] = { 0, 0 };
+
+    for (int lado = 0; lado < 2; lado++)
+    {
+        ListaComparada *lista = listas[lado];
+        (*lista).quantidade = 0;
+
+        Saida *antenas = criarSaidaFuncao(CP_guardarAntena, lista);
+        Saida *caminhos = criarSaidaFuncao(CP_guardarCaminho, lista);
+        if (antenas == NULL || caminhos == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "criarSaidaFuncao");
+
+        const char *ficheiros[2] = { (*mapa).texto, (*mapa).caminhos };
+
+        for (int f = 0; f < 2; f++)
+        {
+            Grafo *cidade = criarCidade();
+            CP_verificar(carregarCidade(cidade, ficheiros[f]), "carregarCidade");
+
+            double inicio = CP_agora();
+            if (lado == 0) CP_verificar(interligarAntenasGenerica(cidade, true, false, false), "interligarAntenasGenerica");
+            else CP_verificar(interligarAntenas(cidade, true, false, false), "interligarAntenas");
+            tempos[lado] += CP_agora() - inicio;
+
+            if (f == 0)
+            {
+                for (int frequencia = 0; frequencia < NUM_FREQUENCIAS; frequencia++)
+                {
+                    Vertice *inicioProcura = (*cidade).primeiraAntenaFrequencia[frequencia];
+                    if (inicioProcura == NULL) continue;
+
+                    CP_verificar(procurarProfundidade(inicioProcura, antenas), "procurarProfundidade");
+                    resetVisitados(cidade);
+                    CP_verificar(procurarLargura(inicioProcura, (*cidade).numAntenas, antenas), "procurarLargura");
+                    resetVisitados(cidade);
+                }
+            }
+            else if ((*cidade).primeiraAntena != NULL)
+            {
+                CP_verificar(interligarAntenasRaio(cidade, false, true, false, 4, 0), "interligarAntenasRaio");
+
+                Vertice *origem = (*cidade).primeiraAntena, *destino = origem;
+                while ((*destino).prox != NULL) destino = (*destino).prox;
+
+                CP_verificar(procurarCaminhos(origem, destino, (*cidade).numAntenas, caminhos), "procurarCaminhos");
+                resetVisitados(cidade);
+            }
+
+            libertarCidade(cidade);
+        }
+
+        libertarSaida(caminhos);
+        libertarSaida(antenas);
+    }
+
+    CP_registar("interligarAntenas (ordem das procuras)", "interligarAntenasGenerica", esperada, obtida, tempos[0], tempos[1]);
+}
+
+/**
+ * @brief Compara as arestas que restam depois de "removerAntena" com as arestas anteriores sem as antenas removidas,
+ *        e as arestas de entrada de cada antena ("listarArestasEntradaAntena") com as listas de saída.
+ *
+ * A cidade é ligada às antenas mais próximas (arestas num só sentido) e às antenas com a mesma frequência, para
+ * que haja antenas com tabela de dispersão. É removida uma em cada três antenas da lista.
+ *
+ * No fim, todas as arestas são removidas ("removerAresta") e voltam a ser acrescentadas pela ordem inversa: as
+ * listas de saída têm de ficar iguais e as arestas libertadas têm de chegar, sem blocos novos.
+ */
+static void CP_compararRemocoes(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+    CP_verificar(interligarAntenasRaio(cidade, true, true, false, CP_RAIO, CP_MAX_VIZINHOS), "interligarAntenasRaio");
+    CP_verificar(interligarAntenas(cidade, true, false, true), "interligarAntenas");
+
+    RegistoAntena *removidas = malloc(((*cidade).numAntenas + 1) * sizeof(RegistoAntena));
+    if (removidas == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "remoções");
+
+    // Referência: as arestas atuais sem as que tocam numa antena a remover (marcada como visitada)
+    double inicio = CP_agora();
+    int numRemovidas = 0, posicao = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox, posicao++)
+    {
+        if (posicao % 3 != 0) continue;
+
+        (*antena).visitada = true;
+        removidas[numRemovidas++] = (RegistoAntena){ (*antena).frequencia, (*antena).x, (*antena).y };
+    }
+
+    (*esperada).quantidade = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox)
+        {
+            Vertice *destino = (*aresta).destino;
+            if ((*antena).visitada || (*destino).visitada) continue;
+
+            CP_acrescentar(esperada, (RegistoAntena){ (*antena).frequencia, (*antena).x, (*antena).y }, (RegistoAntena){ (*destino).frequencia, (*destino).x, (*destino).y });
+        }
+    }
+    qsort((*esperada).elementos, (*esperada).quantidade, sizeof(ElementoComparado), CP_compararElementos);
+    double tempoReferencia = CP_agora() - inicio;
+
+    inicio = CP_agora();
+    for (int i = 0; i < numRemovidas; i++)
+    {
+        char frequencia;
+        CP_verificar(removerAntena(cidade, &frequencia, removidas[i].x, removidas[i].y), "removerAntena");
+    }
+    double tempo = CP_agora() - inicio;
+
+    CP_arestasCidade(cidade, obtida);
+    CP_registar("removerAntena (arestas restantes)", "arestas anteriores", esperada, obtida, tempoReferencia, tempo);
+
+    // Arestas de entrada: o mesmo conjunto de arestas, obtido pelos destinos
+    Saida *saida = criarSaidaFuncao(CP_guardarAresta, obtida);
+    if (saida == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "criarSaidaFuncao");
+
+    inicio = CP_agora();
+    CP_arestasCidade(cidade, esperada);
+    tempoReferencia = CP_agora() - inicio;
+
+    (*obtida).quantidade = 0;
+    inicio = CP_agora();
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        CP_verificar(listarArestasEntradaAntena(antena, saida), "listarArestasEntradaAntena");
+    }
+    tempo = CP_agora() - inicio;
+
+    qsort((*obtida).elementos, (*obtida).quantidade, sizeof(ElementoComparado), CP_compararElementos);
+    CP_registar("listarArestasEntradaAntena", "listas de saida", esperada, obtida, tempoReferencia, tempo);
+
+    // Reutilização das arestas: as listas de saída (pela ordem) e o número de blocos antes e depois
+    int numArestas = 0, numBlocos = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) numArestas += (*antena).numArestas;
+    for (BlocoArestas *bloco = (*cidade).blocosArestas; bloco != NULL; bloco = (*bloco).prox) numBlocos++;
+
+    Vertice **pares = malloc(((size_t)numArestas * 2 + 1) * sizeof(Vertice *));
+    if (pares == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "reutilização das arestas");
+
+    inicio = CP_agora();
+    int numPares = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox)
+        {
+            pares[numPares++] = antena;
+            pares[numPares++] = (*aresta).destino;
+        }
+    }
+    tempoReferencia = CP_agora() - inicio;
+
+    (*esperada).quantidade = 0;
+    for (int i = 0; i < numPares; i += 2)
+    {
+        CP_acrescentar(esperada, (RegistoAntena){ (*pares[i]).frequencia, (*pares[i]).x, (*pares[i]).y }, (RegistoAntena){ (*pares[i + 1]).frequencia, (*pares[i + 1]).x, (*pares[i + 1]).y });
+    }
+    CP_acrescentarAntena(esperada, '#', numBlocos, 0);
+
+    inicio = CP_agora();
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        while ((*antena).primeiraAresta != NULL) CP_verificar(removerAresta(antena, (*(*antena).primeiraAresta).destino), "removerAresta");
+    }
+    for (int i = numPares - 2; i >= 0; i -= 2) CP_verificar(adicionarAresta(pares[i], pares[i + 1], false), "adicionarAresta");
+    tempo = CP_agora() - inicio;
+
+    (*obtida).quantidade = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox)
+        {
+            Vertice *destino = (*aresta).destino;
+            CP_acrescentar(obtida, (RegistoAntena){ (*antena).frequencia, (*antena).x, (*antena).y }, (RegistoAntena){ (*destino).frequencia, (*destino).x, (*destino).y });
+        }
+    }
+
+    numBlocos = 0;
+    for (BlocoArestas *bloco = (*cidade).blocosArestas; bloco != NULL; bloco = (*bloco).prox) numBlocos++;
+    CP_acrescentarAntena(obtida, '#', numBlocos, 0);
+    CP_registar("removerAresta + adicionarAresta (reserva)", "listas de saida e blocos", esperada, obtida, tempoReferencia, tempo);
+
+    free(pares);
+    libertarSaida(saida);
+    free(removidas);
+    libertarCidade(cidade);
+}
+
+/**
+ * @brief Compara dois elementos de uma consulta dos mais próximos pela distância (em "destino.x") e, depois, pela antena.
+ */
+static int CP_compararDistancias(const void *a, const void *b)
+{
+    const ElementoComparado *elementoA = a, *elementoB = b;
+
+    if ((*elementoA).destino.x != (*elementoB).destino.x) return ((*elementoA).destino.x < (*elementoB).destino.x) ? -1 : 1;
+
+    return CP_compararRegistos(&(*elementoA).origem, &(*elementoB).origem);
+}
+
+/**
+ * @brief Acrescenta à lista o resultado de uma consulta espacial (antenas ou nefastos) e um separador.
+ *
+ * As antenas de cada consulta são ordenadas (por posição, ou pela distância nas consultas dos mais próximos),
+ * porque a ordem da grelha e a da lista são diferentes. Nas consultas dos mais próximos, as antenas à maior
+ * distância são substituídas por '=' (em caso de empate, qualquer uma delas pode ser escolhida).
+ */
+static void CP_acrescentarConsulta(ListaComparada *lista, int inicio, int tipo, int consulta)
+{
+    int quantidade = (*lista).quantidade - inicio;
+    ElementoComparado *elementos = &(*lista).elementos[inicio];
+
+    qsort(elementos, quantidade, sizeof(ElementoComparado), (tipo == 2) ? CP_compararDistancias : CP_compararElementos);
+
+    for (int i = quantidade - 1; tipo == 2 && i >= 0 && elementos[i].destino.x == elementos[quantidade - 1].destino.x; i--)
+    {
+        elementos[i].origem = (RegistoAntena){ '=', 0, 0 };
+    }
+
+    CP_acrescentar(lista, (RegistoAntena){ '|', consulta, tipo }, (RegistoAntena){ 0 });
+}
+
+/**
+ * @brief Verifica se um ponto satisfaz uma consulta espacial (0: raio, 1: retângulo) com os parâmetros "p".
+ */
+static bool CP_dentroConsulta(int tipo, const int *p, int x, int y)
+{
+    if (tipo == 0) return (int64_t)(x - p[0]) * (x - p[0]) + (int64_t)(y - p[1]) * (y - p[1]) <= (int64_t)p[2] * p[2];
+
+    return x >= p[0] && x <= p[2] && y >= p[1] && y <= p[3];
+}
+
+/**
+ * @brief Responde a uma consulta espacial percorrendo todos os pontos (força bruta).
+ *
+ * @note "p" tem o centro e o raio (tipo 0), os limites (tipo 1) ou o ponto e "k" (tipo 2).
+ */
+static void CP_consultarForcaBruta(const RegistoAntena *pontos, int numPontos, int tipo, const int *p, int consulta, ListaComparada *lista)
+{
+    int inicio = (*lista).quantidade;
+
+    for (int i = 0; i < numPontos; i++)
+    {
+        RegistoAntena ponto = pontos[i];
+        int distancia = (ponto.x - p[0]) * (ponto.x - p[0]) + (ponto.y - p[1]) * (ponto.y - p[1]);
+
+        if (tipo == 2) CP_acrescentar(lista, ponto, (RegistoAntena){ '\0', distancia, 1 });
+        else if (CP_dentroConsulta(tipo, p, ponto.x, ponto.y)) CP_acrescentar(lista, ponto, (RegistoAntena){ 0 });
+    }
+
+    // Mais próximos: fica apenas com os "k" primeiros por distância
+    if (tipo == 2)
+    {
+        qsort(&(*lista).elementos[inicio], numPontos, sizeof(ElementoComparado), CP_compararDistancias);
+        if (numPontos > p[2]) (*lista).quantidade = inicio + p[2];
+    }
+
+    CP_acrescentarConsulta(lista, inicio, tipo, consulta);
+}
+
+/**
+ * @brief Compara as consultas espaciais com índice (da cidade e dos nefastos) com uma procura por força bruta.
+ *
+ * O índice da cidade é criado antes de inserir e remover antenas ao acaso, para verificar também a
+ * manutenção do índice. São feitas "CP_NUM_CONSULTAS" consultas de cada tipo, com centros (ou retângulos)
+ * que podem sair do mapa.
+ */
+static void CP_compararConsultasEspaciais(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+    CP_verificar(criarIndiceCidade(cidade, 0), "criarIndiceCidade");
+
+    for (int i = 0; i < CP_ALTERACOES_INDICE; i++)
+    {
+        char frequencia = (char)('A' + rand() % CP_NUM_FREQUENCIAS);
+        int x = rand() % (*mapa).largura, y = rand() % (*mapa).altura;
+
+        int resultado = (i % 2 == 0) ? adicionarAntenaOrdenada(cidade, &frequencia, x, y) : removerAntena(cidade, &frequencia, x, y);
+        if (resultado != ERRO_ANTENA_JA_EXISTE && resultado != ERRO_ANTENA_NAO_EXISTE) CP_verificar(resultado, "adicionarAntenaOrdenada/removerAntena");
+    }
+
+    Rede *rede = LL_criarRede();
+    CP_verificar(LL_carregarAntenas(rede, (*mapa).texto), "LL_carregarAntenas");
+    CP_verificar(LL_calcularNefastos(rede, true), "LL_calcularNefastos");
+    CP_verificar(LL_criarIndiceNefastos(rede, 0), "LL_criarIndiceNefastos");
+
+    // Pontos de cada estrutura (para a força bruta) e vetores de resultados
+    int numPontos[2] = { (*cidade).numAntenas, (*rede).numNefastos };
+    RegistoAntena *pontos[2] = { malloc((numPontos[0] + 1) * sizeof(RegistoAntena)), malloc((numPontos[1] + 1) * sizeof(RegistoAntena)) };
+    Vertice **antenas = malloc((numPontos[0] + CP_MAX_PROXIMOS) * sizeof(Vertice *)); /* Pelo menos "k" posições */
+    Nefasto **nefastos = malloc((numPontos[1] + CP_MAX_PROXIMOS) * sizeof(Nefasto *));
+
+    if (pontos[0] == NULL || pontos[1] == NULL || antenas == NULL || nefastos == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "consultas espaciais");
+
+    int n = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) pontos[0][n++] = (RegistoAntena){ (*antena).frequencia, (*antena).x, (*antena).y };
+    n = 0;
+    for (Nefasto *nefasto = (*rede).primeiroNefasto; nefasto != NULL; nefasto = (*nefasto).prox) pontos[1][n++] = (RegistoAntena){ '#', (*nefasto).x, (*nefasto).y };
+
+    const char *nomes[2][3] =
+    {
+        { "procurarAntenasRaio (grelha)", "procurarAntenasRetangulo (grelha)", "procurarAntenasProximas (grelha)" },
+        { "LL_procurarNefastosRaio (grelha)", "LL_procurarNefastosRetangulo (grelha)", "LL_procurarNefastosProximos (grelha)" }
+    };
+
+    for (int estrutura = 0; estrutura < 2; estrutura++)
+    {
+        for (int tipo = 0; tipo < 3; tipo++)
+        {
+            // Parâmetros das consultas (centro, raio/limites/k), com margem à volta do mapa
+            int (*parametros)[4] = malloc(CP_NUM_CONSULTAS * sizeof(int[4]));
+            if (parametros == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "consultas espaciais");
+
+            for (int c = 0; c < CP_NUM_CONSULTAS; c++)
+            {
+                parametros[c][0] = rand() % ((*mapa).largura + 20) - 10;
+                parametros[c][1] = rand() % ((*mapa).altura + 20) - 10;
+                parametros[c][2] = (tipo == 0) ? rand() % 20 : (tipo == 1) ? parametros[c][0] + rand() % 30 : 1 + rand() % CP_MAX_PROXIMOS;
+                parametros[c][3] = parametros[c][1] + rand() % 30;
+            }
+
+            (*esperada).quantidade = 0;
+            double inicio = CP_agora();
+            for (int c = 0; c < CP_NUM_CONSULTAS; c++) CP_consultarForcaBruta(pontos[estrutura], numPontos[estrutura], tipo, parametros[c], c, esperada);
+            double tempoReferencia = CP_agora() - inicio;
+
+            (*obtida).quantidade = 0;
+            double tempo = 0;
+            for (int c = 0; c < CP_NUM_CONSULTAS; c++)
+            {
+                const int *p = parametros[c];
+                int encontrados = 0;
+
+                inicio = CP_agora();
+                if (estrutura == 0)
+                {
+                    if (tipo == 0) encontrados = procurarAntenasRaio(cidade, p[0], p[1], p[2], antenas, numPontos[0]);
+                    else if (tipo == 1) encontrados = procurarAntenasRetangulo(cidade, p[0], p[1], p[2], p[3], antenas, numPontos[0]);
+                    else encontrados = procurarAntenasProximas(cidade, p[0], p[1], p[2], antenas);
+                }
+                else
+                {
+                    if (tipo == 0) encontrados = LL_procurarNefastosRaio(rede, p[0], p[1], p[2], nefastos, numPontos[1]);
+                    else if (tipo == 1) encontrados = LL_procurarNefastosRetangulo(rede, p[0], p[1], p[2], p[3], nefastos, numPontos[1]);
+                    else encontrados = LL_procurarNefastosProximos(rede, p[0], p[1], p[2], nefastos);
+                }
+                tempo += CP_agora() - inicio;
+                CP_verificar(encontrados, nomes[estrutura][tipo]);
+
+                int inicioConsulta = (*obtida).quantidade;
+                for (int i = 0; i < encontrados; i++)
+                {
+                    RegistoAntena ponto = (estrutura == 0) ? (RegistoAntena){ (*antenas[i]).frequencia, (*antenas[i]).x, (*antenas[i]).y } : (RegistoAntena){ '#', (*nefastos[i]).x, (*nefastos[i]).y };
+                    int distancia = (ponto.x - p[0]) * (ponto.x - p[0]) + (ponto.y - p[1]) * (ponto.y - p[1]);
+
+                    CP_acrescentar(obtida, ponto, (tipo == 2) ? (RegistoAntena){ '\0', distancia, 1 } : (RegistoAntena){ 0 });
+                }
+                CP_acrescentarConsulta(obtida, inicioConsulta, tipo, c);
+            }
+
+            CP_registar(nomes[estrutura][tipo], "percurso da lista", esperada, obtida, tempoReferencia, tempo);
+            free(parametros);
+        }
+    }
+
+    free(nefastos);
+    free(antenas);
+    free(pontos[1]);
+    free(pontos[0]);
+    LL_libertarRede(rede);
+    libertarCidade(cidade);
+}
+
+/**
+ * @brief Interliga as antenas por raio comparando todos os pares (força bruta) e devolve as arestas resultantes, ordenadas.
+ *
+ * As arestas que a cidade já tem são mantidas. Com "maxVizinhos" > 0, cada antena só fica ligada às
+ * "maxVizinhos" antenas mais próximas (empates pela ordem (y, x)); caso contrário, a lista de cada antena
+ * inclui todas as antenas dentro do raio, pelo que cada par fica com as arestas nos dois sentidos.
+ */
+static void CP_interligarRaioForcaBruta(Grafo *cidade, bool iguais, bool diferentes, bool verificar, int raio, int maxVizinhos, ListaComparada *lista)
+{
+    CP_arestasCidade(cidade, lista);
+
+    ListaComparada candidatos = { 0 };
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        RegistoAntena origem = { (*antena).frequencia, (*antena).x, (*antena).y };
+        candidatos.quantidade = 0;
+
+        for (Vertice *outra = (*cidade).primeiraAntena; outra != NULL; outra = (*outra).prox)
+        {
+            if (outra == antena) continue;
+            if ((*outra).frequencia == (*antena).frequencia ? !iguais : !diferentes) continue;
+
+            int distancia = ((*outra).x - (*antena).x) * ((*outra).x - (*antena).x) + ((*outra).y - (*antena).y) * ((*outra).y - (*antena).y);
+            if (distancia <= raio * raio) CP_acrescentar(&candidatos, (RegistoAntena){ (*outra).frequencia, (*outra).x, (*outra).y }, (RegistoAntena){ '\0', distancia, 1 });
+        }
+
+        // Mais próximos: ordena por distância e, em empate, pela ordem (y, x)
+        if (maxVizinhos > 0 && candidatos.quantidade > maxVizinhos)
+        {
+            qsort(candidatos.elementos, candidatos.quantidade, sizeof(ElementoComparado), CP_compararDistancias);
+            candidatos.quantidade = maxVizinhos;
+        }
+
+        for (int i = 0; i < candidatos.quantidade; i++)
+        {
+            RegistoAntena destino = candidatos.elementos[i].origem;
+            bool repetida = false;
+
+            for (Aresta *aresta = (*antena).primeiraAresta; verificar && aresta != NULL && !repetida; aresta = (*aresta).prox)
+            {
+                repetida = ((*(*aresta).destino).x == destino.x && (*(*aresta).destino).y == destino.y);
+            }
+
+            if (!repetida) CP_acrescentar(lista, origem, destino);
+        }
+    }
+
+    free(candidatos.elementos);
+    qsort((*lista).elementos, (*lista).quantidade, sizeof(ElementoComparado), CP_compararElementos);
+}
+
+/**
+ * @brief Compara um critério de "interligarAntenasRaio" (grelha espacial) com a comparação de todos os pares.
+ */
+static void CP_compararRaio(const MapaAleatorio *mapa, const char *nome, int preparacao, bool iguais, bool diferentes, bool verificar, int maxVizinhos, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *referencia = CP_prepararCidade(mapa, preparacao);
+
+    double inicio = CP_agora();
+    CP_interligarRaioForcaBruta(referencia, iguais, diferentes, verificar, CP_RAIO, maxVizinhos, esperada);
+    double tempoReferencia = CP_agora() - inicio;
+
+    referencia = libertarCidade(referencia);
+
+    Grafo *cidade = CP_prepararCidade(mapa, preparacao);
+
+    inicio = CP_agora();
+    CP_verificar(interligarAntenasRaio(cidade, iguais, diferentes, verificar, CP_RAIO, maxVizinhos), "interligarAntenasRaio");
+    double tempo = CP_agora() - inicio;
+
+    CP_arestasCidade(cidade, obtida);
+    CP_registar(nome, "todos os pares", esperada, obtida, tempoReferencia, tempo);
+    cidade = libertarCidade(cidade);
+}
+
+/**
+ * @brief Compara a interligação por raio com a força bruta, com e sem limite de vizinhos e com arestas já existentes.
+ *
+ * Nas variantes com "verificar", a cidade já tem as antenas com a mesma frequência interligadas, pelo que
+ * as arestas dentro do raio entre essas antenas não podem ser repetidas.
+ */
+static void CP_compararInterligacoesRaio(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    CP_compararRaio(mapa, "interligarAntenasRaio (todas)", 0, true, true, false, 0, esperada, obtida);
+    CP_compararRaio(mapa, "interligarAntenasRaio (diferentes, k)", 0, false, true, false, CP_MAX_VIZINHOS, esperada, obtida);
+    CP_compararRaio(mapa, "interligarAntenasRaio (todas, verificar)", 1, true, true, true, 0, esperada, obtida);
+    CP_compararRaio(mapa, "interligarAntenasRaio (todas, k, verificar)", 1, true, true, true, CP_MAX_VIZINHOS, esperada, obtida);
+    CP_compararRaio(mapa, "interligarAntenasRaio (iguais, k, repetidas)", 1, true, false, false, CP_MAX_VIZINHOS, esperada, obtida);
+}
+
+/**
+ * @brief Compara as procuras em largura e em profundidade com as do grafo compacto (sequencial e paralela).
+ *
+ * A cidade é ligada por raio (todas as frequências), para que as procuras alcancem boa parte do mapa.
+ */
+static void CP_compararProcuras(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+    CP_verificar(interligarAntenasRaio(cidade, true, true, false, CP_RAIO, 0), "interligarAntenasRaio");
+
+    if ((*cidade).numAntenas == 0)
+    {
+        libertarCidade(cidade);
+        return;
+    }
+
+    int erro = 0;
+    GrafoCompacto *grafo = GC_criarGrafoCompacto(cidade, false, &erro);
+    CP_verificar(erro, "GC_criarGrafoCompacto");
+    CP_verificar(GC_criarArestasEntrada(grafo), "GC_criarArestasEntrada");
+    CP_verificar(numerarAntenas(cidade), "numerarAntenas");
+
+    Vertice *inicioProcura = (*cidade).primeiraAntena;
+    uint32_t inicioCompacto = GC_procurarAntena(grafo, (*inicioProcura).x, (*inicioProcura).y);
+    uint32_t *ordem = malloc((*grafo).numVertices * sizeof(uint32_t));
+    int32_t *distancias = malloc((*grafo).numVertices * sizeof(int32_t));
+    int32_t *distanciasReferencia = malloc((*grafo).numVertices * sizeof(int32_t));
+    Vertice **vertices = malloc((*grafo).numVertices * sizeof(Vertice *));
+
+    if (ordem == NULL || distancias == NULL || distanciasReferencia == NULL || vertices == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "procuras");
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) vertices[(*antena).indice] = antena;
+
+    Saida *saida = criarSaidaFuncao(CP_guardarAntena, esperada);
+    if (saida == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "criarSaidaFuncao");
+
+    // Largura
+    (*esperada).quantidade = 0;
+    double inicio = CP_agora();
+    CP_verificar(procurarLargura(inicioProcura, (*cidade).numAntenas, saida), "procurarLargura");
+    double tempoReferencia = CP_agora() - inicio;
+    resetVisitados(cidade);
+
+    inicio = CP_agora();
+    int alcancadas = GC_procurarLargura(grafo, inicioCompacto, ordem);
+    double tempo = CP_agora() - inicio;
+    CP_verificar(alcancadas, "GC_procurarLargura");
+
+    CP_antenasCompacto(grafo, ordem, alcancadas, obtida);
+    CP_registar("GC_procurarLargura", "procurarLargura", esperada, obtida, tempoReferencia, tempo);
+
+    // Distâncias da referência: cada antena é descoberta pela primeira antena da ordem de visita que lhe está ligada
+    for (uint32_t i = 0; i < (*grafo).numVertices; i++) distanciasReferencia[i] = -1;
+    distanciasReferencia[(*inicioProcura).indice] = 0;
+
+    for (int i = 0; i < (*esperada).quantidade; i++)
+    {
+        RegistoAntena visitada = (*esperada).elementos[i].origem;
+        Vertice *antena = vertices[GC_procurarAntena(grafo, visitada.x, visitada.y)];
+
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox)
+        {
+            int destino = (*(*aresta).destino).indice;
+            if (distanciasReferencia[destino] < 0) distanciasReferencia[destino] = distanciasReferencia[(*antena).indice] + 1;
+        }
+    }
+
+    // Compara as distâncias de todas as antenas, pela ordem dos identificadores, com vários números de threads
+    ListaComparada distanciasEsperadas = { 0 };
+    for (uint32_t i = 0; i < (*grafo).numVertices; i++)
+    {
+        RegistoAntena antena = { (*vertices[i]).frequencia, (*vertices[i]).x, (*vertices[i]).y };
+        CP_acrescentar(&distanciasEsperadas, antena, (RegistoAntena){ '\0', distanciasReferencia[i] + 1, 1 });
+    }
+
+    for (int t = 0; t < CP_NUM_VARIANTES_THREADS; t++)
+    {
+        inicio = CP_agora();
+        CP_verificar(PP_procurarLarguraParalela(grafo, inicioCompacto, distancias, variantesThreads[t].numThreads, NULL), "PP_procurarLarguraParalela");
+        tempo = CP_agora() - inicio;
+
+        CP_distanciasCompacto(grafo, distancias, obtida);
+        CP_registar(variantesThreads[t].nome, "procurarLargura", &distanciasEsperadas, obtida, tempoReferencia, tempo);
+    }
+    free(distanciasEsperadas.elementos);
+
+    // Profundidade
+    (*esperada).quantidade = 0;
+    inicio = CP_agora();
+    CP_verificar(procurarProfundidade(inicioProcura, saida), "procurarProfundidade");
+    tempoReferencia = CP_agora() - inicio;
+    resetVisitados(cidade);
+
+    inicio = CP_agora();
+    alcancadas = GC_procurarProfundidade(grafo, inicioCompacto, ordem);
+    tempo = CP_agora() - inicio;
+    CP_verificar(alcancadas, "GC_procurarProfundidade");
+
+    CP_antenasCompacto(grafo, ordem, alcancadas, obtida);
+    CP_registar("GC_procurarProfundidade", "procurarProfundidade", esperada, obtida, tempoReferencia, tempo);
+
+    saida = libertarSaida(saida);
+    free(vertices);
+    free(distanciasReferencia);
+    free(distancias);
+    free(ordem);
+    GC_libertarGrafoCompacto(grafo);
+    libertarCidade(cidade);
+}
+
+/**
+ * @brief Compara a procura em largura paralela com a procura em largura numa cidade em que a expansão ascendente é usada.
+ *
+ * A cidade tem as antenas com a mesma frequência interligadas (cliques) e ligações por raio entre grupos,
+ * pelo que a fronteira do primeiro nível tem mais arestas do que 1/PP_ALFA das que faltam visitar.
+ * A lista obtida termina com um elemento que indica se houve níveis ascendentes (a referência exige que sim).
+ *
+ * O mapa é maior do que os restantes (o grafo tem de exceder PP_LIMIAR_SEQUENCIAL arestas), pelo que também
+ * serve para medir a procura face a "GC_procurarLargura", a partir da primeira antena de cada frequência.
+ */
+static void CP_compararLarguraAscendente(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+    CP_verificar(interligarAntenas(cidade, true, false, false), "interligarAntenas");
+    CP_verificar(interligarAntenasRaio(cidade, false, true, false, CP_RAIO_ASCENDENTE, 0), "interligarAntenasRaio");
+
+    if ((*cidade).numAntenas == 0)
+    {
+        libertarCidade(cidade);
+        return;
+    }
+
+    int erro = 0;
+    GrafoCompacto *grafo = GC_criarGrafoCompacto(cidade, false, &erro);
+    CP_verificar(erro, "GC_criarGrafoCompacto");
+    CP_verificar(GC_criarArestasEntrada(grafo), "GC_criarArestasEntrada");
+    CP_verificar(numerarAntenas(cidade), "numerarAntenas");
+
+    Vertice **vertices = malloc((*grafo).numVertices * sizeof(Vertice *));
+    int32_t *distancias = malloc((*grafo).numVertices * sizeof(int32_t));
+    int32_t *distanciasReferencia = malloc((*grafo).numVertices * sizeof(int32_t));
+
+    if (vertices == NULL || distancias == NULL || distanciasReferencia == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "procura ascendente");
+
+    // Referência: procura em largura sequencial sobre as listas de adjacência ("vertices" serve de fila)
+    double inicio = CP_agora();
+    for (uint32_t i = 0; i < (*grafo).numVertices; i++) distanciasReferencia[i] = -1;
+
+    int numFila = 0;
+    vertices[numFila++] = (*cidade).primeiraAntena;
+    distanciasReferencia[(*(*cidade).primeiraAntena).indice] = 0;
+
+    for (int i = 0; i < numFila; i++)
+    {
+        for (Aresta *aresta = (*vertices[i]).primeiraAresta; aresta != NULL; aresta = (*aresta).prox)
+        {
+            Vertice *destino = (*aresta).destino;
+            if (distanciasReferencia[(*destino).indice] >= 0) continue;
+
+            distanciasReferencia[(*destino).indice] = distanciasReferencia[(*vertices[i]).indice] + 1;
+            vertices[numFila++] = destino;
+        }
+    }
+    double tempoReferencia = CP_agora() - inicio;
+
+    EstatisticasLargura estatisticas;
+    inicio = CP_agora();
+    CP_verificar(PP_procurarLarguraParalela(grafo, GC_procurarAntena(grafo, (*(*cidade).primeiraAntena).x, (*(*cidade).primeiraAntena).y), distancias, 0, &estatisticas), "PP_procurarLarguraParalela");
+    double tempo = CP_agora() - inicio;
+
+    CP_distanciasCompacto(grafo, distanciasReferencia, esperada);
+    CP_acrescentar(esperada, (RegistoAntena){ '^', 0, 0 }, (RegistoAntena){ '\0', 1, 1 });
+    CP_distanciasCompacto(grafo, distancias, obtida);
+    CP_acrescentar(obtida, (RegistoAntena){ '^', 0, 0 }, (RegistoAntena){ '\0', estatisticas.niveisAscendentes > 0, 1 });
+    CP_registar("PP_procurarLarguraParalela (ascendente)", "procurarLargura", esperada, obtida, tempoReferencia, tempo);
+
+    // Medição face à procura sequencial do grafo compacto
+    uint32_t *ordem = malloc((*grafo).numVertices * sizeof(uint32_t));
+    if (ordem == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "procura ascendente");
+
+    (*esperada).quantidade = 0;
+    (*obtida).quantidade = 0;
+    tempoReferencia = 0;
+    tempo = 0;
+
+    for (int frequencia = 0; frequencia < NUM_FREQUENCIAS; frequencia++)
+    {
+        Vertice *antena = (*cidade).primeiraAntenaFrequencia[frequencia];
+        if (antena == NULL) continue;
+
+        uint32_t partida = GC_procurarAntena(grafo, (*antena).x, (*antena).y);
+
+        inicio = CP_agora();
+        int alcancadas = GC_procurarLargura(grafo, partida, ordem);
+        tempoReferencia += CP_agora() - inicio;
+        CP_verificar(alcancadas, "GC_procurarLargura");
+
+        // Distâncias pela ordem de visita: cada antena é descoberta pela primeira antena da ordem que lhe está ligada
+        for (uint32_t v = 0; v < (*grafo).numVertices; v++) distanciasReferencia[v] = -1;
+        distanciasReferencia[partida] = 0;
+        for (int i = 0; i < alcancadas; i++)
+        {
+            for (uint32_t a = (*grafo).inicioArestas[ordem[i]]; a < (*grafo).inicioArestas[ordem[i] + 1]; a++)
+            {
+                if (distanciasReferencia[(*grafo).destinos[a]] < 0) distanciasReferencia[(*grafo).destinos[a]] = distanciasReferencia[ordem[i]] + 1;
+            }
+        }
+
+        inicio = CP_agora();
+        CP_verificar(PP_procurarLarguraParalela(grafo, partida, distancias, 0, NULL), "PP_procurarLarguraParalela");
+        tempo += CP_agora() - inicio;
+
+        for (uint32_t v = 0; v < (*grafo).numVertices; v++)
+        {
+            RegistoAntena registo = { (*grafo).frequencias[v], GC_coordenadaX(grafo, v), GC_coordenadaY(grafo, v) };
+            CP_acrescentar(esperada, registo, (RegistoAntena){ '\0', distanciasReferencia[v] + 1, 1 });
+            CP_acrescentar(obtida, registo, (RegistoAntena){ '\0', distancias[v] + 1, 1 });
+        }
+    }
+
+    CP_registar("PP_procurarLarguraParalela (grafo grande)", "GC_procurarLargura", esperada, obtida, tempoReferencia, tempo);
+
+    free(ordem);
+    free(distanciasReferencia);
+    free(distancias);
+    free(vertices);
+    GC_libertarGrafoCompacto(grafo);
+    libertarCidade(cidade);
+}
+
+/**
+ * @brief Compara a inserção em lote ("adicionarAntenasLote") com a inserção ordenada de cada registo.
+ *
+ * São comparadas as antenas da cidade (pela ordem da lista), os grupos de frequência (que seguem a ordem da
+ * lista, seja qual for a ordem de inserção, terminando na última antena do grupo) e o resultado de cada registo ('?' com o índice e o código). Na referência,
+ * um registo que falha com "ERRO_ANTENA_JA_EXISTE" e tem as coordenadas de um registo anterior do lote é
+ * uma repetição dentro do lote ("ERRO_ANTENA_REPETIDA_LOTE"), mesmo que a antena já existisse na cidade.
+ */
+static void CP_compararLote(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    RegistoAntena *lote = malloc(CP_TAMANHO_LOTE * sizeof(RegistoAntena));
+    int *resultados = malloc(CP_TAMANHO_LOTE * sizeof(int));
+
+    if (lote == NULL || resultados == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "lote");
+
+    for (int i = 0; i < CP_TAMANHO_LOTE; i++) lote[i] = (RegistoAntena){ (char)('A' + rand() % CP_NUM_FREQUENCIAS), rand() % (*mapa).largura, rand() % (*mapa).altura };
+
+    Grafo *referencia = criarCidade(), *cidade = criarCidade();
+    CP_verificar(carregarCidade(referencia, (*mapa).texto), "carregarCidade");
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+
+    double inicio = CP_agora();
+    for (int i = 0; i < CP_TAMANHO_LOTE; i++)
+    {
+        char frequencia = lote[i].frequencia;
+        resultados[i] = adicionarAntenaOrdenada(referencia, &frequencia, lote[i].x, lote[i].y);
+    }
+    double tempoReferencia = CP_agora() - inicio;
+
+    for (int i = 0; i < CP_TAMANHO_LOTE; i++)
+    {
+        for (int j = 0; j < i && resultados[i] == ERRO_ANTENA_JA_EXISTE; j++)
+        {
+            if (lote[j].x == lote[i].x && lote[j].y == lote[i].y) resultados[i] = ERRO_ANTENA_REPETIDA_LOTE;
+        }
+    }
+
+    ListaComparada *listas[2] = { esperada, obtida };
+    Grafo *cidades[2] = { referencia, cidade };
+    double tempo = 0;
+
+    for (int lado = 0; lado < 2; lado++)
+    {
+        if (lado == 1)
+        {
+            inicio = CP_agora();
+            CP_verificar(adicionarAntenasLote(cidade, lote, CP_TAMANHO_LOTE, resultados), "adicionarAntenasLote");
+            tempo = CP_agora() - inicio;
+        }
+
+        ListaComparada *lista = listas[lado];
+        CP_antenasCidade(cidades[lado], lista);
+
+        for (int f = 0; f < CP_NUM_FREQUENCIAS; f++)
+        {
+            for (Vertice *antena = (*cidades[lado]).primeiraAntenaFrequencia['A' + f]; antena != NULL; antena = (*antena).proxFrequencia)
+            {
+                CP_acrescentarAntena(lista, (*antena).frequencia, (*antena).x, (*antena).y);
+            }
+
+            Vertice *ultima = (*cidades[lado]).ultimaAntenaFrequencia['A' + f];
+            if (ultima != NULL) CP_acrescentarAntena(lista, '>', (*ultima).x, (*ultima).y);
+            CP_acrescentarAntena(lista, '|', f, (*cidades[lado]).numAntenasFrequencia['A' + f]);
+        }
+
+        for (int i = 0; i < CP_TAMANHO_LOTE; i++) CP_acrescentarAntena(lista, '?', i, resultados[i]);
+    }
+
+    CP_registar("adicionarAntenasLote", "adicionarAntenaOrdenada", esperada, obtida, tempoReferencia, tempo);
+
+    libertarCidade(cidade);
+    libertarCidade(referencia);
+    free(resultados);
+    free(lote);
+}
+
+/**
+ * @brief Calcula as interseções (pontos médios distintos de cada par de frequências) percorrendo todos os pares de antenas.
+ *
+ * @param tipo 0: frequências diferentes, 1: a mesma frequência, 2: ambas.
+ */
+static void CP_intersecoesForcaBruta(const RegistoAntena *antenas, int numAntenas, int tipo, ListaComparada *lista)
+{
+    (*lista).quantidade = 0;
+
+    for (int i = 0; i < numAntenas; i++)
+    {
+        for (int j = i + 1; j < numAntenas; j++)
+        {
+            RegistoAntena a = antenas[i], b = antenas[j];
+            bool mesma = (a.frequencia == b.frequencia);
+
+            if ((tipo == 0 && mesma) || (tipo == 1 && !mesma)) continue;
+
+            char frequencia1 = (a.frequencia < b.frequencia) ? a.frequencia : b.frequencia;
+            char frequencia2 = (a.frequencia < b.frequencia) ? b.frequencia : a.frequencia;
+            CP_acrescentar(lista, (RegistoAntena){ frequencia1, (a.x + b.x) / 2, (a.y + b.y) / 2 }, (RegistoAntena){ frequencia2, 0, 0 });
+        }
+    }
+
+    // Ordena e retira os pontos médios repetidos do mesmo par de frequências
+    qsort((*lista).elementos, (*lista).quantidade, sizeof(ElementoComparado), CP_compararElementos);
+
+    int distintos = 0;
+    for (int i = 0; i < (*lista).quantidade; i++)
+    {
+        if (distintos == 0 || CP_compararElementos(&(*lista).elementos[distintos - 1], &(*lista).elementos[i]) != 0) (*lista).elementos[distintos++] = (*lista).elementos[i];
+    }
+    (*lista).quantidade = distintos;
+}
+
+/**
+ * @brief Compara a procura de interseções (cidade e grafo compacto) com o cálculo dos pontos médios de todos os pares.
+ *
+ * Cada interseção é comparada pelas frequências do par e pelo ponto médio; o par entregue (o primeiro que
+ * o origina, que depende da ordem de percurso) só é verificado quanto a ter esse ponto médio.
+ */
+static void CP_compararIntersecoes(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+
+    int erro = 0;
+    GrafoCompacto *grafo = GC_criarGrafoCompacto(cidade, false, &erro);
+    CP_verificar(erro, "GC_criarGrafoCompacto");
+    CP_verificar(GC_criarIndiceFrequencias(grafo), "GC_criarIndiceFrequencias");
+
+    RegistoAntena *antenas = malloc(((*cidade).numAntenas + 1) * sizeof(RegistoAntena));
+    if (antenas == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "interseções");
+
+    int numAntenas = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) antenas[numAntenas++] = (RegistoAntena){ (*antena).frequencia, (*antena).x, (*antena).y };
+
+    // Frequências diferentes (todos os pares de frequências)
+    double inicio = CP_agora();
+    CP_intersecoesForcaBruta(antenas, numAntenas, 0, esperada);
+    double tempoReferencia = CP_agora() - inicio;
+
+    (*obtida).quantidade = 0;
+    inicio = CP_agora();
+    CP_verificar(procurarTodasIntersecoes(cidade, CP_guardarIntersecao, obtida), "procurarTodasIntersecoes");
+    double tempo = CP_agora() - inicio;
+
+    qsort((*obtida).elementos, (*obtida).quantidade, sizeof(ElementoComparado), CP_compararElementos);
+    CP_registar("procurarTodasIntersecoes", "todos os pares", esperada, obtida, tempoReferencia, tempo);
+
+    // A mesma frequência (cada par não ordenado uma vez)
+    inicio = CP_agora();
+    CP_intersecoesForcaBruta(antenas, numAntenas, 1, esperada);
+    tempoReferencia = CP_agora() - inicio;
+
+    (*obtida).quantidade = 0;
+    inicio = CP_agora();
+    for (int f = 0; f < CP_NUM_FREQUENCIAS; f++) CP_verificar(procurarIntersecoes(cidade, (char)('A' + f), (char)('A' + f), CP_guardarIntersecao, obtida), "procurarIntersecoes");
+    tempo = CP_agora() - inicio;
+
+    qsort((*obtida).elementos, (*obtida).quantidade, sizeof(ElementoComparado), CP_compararElementos);
+    CP_registar("procurarIntersecoes (mesma frequencia)", "todos os pares", esperada, obtida, tempoReferencia, tempo);
+
+    // Grafo compacto: todos os pares de frequências (f1 <= f2)
+    inicio = CP_agora();
+    CP_intersecoesForcaBruta(antenas, numAntenas, 2, esperada);
+    tempoReferencia = CP_agora() - inicio;
+
+    IntersecoesCompactas intersecoes = { grafo, obtida };
+    (*obtida).quantidade = 0;
+    inicio = CP_agora();
+    for (int f1 = 0; f1 < CP_NUM_FREQUENCIAS; f1++)
+    {
+        for (int f2 = f1; f2 < CP_NUM_FREQUENCIAS; f2++)
+        {
+            CP_verificar(GC_procurarIntersecoes(grafo, (char)('A' + f1), (char)('A' + f2), CP_guardarIntersecaoCompacta, &intersecoes), "GC_procurarIntersecoes");
+        }
+    }
+    tempo = CP_agora() - inicio;
+
+    qsort((*obtida).elementos, (*obtida).quantidade, sizeof(ElementoComparado), CP_compararElementos);
+    CP_registar("GC_procurarIntersecoes", "todos os pares", esperada, obtida, tempoReferencia, tempo);
+
+    free(antenas);
+    GC_libertarGrafoCompacto(grafo);
+    libertarCidade(cidade);
+}
+
+/**
+ * @brief Constrói a adjacência inversa de uma cidade numerada: as origens das arestas que chegam à antena com
+ *        identificador "i" ficam em "origens[inicioEntradas[i]]" a "origens[inicioEntradas[i + 1] - 1]".
+ */
+static void CP_adjacenciaInversa(Grafo *cidade, int **inicioEntradas, Vertice ***origens)
+{
+    int numArestas = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) numArestas += (*antena).numArestas;
+
+    *inicioEntradas = calloc((*cidade).numAntenas + 1, sizeof(int));
+    *origens = malloc((numArestas + 1) * sizeof(Vertice *));
+
+    if (*inicioEntradas == NULL || *origens == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "adjacência inversa");
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox) (*inicioEntradas)[(*(*aresta).destino).indice + 1]++;
+    }
+    for (int i = 0; i < (*cidade).numAntenas; i++) (*inicioEntradas)[i + 1] += (*inicioEntradas)[i];
+
+    int *posicao = malloc(((*cidade).numAntenas + 1) * sizeof(int));
+    if (posicao == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "adjacência inversa");
+    memcpy(posicao, *inicioEntradas, ((*cidade).numAntenas + 1) * sizeof(int));
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+    {
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox) (*origens)[posicao[(*(*aresta).destino).indice]++] = antena;
+    }
+
+    free(posicao);
+}
+
+/**
+ * @brief Procura em largura (pelas arestas de saída e, se "inicioEntradas" não for NULL, também pelas de entrada)
+ *        a partir de uma antena.
+ *
+ * @param inicioEntradas, origens Adjacência inversa (ver "CP_adjacenciaInversa"), para ignorar o sentido das arestas.
+ * @param marca Vetor indexado por "Vertice.indice": as antenas alcançadas ficam com o valor "valor".
+ * @param fila Vetor auxiliar com espaço para todas as antenas.
+ *
+ * @return Número de antenas alcançadas (incluindo a própria).
+ */
+static int CP_marcarAlcancaveis(Vertice *inicio, const int *inicioEntradas, Vertice *const *origens, int *marca, int valor, Vertice **fila)
+{
+    int cabeca = 0, cauda = 0;
+
+    marca[(*inicio).indice] = valor;
+    fila[cauda++] = inicio;
+
+    while (cabeca < cauda)
+    {
+        Vertice *antena = fila[cabeca++];
+
+        for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox)
+        {
+            Vertice *destino = (*aresta).destino;
+            if (marca[(*destino).indice] != valor)
+            {
+                marca[(*destino).indice] = valor;
+                fila[cauda++] = destino;
+            }
+        }
+
+        if (inicioEntradas == NULL) continue;
+
+        for (int e = inicioEntradas[(*antena).indice]; e < inicioEntradas[(*antena).indice + 1]; e++)
+        {
+            Vertice *origem = origens[e];
+            if (marca[(*origem).indice] != valor)
+            {
+                marca[(*origem).indice] = valor;
+                fila[cauda++] = origem;
+            }
+        }
+    }
+
+    return cauda;
+}
+
+/**
+ * @brief Compara o fecho transitivo ("FT_alcancavel" para todos os pares e "FT_contarAlcancaveis") com uma procura
+ *        em largura a partir de cada antena.
+ *
+ * A cidade é ligada às antenas mais próximas (arestas num só sentido). Há duas rondas de consultas, com
+ * "CP_ALTERACOES_FECHO" arestas acrescentadas entre elas, para verificar também a reconstrução da matriz.
+ */
+static void CP_compararFechoTransitivo(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+    CP_verificar(interligarAntenasRaio(cidade, true, true, false, CP_RAIO, CP_MAX_VIZINHOS), "interligarAntenasRaio");
+
+    int numAntenas = (*cidade).numAntenas;
+    if (numAntenas == 0)
+    {
+        libertarCidade(cidade);
+        return;
+    }
+
+    CP_verificar(numerarAntenas(cidade), "numerarAntenas");
+
+    int *marca = malloc(numAntenas * sizeof(int));
+    Vertice **fila = malloc(numAntenas * sizeof(Vertice *));
+    Vertice **vertices = malloc(numAntenas * sizeof(Vertice *));
+
+    if (marca == NULL || fila == NULL || vertices == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "fecho transitivo");
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) vertices[(*antena).indice] = antena;
+
+    int erro = 0;
+    FechoTransitivo *fecho = FT_criarFechoTransitivo(cidade, FT_LIMITE_PREDEFINIDO, &erro);
+    CP_verificar(erro, "FT_criarFechoTransitivo");
+
+    ListaComparada contagensEsperadas = { 0 }, contagensObtidas = { 0 };
+    double tempoReferencia = 0, tempo = 0, tempoContagem = 0;
+    (*esperada).quantidade = (*obtida).quantidade = 0;
+
+    for (int ronda = 0; ronda < 2; ronda++)
+    {
+        if (ronda == 1)
+        {
+            for (int i = 0; i < CP_ALTERACOES_FECHO; i++)
+            {
+                Vertice *origem = vertices[rand() % numAntenas], *destino = vertices[rand() % numAntenas];
+                int resultado = (origem != destino) ? adicionarAresta(origem, destino, true) : 0;
+                if (resultado != ERRO_ARESTA_JA_EXISTE) CP_verificar(resultado, "adicionarAresta");
+            }
+        }
+
+        // Referência: uma procura em largura por antena
+        for (int i = 0; i < numAntenas; i++) marca[i] = -1;
+
+        double inicio = CP_agora();
+        for (int i = 0; i < numAntenas; i++)
+        {
+            RegistoAntena origem = { (*vertices[i]).frequencia, (*vertices[i]).x, (*vertices[i]).y };
+            int alcancadas = CP_marcarAlcancaveis(vertices[i], NULL, NULL, marca, i, fila);
+
+            for (int j = 0; j < numAntenas; j++)
+            {
+                if (marca[j] == i) CP_acrescentar(esperada, origem, (RegistoAntena){ (*vertices[j]).frequencia, (*vertices[j]).x, (*vertices[j]).y });
+            }
+            CP_acrescentar(&contagensEsperadas, origem, (RegistoAntena){ '\0', alcancadas, 1 });
+        }
+        tempoReferencia += CP_agora() - inicio;
+
+        // Fecho transitivo: a primeira consulta de cada ronda (re)constrói a matriz
+        inicio = CP_agora();
+        for (int i = 0; i < numAntenas; i++)
+        {
+            RegistoAntena origem = { (*vertices[i]).frequencia, (*vertices[i]).x, (*vertices[i]).y };
+
+            for (int j = 0; j < numAntenas; j++)
+            {
+                int alcancavel = FT_alcancavel(fecho, vertices[i], vertices[j]);
+                CP_verificar(alcancavel, "FT_alcancavel");
+
+                if (alcancavel) CP_acrescentar(obtida, origem, (RegistoAntena){ (*vertices[j]).frequencia, (*vertices[j]).x, (*vertices[j]).y });
+            }
+        }
+        tempo += CP_agora() - inicio;
+
+        inicio = CP_agora();
+        for (int i = 0; i < numAntenas; i++)
+        {
+            int alcancadas = FT_contarAlcancaveis(fecho, vertices[i]);
+            CP_verificar(alcancadas, "FT_contarAlcancaveis");
+            CP_acrescentar(&contagensObtidas, (RegistoAntena){ (*vertices[i]).frequencia, (*vertices[i]).x, (*vertices[i]).y }, (RegistoAntena){ '\0', alcancadas, 1 });
+        }
+        tempoContagem += CP_agora() - inicio;
+    }
+
+    CP_registar("FT_alcancavel", "procura em largura", esperada, obtida, tempoReferencia, tempo);
+    CP_registar("FT_contarAlcancaveis", "procura em largura", &contagensEsperadas, &contagensObtidas, tempoReferencia, tempoContagem);
+
+    free(contagensObtidas.elementos);
+    free(contagensEsperadas.elementos);
+    FT_libertarFechoTransitivo(fecho);
+    free(vertices);
+    free(fila);
+    free(marca);
+    libertarCidade(cidade);
+}
+
+/**
+ * @brief Compara as componentes conexas ("CC_calcularComponentes") com procuras em largura que ignoram o sentido das arestas.
+ *
+ * A cidade é ligada apenas à antena mais próxima, para que haja muitas componentes. São comparadas a componente
+ * de cada antena (pela ordem dos identificadores), o tamanho e o representante de cada componente ('#'), a
+ * mistura de frequências (da mais frequente para a menos, em empate pela primeira a surgir) e os totais ('^').
+ */
+static void CP_compararComponentes(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).texto), "carregarCidade");
+    CP_verificar(interligarAntenasRaio(cidade, true, true, false, CP_RAIO, 1), "interligarAntenasRaio");
+
+    int erro = 0;
+    GrafoCompacto *grafo = GC_criarGrafoCompacto(cidade, false, &erro);
+    CP_verificar(erro, "GC_criarGrafoCompacto");
+    CP_verificar(numerarAntenas(cidade), "numerarAntenas");
+
+    int numAntenas = (*cidade).numAntenas;
+    int *marca = malloc((numAntenas + 1) * sizeof(int));
+    int *componente = malloc((numAntenas + 1) * sizeof(int));
+    Vertice **fila = malloc((numAntenas + 1) * sizeof(Vertice *));
+    Vertice **vertices = malloc((numAntenas + 1) * sizeof(Vertice *)); /* Pelo identificador do grafo compacto */
+
+    if (marca == NULL || componente == NULL || fila == NULL || vertices == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "componentes");
+
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) vertices[GC_procurarAntena(grafo, (*antena).x, (*antena).y)] = antena;
+
+    // Referência: cada antena ainda sem componente inicia uma nova (pela ordem dos identificadores)
+    double inicio = CP_agora();
+    int numComponentes = 0, numMonofrequencia = 0, numMistas = 0;
+
+    int *inicioEntradas = NULL;
+    Vertice **origens = NULL;
+    CP_adjacenciaInversa(cidade, &inicioEntradas, &origens);
+
+    for (int i = 0; i < numAntenas; i++) marca[i] = -1;
+    for (int v = 0; v < numAntenas; v++)
+    {
+        if (marca[(*vertices[v]).indice] < 0) CP_marcarAlcancaveis(vertices[v], inicioEntradas, origens, marca, numComponentes++, fila);
+        componente[v] = marca[(*vertices[v]).indice];
+    }
+    double tempoReferencia = CP_agora() - inicio;
+
+    free(origens);
+    free(inicioEntradas);
+
+    (*esperada).quantidade = 0;
+    for (int v = 0; v < numAntenas; v++) CP_acrescentar(esperada, (RegistoAntena){ (*vertices[v]).frequencia, (*vertices[v]).x, (*vertices[v]).y }, (RegistoAntena){ '\0', componente[v] + 1, 1 });
+
+    for (int c = 0, representante = 0; c < numComponentes; c++)
+    {
+        while (componente[representante] != c) representante++;
+
+        // Frequências pela ordem em que surgem e, depois, da mais frequente para a menos (ordenação estável)
+        char frequencias[NUM_FREQUENCIAS];
+        int quantidades[NUM_FREQUENCIAS], numFrequencias = 0, tamanho = 0;
+
+        for (int v = representante; v < numAntenas; v++)
+        {
+            if (componente[v] != c) continue;
+
+            int f = 0;
+            while (f < numFrequencias && frequencias[f] != (*vertices[v]).frequencia) f++;
+            if (f == numFrequencias)
+            {
+                frequencias[numFrequencias] = (*vertices[v]).frequencia;
+                quantidades[numFrequencias++] = 0;
+            }
+            quantidades[f]++;
+            tamanho++;
+        }
+
+        for (int i = 1; i < numFrequencias; i++)
+        {
+            for (int j = i; j > 0 && quantidades[j - 1] < quantidades[j]; j--)
+            {
+                char frequencia = frequencias[j];
+                int quantidade = quantidades[j];
+                frequencias[j] = frequencias[j - 1];
+                quantidades[j] = quantidades[j - 1];
+                frequencias[j - 1] = frequencia;
+                quantidades[j - 1] = quantidade;
+            }
+        }
+
+        Vertice *antena = vertices[representante];
+        CP_acrescentar(esperada, (RegistoAntena){ '#', c, tamanho }, (RegistoAntena){ (*antena).frequencia, (*antena).x, (*antena).y });
+        for (int f = 0; f < numFrequencias; f++) CP_acrescentarAntena(esperada, frequencias[f], c, quantidades[f]);
+
+        if (numFrequencias == 1) numMonofrequencia++;
+        else numMistas++;
+    }
+    CP_acrescentar(esperada, (RegistoAntena){ '^', numMonofrequencia, numMistas }, (RegistoAntena){ 0 });
+
+    inicio = CP_agora();
+    Componentes *componentes = CC_calcularComponentes(grafo, &erro);
+    double tempo = CP_agora() - inicio;
+    CP_verificar(erro, "CC_calcularComponentes");
+
+    (*obtida).quantidade = 0;
+    for (uint32_t v = 0; v < (*componentes).numVertices; v++)
+    {
+        RegistoAntena antena = { (*grafo).frequencias[v], GC_coordenadaX(grafo, v), GC_coordenadaY(grafo, v) };
+        CP_acrescentar(obtida, antena, (RegistoAntena){ '\0', (int)(*componentes).componente[v] + 1, 1 });
+    }
+
+    for (uint32_t c = 0; c < (*componentes).numComponentes; c++)
+    {
+        uint32_t representante = (*componentes).representante[c];
+        RegistoAntena antena = { (*grafo).frequencias[representante], GC_coordenadaX(grafo, representante), GC_coordenadaY(grafo, representante) };
+
+        CP_acrescentar(obtida, (RegistoAntena){ '#', (int)c, (int)(*componentes).tamanho[c] }, antena);
+        for (uint32_t f = (*componentes).inicioFrequencias[c]; f < (*componentes).inicioFrequencias[c + 1]; f++)
+        {
+            CP_acrescentarAntena(obtida, (*componentes).frequencias[f].frequencia, (int)c, (int)(*componentes).frequencias[f].quantidade);
+        }
+    }
+    CP_acrescentar(obtida, (RegistoAntena){ '^', (int)(*componentes).numMonofrequencia, (int)(*componentes).numMistas }, (RegistoAntena){ 0 });
+
+    CP_registar("CC_calcularComponentes", "procura em largura", esperada, obtida, tempoReferencia, tempo);
+
+    CC_libertarComponentes(componentes);
+    free(vertices);
+    free(fila);
+    free(componente);
+    free(marca);
+    GC_libertarGrafoCompacto(grafo);
+    libertarCidade(cidade);
+}
+
+/**
+ * @brief Compara a procura de todos os caminhos entre a primeira e a última antena de uma cidade pequena.
+ */
+static void CP_compararCaminhos(const MapaAleatorio *mapa, ListaComparada *esperada, ListaComparada *obtida)
+{
+    Grafo *cidade = criarCidade();
+    CP_verificar(carregarCidade(cidade, (*mapa).caminhos), "carregarCidade");
+    CP_verificar(interligarAntenasRaio(cidade, true, true, false, 4, 0), "interligarAntenasRaio");
+
+    Vertice *origem = (*cidade).primeiraAntena, *destino = origem;
+    while ((*destino).prox != NULL) destino = (*destino).prox;
+
+    int erro = 0;
+    GrafoCompacto *grafo = GC_criarGrafoCompacto(cidade, false, &erro);
+    CP_verificar(erro, "GC_criarGrafoCompacto");
+
+    Saida *saida = criarSaidaFuncao(CP_guardarCaminho, esperada);
+    if (saida == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "criarSaidaFuncao");
+
+    (*esperada).quantidade = 0;
+    double inicio = CP_agora();
+    CP_verificar(procurarCaminhos(origem, destino, (*cidade).numAntenas, saida), "procurarCaminhos");
+    double tempoReferencia = CP_agora() - inicio;
+    resetVisitados(cidade);
+
+    ContextoCaminhoCompacto contexto = { grafo, obtida };
+    (*obtida).quantidade = 0;
+    inicio = CP_agora();
+    CP_verificar(GC_procurarCaminhos(grafo, GC_procurarAntena(grafo, (*origem).x, (*origem).y), GC_procurarAntena(grafo, (*destino).x, (*destino).y), CP_guardarCaminhoCompacto, &contexto), "GC_procurarCaminhos");
+    double tempo = CP_agora() - inicio;
+
+    CP_registar("GC_procurarCaminhos", "procurarCaminhos", esperada, obtida, tempoReferencia, tempo);
+
+    // Procura com poda (sem limites, só a contagem, com caminhos curtos e com os primeiros caminhos)
+    ListaComparada caminhos = { 0 };
+    CP_filtrarCaminhos(esperada, &caminhos, 0, 0);
+
+    Saida *saidaPodada = criarSaidaFuncao(CP_guardarCaminho, obtida);
+    if (saidaPodada == NULL) CP_verificar(LL_ERRO_ALOCACAO_MEMORIA, "criarSaidaFuncao");
+
+    struct { const char *nome; OpcoesCaminhos opcoes; } variantes[] =
+    {
+        { "procurarCaminhosPodados", { .apenasContar = false } },
+        { "procurarCaminhosPodados (contagem)", { .apenasContar = true } },
+        { "procurarCaminhosPodados (caminhos curtos)", { .maxAntenas = CP_MAX_ANTENAS_CAMINHO } },
+        { "procurarCaminhosPodados (primeiros)", { .maxCaminhos = CP_MAX_CAMINHOS } }
+    };
+
+    for (int v = 0; v < (int)(sizeof(variantes) / sizeof(variantes[0])); v++)
+    {
+        OpcoesCaminhos *opcoes = &variantes[v].opcoes;
+        int numCaminhos = CP_filtrarCaminhos(&caminhos, esperada, (*opcoes).maxAntenas, (int)(*opcoes).maxCaminhos);
+
+        (*obtida).quantidade = 0;
+        inicio = CP_agora();
+        CP_verificar(procurarCaminhosPodados(cidade, origem, destino, opcoes, saidaPodada), "procurarCaminhosPodados");
+        tempo = CP_agora() - inicio;
+
+        // Na contagem compara-se apenas o número de caminhos
+        if ((*opcoes).apenasContar)
+        {
+            (*esperada).quantidade = 0;
+            CP_acrescentarAntena(esperada, '#', numCaminhos, 0);
+        }
+        if ((*opcoes).apenasContar || (*opcoes).numCaminhos != numCaminhos) CP_acrescentarAntena(obtida, '#', (int)(*opcoes).numCaminhos, 0);
+        if (!(*opcoes).apenasContar && (*opcoes).numCaminhos != numCaminhos) CP_acrescentarAntena(esperada, '#', numCaminhos, 0);
+
+        CP_registar(variantes[v].nome, "procurarCaminhos", esperada, obtida, tempoReferencia, tempo);
+    }
+
+    free(caminhos.elementos);
+    libertarSaida(saidaPodada);
+    libertarSaida(saida);
+    GC_libertarGrafoCompacto(grafo);
+    libertarCidade(cidade);
+}
+
+/*---- Programa --------------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Função principal do comparador.
+ *
+ * @return EXIT_SUCCESS se todas as implementações alternativas produzirem as mesmas saídas que a referência.
+ */
+int main(int argc, char *argv[])
+{
+    int numMapas = (argc > 1) ? atoi(argv[1]) : CP_NUM_MAPAS;
+    unsigned int semente = (argc > 2) ? (unsigned int)strtoul(argv[2], NULL, 10) : (unsigned int)time(NULL);
+    int largura = (argc > 3) ? atoi(argv[3]) : CP_LARGURA;
+    int altura = (argc > 4) ? atoi(argv[4]) : CP_ALTURA;
+
+    if (numMapas <= 0 || largura <= 0 || altura <= 0)
+    {
+        fprintf(stderr, "Utilização: %s [número de mapas] [semente] [largura] [altura]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    char pasta[] = "/tmp/comparadorXXXXXX";
+    if (mkdtemp(pasta) == NULL)
+    {
+        fprintf(stderr, "❌ Não foi possível criar a pasta temporária.\n");
+        return EXIT_FAILURE;
+    }
+
+    printf("Semente %u, %d mapas de %d x %d (%d‰ de antenas, %d frequências)\n", semente, numMapas, largura, altura, CP_DENSIDADE, CP_NUM_FREQUENCIAS);
+    srand(semente);
+
+    ListaComparada esperada = { 0 }, obtida = { 0 };
+
+    for (mapaAtual = 1; mapaAtual <= numMapas; mapaAtual++)
+    {
+        MapaAleatorio mapa;
+        CP_gerarMapa(&mapa, pasta, mapaAtual, largura, altura);
+
+        CP_compararCarregamentos(&mapa, &esperada, &obtida);
+        CP_compararNefastos(&mapa, &esperada, &obtida);
+        CP_compararConsultasEspaciais(&mapa, &esperada, &obtida);
+        CP_compararInterligacoes(&mapa, &esperada, &obtida);
+        CP_compararOrdemProcuras(&mapa, &esperada, &obtida);
+        CP_compararInterligacoesRaio(&mapa, &esperada, &obtida);
+        CP_compararLote(&mapa, &esperada, &obtida);
+        CP_compararRemocoes(&mapa, &esperada, &obtida);
+        CP_compararIntersecoes(&mapa, &esperada, &obtida);
+        CP_compararProcuras(&mapa, &esperada, &obtida);
+
+        MapaAleatorio mapaAscendente;
+        CP_gerarMapa(&mapaAscendente, pasta, numMapas + mapaAtual, CP_LARGURA_ASCENDENTE, CP_ALTURA_ASCENDENTE);
+        CP_compararLarguraAscendente(&mapaAscendente, &esperada, &obtida);
+        CP_apagarMapa(&mapaAscendente);
+
+        CP_compararFechoTransitivo(&mapa, &esperada, &obtida);
+        CP_compararComponentes(&mapa, &esperada, &obtida);
+        CP_compararCaminhos(&mapa, &esperada, &obtida);
+
+        CP_apagarMapa(&mapa);
+    }
+
+    rmdir(pasta);
+    free(esperada.elementos);
+    free(obtida.elementos);
+
+    int numFalhas = CP_apresentarRelatorio();
+
+    if (numFalhas > 0) printf("\n❌ %d implementações produziram resultados diferentes da referência.\n", numFalhas);
+    else printf("\n✅ Todas as implementações produziram os mesmos resultados que a referência.\n");
+
+    return (numFalhas > 0) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,294 @@
+/**
+ * @file Componentes.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação da identificação de componentes conexas do grafo compacto
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Componentes.h"
+
+#define CC_SEM_COMPONENTE UINT32_MAX
+
+/**
+ * @brief Devolve a raiz do conjunto de um vértice (com compressão do caminho por metades).
+ */
+static inline uint32_t raizConjunto(uint32_t *pai, uint32_t vertice)
+{
+    while (pai[vertice] != vertice)
+    {
+        pai[vertice] = pai[pai[vertice]];
+        vertice = pai[vertice];
+    }
+
+    return vertice;
+}
+
+/**
+ * @brief Identifica as componentes conexas de um grafo compacto (ignorando o sentido das arestas).
+ *
+ * Junta os extremos de cada aresta numa floresta de conjuntos disjuntos (união por tamanho e
+ * compressão de caminhos) e numera as componentes numa só passagem pelos vértices. Os tamanhos e a
+ * mistura de frequências são calculados agrupando os vértices por componente (ordenação por contagem).
+ *
+ * @param grafo Apontador para o grafo compacto.
+ * @param erro Apontador para a variável que recebe o código de erro (0 em caso de sucesso).
+ *
+ * @note Custo O((V + E) · α(V)) e não altera o grafo (pode ser usada sobre uma versão partilhada).
+ *
+ * @return Apontador para as componentes calculadas.
+ * @return NULL em caso de erro ("CC_ERRO_GRAFO_PONTEIRO_INVALIDO" ou "CC_ERRO_ALOCACAO_MEMORIA" em "erro").
+ */
+Componentes *CC_calcularComponentes(const GrafoCompacto *grafo, int *erro)
+{
+    // Verifica se o apontador é válido
+    if (grafo == NULL)
+    {
+        *erro = CC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+        return NULL;
+    }
+
+    uint32_t numVertices = (*grafo).numVertices;
+    size_t posicoes = (numVertices > 0) ? numVertices : 1;
+
+    // Aloca o espaço na memória para as componentes (e inicializa as variáveis)
+    Componentes *componentes = calloc(1, sizeof(Componentes));
+    uint32_t *pai = malloc(posicoes * sizeof(uint32_t));
+    uint32_t *tamanhoConjunto = malloc(posicoes * sizeof(uint32_t));
+
+    if (componentes != NULL)
+    {
+        (*componentes).componente = malloc(posicoes * sizeof(uint32_t));
+        (*componentes).tamanho = calloc(posicoes, sizeof(uint32_t));
+        (*componentes).representante = malloc(posicoes * sizeof(uint32_t));
+        (*componentes).inicioFrequencias = malloc((posicoes + 1) * sizeof(uint32_t));
+        (*componentes).frequencias = malloc(posicoes * sizeof(FrequenciaComponente));
+    }
+
+    // Verifica se foi possível alocar a memória
+    if (componentes == NULL || pai == NULL || tamanhoConjunto == NULL || (*componentes).componente == NULL || (*componentes).tamanho == NULL ||
+        (*componentes).representante == NULL || (*componentes).inicioFrequencias == NULL || (*componentes).frequencias == NULL)
+    {
+        free(pai);
+        free(tamanhoConjunto);
+        CC_libertarComponentes(componentes);
+        *erro = CC_ERRO_ALOCACAO_MEMORIA;
+        return NULL;
+    }
+
+    (*componentes).numVertices = numVertices;
+
+    // Junta os extremos de cada aresta
+    for (uint32_t v = 0; v < numVertices; v++)
+    {
+        pai[v] = v;
+        tamanhoConjunto[v] = 1;
+    }
+
+    for (uint32_t v = 0; v < numVertices; v++)
+    {
+        for (uint32_t a = (*grafo).inicioArestas[v]; a < (*grafo).inicioArestas[v + 1]; a++)
+        {
+            uint32_t raiz1 = raizConjunto(pai, v);
+            uint32_t raiz2 = raizConjunto(pai, (*grafo).destinos[a]);
+
+            if (raiz1 == raiz2) continue;
+
+            // União por tamanho (o conjunto menor fica por baixo)
+            if (tamanhoConjunto[raiz1] < tamanhoConjunto[raiz2])
+            {
+                uint32_t temp = raiz1;
+                raiz1 = raiz2;
+                raiz2 = temp;
+            }
+            pai[raiz2] = raiz1;
+            tamanhoConjunto[raiz1] += tamanhoConjunto[raiz2];
+        }
+    }
+
+    // Numera as componentes pela ordem do primeiro vértice (o número fica guardado na posição da raiz)
+    uint32_t *componente = (*componentes).componente;
+    uint32_t numComponentes = 0;
+
+    for (uint32_t v = 0; v < numVertices; v++) componente[v] = CC_SEM_COMPONENTE;
+
+    for (uint32_t v = 0; v < numVertices; v++)
+    {
+        uint32_t raiz = raizConjunto(pai, v);
+
+        if (componente[raiz] == CC_SEM_COMPONENTE)
+        {
+            componente[raiz] = numComponentes;
+            (*componentes).representante[numComponentes++] = v;
+        }
+        componente[v] = componente[raiz];
+        (*componentes).tamanho[componente[v]]++;
+    }
+
+    (*componentes).numComponentes = numComponentes;
+
+    // Agrupa os vértices por componente ("pai" passa a guardar os membros e "tamanhoConjunto" o início de cada componente)
+    uint32_t *membros = pai;
+    uint32_t *inicio = tamanhoConjunto;
+
+    for (uint32_t c = 0, soma = 0; c < numComponentes; c++)
+    {
+        inicio[c] = soma;
+        soma += (*componentes).tamanho[c];
+    }
+    for (uint32_t v = 0; v < numVertices; v++) membros[inicio[componente[v]]++] = v;
+
+    // Conta as frequências de cada componente
+    uint32_t contagem[NUM_FREQUENCIAS] = { 0 };
+    uint32_t numFrequencias = 0;
+
+    for (uint32_t c = 0, posicao = 0; c < numComponentes; c++)
+    {
+        uint32_t primeiraFrequencia = numFrequencias;
+        (*componentes).inicioFrequencias[c] = primeiraFrequencia;
+
+        for (uint32_t fim = posicao + (*componentes).tamanho[c]; posicao < fim; posicao++)
+        {
+            unsigned char frequencia = (unsigned char)(*grafo).frequencias[membros[posicao]];
+
+            if (contagem[frequencia]++ == 0) (*componentes).frequencias[numFrequencias++].frequencia = (char)frequencia;
+        }
+
+        // Guarda as contagens (da maior para a menor) e limpa as frequências usadas
+        for (uint32_t i = primeiraFrequencia; i < numFrequencias; i++)
+        {
+            FrequenciaComponente atual = { (*componentes).frequencias[i].frequencia, contagem[(unsigned char)(*componentes).frequencias[i].frequencia] };
+            contagem[(unsigned char)atual.frequencia] = 0;
+
+            uint32_t j = i;
+            while (j > primeiraFrequencia && (*componentes).frequencias[j - 1].quantidade < atual.quantidade)
+            {
+                (*componentes).frequencias[j] = (*componentes).frequencias[j - 1];
+                j--;
+            }
+            (*componentes).frequencias[j] = atual;
+        }
+
+        if (numFrequencias - primeiraFrequencia == 1) (*componentes).numMonofrequencia++;
+        else (*componentes).numMistas++;
+    }
+
+    (*componentes).inicioFrequencias[numComponentes] = numFrequencias;
+
+    free(pai);
+    free(tamanhoConjunto);
+
+    *erro = 0;
+    return componentes;
+}
+
+/**
+ * @brief Liberta as componentes.
+ *
+ * @param componentes Apontador para as componentes (pode ser NULL).
+ *
+ * @return NULL para indicar que as componentes foram libertadas com sucesso.
+ */
+Componentes *CC_libertarComponentes(Componentes *componentes)
+{
+    // Verifica se o apontador é válido
+    if (componentes == NULL) return NULL;
+
+    free((*componentes).componente);
+    free((*componentes).tamanho);
+    free((*componentes).representante);
+    free((*componentes).inicioFrequencias);
+    free((*componentes).frequencias);
+    free(componentes);
+
+    return NULL;
+}
+
+/**
+ * @brief Ordena as componentes por tamanho (da maior para a menor; em caso de empate, pelo número).
+ *
+ * @param componentes Apontador para as componentes.
+ * @param ordem Vetor ("numComponentes" posições) que recebe os números das componentes ordenados.
+ *
+ * @note Ordenação por contagem dos tamanhos, O(V + C).
+ *
+ * @return Número de componentes.
+ * @return "CC_ERRO_COMPONENTES_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ * @return "CC_ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int CC_ordenarComponentes(const Componentes *componentes, uint32_t *ordem)
+{
+    // Verifica se os apontadores são válidos
+    if (componentes == NULL || ordem == NULL) return CC_ERRO_COMPONENTES_PONTEIRO_INVALIDO;
+
+    // Número de componentes com tamanho maior do que cada tamanho
+    uint32_t *posicao = calloc((size_t)(*componentes).numVertices + 2, sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (posicao == NULL) return CC_ERRO_ALOCACAO_MEMORIA;
+
+    for (uint32_t c = 0; c < (*componentes).numComponentes; c++) posicao[(*componentes).tamanho[c]]++;
+
+    for (uint32_t t = (*componentes).numVertices + 1, soma = 0; t-- > 0; )
+    {
+        uint32_t quantidade = posicao[t];
+        posicao[t] = soma;
+        soma += quantidade;
+    }
+
+    for (uint32_t c = 0; c < (*componentes).numComponentes; c++) ordem[posicao[(*componentes).tamanho[c]]++] = c;
+
+    free(posicao);
+
+    return (int)(*componentes).numComponentes;
+}
+
+/**
+ * @brief Apresenta o resumo das componentes e as maiores componentes, com a mistura de frequências.
+ *
+ * @param grafo Apontador para o grafo compacto das componentes.
+ * @param componentes Apontador para as componentes.
+ * @param maximo Número de componentes a apresentar (<= 0 usa "CC_NUM_COMPONENTES_APRESENTAR").
+ *
+ * @return Número de componentes apresentadas.
+ * @return "CC_ERRO_GRAFO_PONTEIRO_INVALIDO" ou "CC_ERRO_COMPONENTES_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ * @return "CC_ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int CC_apresentarComponentes(const GrafoCompacto *grafo, const Componentes *componentes, int maximo)
+{
+    // Verifica se os apontadores são válidos
+    if (grafo == NULL) return CC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+    if (componentes == NULL) return CC_ERRO_COMPONENTES_PONTEIRO_INVALIDO;
+
+    uint32_t *ordem = malloc(((*componentes).numComponentes > 0 ? (*componentes).numComponentes : 1) * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (ordem == NULL) return CC_ERRO_ALOCACAO_MEMORIA;
+
+    CC_ordenarComponentes(componentes, ordem);
+
+    if (maximo <= 0) maximo = CC_NUM_COMPONENTES_APRESENTAR;
+    if ((uint32_t)maximo > (*componentes).numComponentes) maximo = (int)(*componentes).numComponentes;
+
+    printf("Componentes: %u (%u com uma só frequência, %u com várias frequências)\n\n", (*componentes).numComponentes, (*componentes).numMonofrequencia, (*componentes).numMistas);
+
+    for (int i = 0; i < maximo; i++)
+    {
+        uint32_t c = ordem[i];
+        uint32_t representante = (*componentes).representante[c];
+
+        printf("%d.ª: %u antena(s), a partir de '%c'(%d, %d) |", i + 1, (*componentes).tamanho[c], (*grafo).frequencias[representante], GC_coordenadaX(grafo, representante), GC_coordenadaY(grafo, representante));
+
+        for (uint32_t f = (*componentes).inicioFrequencias[c]; f < (*componentes).inicioFrequencias[c + 1]; f++)
+        {
+            printf(" %c: %u", (*componentes).frequencias[f].frequencia, (*componentes).frequencias[f].quantidade);
+        }
+        printf("\n");
+    }
+
+    free(ordem);
+
+    return maximo;
+}
@@ -0,0 +1,356 @@
+/**
+ * @file Fecho_Transitivo.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação do fecho transitivo (matriz de alcançabilidade por componentes) da cidade
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Fecho_Transitivo.h"
+
+#define FT_SEM_VALOR UINT32_MAX
+
+/**
+ * @brief Liberta a matriz e os vetores do fecho (o fecho fica por construir).
+ */
+static void limparFechoTransitivo(FechoTransitivo *fecho)
+{
+    free((*fecho).componente);
+    free((*fecho).tamanhoComponente);
+    free((*fecho).alcance);
+
+    (*fecho).componente = NULL;
+    (*fecho).tamanhoComponente = NULL;
+    (*fecho).alcance = NULL;
+    (*fecho).numAntenas = 0;
+    (*fecho).numComponentes = 0;
+    (*fecho).palavrasPorLinha = 0;
+    (*fecho).geracao = 0;
+}
+
+/**
+ * @brief Calcula as componentes fortemente conexas (algoritmo de Tarjan, iterativo).
+ *
+ * @param antenas Antenas da cidade, indexadas por "Vertice.indice".
+ * @param numAntenas Número de antenas.
+ * @param componente Vetor ("numAntenas" posições) que recebe a componente de cada antena.
+ * @param tamanhoComponente Vetor ("numAntenas" posições) que recebe o tamanho de cada componente.
+ * @param ordem, baixo, pilha, chamadas Vetores auxiliares ("numAntenas" posições).
+ * @param cursores Vetor auxiliar ("numAntenas" posições) com a próxima aresta a visitar de cada antena.
+ *
+ * @note As componentes são numeradas pela ordem em que terminam, pelo que as arestas entre
+ *       componentes diferentes vão sempre de um número maior para um menor.
+ *
+ * @return Número de componentes.
+ */
+static uint32_t calcularComponentes(Vertice **antenas, uint32_t numAntenas, uint32_t *componente, uint32_t *tamanhoComponente, uint32_t *ordem, uint32_t *baixo, uint32_t *pilha, uint32_t *chamadas, Aresta **cursores)
+{
+    uint32_t numComponentes = 0, contador = 0, topoPilha = 0, numChamadas = 0;
+
+    for (uint32_t i = 0; i < numAntenas; i++)
+    {
+        ordem[i] = FT_SEM_VALOR;
+        componente[i] = FT_SEM_VALOR;
+    }
+
+    for (uint32_t inicio = 0; inicio < numAntenas; inicio++)
+    {
+        if (ordem[inicio] != FT_SEM_VALOR) continue;
+
+        ordem[inicio] = baixo[inicio] = contador++;
+        pilha[topoPilha++] = inicio;
+        cursores[inicio] = (*antenas[inicio]).primeiraAresta;
+        chamadas[numChamadas++] = inicio;
+
+        while (numChamadas > 0)
+        {
+            uint32_t v = chamadas[numChamadas - 1];
+            Aresta *aresta = cursores[v];
+
+            if (aresta != NULL)
+            {
+                // Avança para a próxima aresta de "v"
+                cursores[v] = (*aresta).prox;
+                uint32_t w = (uint32_t)(*(*aresta).destino).indice;
+
+                if (ordem[w] == FT_SEM_VALOR)
+                {
+                    ordem[w] = baixo[w] = contador++;
+                    pilha[topoPilha++] = w;
+                    cursores[w] = (*antenas[w]).primeiraAresta;
+                    chamadas[numChamadas++] = w;
+                }
+                else if (componente[w] == FT_SEM_VALOR && ordem[w] < baixo[v])
+                {
+                    baixo[v] = ordem[w]; /* "w" ainda está na pilha */
+                }
+                continue;
+            }
+
+            // Todas as arestas de "v" foram visitadas
+            numChamadas--;
+
+            if (baixo[v] == ordem[v])
+            {
+                // "v" é a raiz de uma componente: retira-a da pilha
+                uint32_t w;
+                tamanhoComponente[numComponentes] = 0;
+
+                do
+                {
+                    w = pilha[--topoPilha];
+                    componente[w] = numComponentes;
+                    tamanhoComponente[numComponentes]++;
+
+                } while (w != v);
+
+                numComponentes++;
+            }
+
+            if (numChamadas > 0)
+            {
+                uint32_t pai = chamadas[numChamadas - 1];
+                if (baixo[v] < baixo[pai]) baixo[pai] = baixo[v];
+            }
+        }
+    }
+
+    return numComponentes;
+}
+
+/**
+ * @brief Cria o fecho transitivo de uma cidade (a matriz só é construída na primeira consulta).
+ *
+ * @param cidade Apontador para a cidade.
+ * @param limiteAntenas Número máximo de antenas para construir a matriz (<= 0 usa "FT_LIMITE_PREDEFINIDO").
+ * @param erro Apontador para a variável que recebe o código de erro (0 em caso de sucesso).
+ *
+ * @return Apontador para o fecho criado.
+ * @return NULL em caso de erro ("FT_ERRO_CIDADE_PONTEIRO_INVALIDO" ou "FT_ERRO_ALOCACAO_MEMORIA" em "erro").
+ */
+FechoTransitivo *FT_criarFechoTransitivo(Grafo *cidade, int limiteAntenas, int *erro)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL)
+    {
+        *erro = FT_ERRO_CIDADE_PONTEIRO_INVALIDO;
+        return NULL;
+    }
+
+    // Aloca o espaço na memória para o fecho (e inicializa as variáveis)
+    FechoTransitivo *fecho = calloc(1, sizeof(FechoTransitivo));
+
+    // Verifica se foi possível alocar a memória
+    if (fecho == NULL)
+    {
+        *erro = FT_ERRO_ALOCACAO_MEMORIA;
+        return NULL;
+    }
+
+    (*fecho).cidade = cidade;
+    (*fecho).limiteAntenas = (limiteAntenas > 0) ? limiteAntenas : FT_LIMITE_PREDEFINIDO;
+
+    *erro = 0;
+    return fecho;
+}
+
+/**
+ * @brief Liberta o fecho transitivo (a cidade não é libertada).
+ *
+ * @param fecho Apontador para o fecho (pode ser NULL).
+ *
+ * @return NULL para indicar que o fecho foi libertado com sucesso.
+ */
+FechoTransitivo *FT_libertarFechoTransitivo(FechoTransitivo *fecho)
+{
+    // Verifica se o apontador é válido
+    if (fecho == NULL) return NULL;
+
+    limparFechoTransitivo(fecho);
+    free(fecho);
+
+    return NULL;
+}
+
+/**
+ * @brief Reconstrói a matriz de alcançabilidade se a cidade tiver mudado desde a última construção.
+ *
+ * Calcula as componentes fortemente conexas e, por ordem crescente de componente (sucessoras
+ * primeiro), preenche a linha de cada componente com o seu próprio bit e o OU das linhas das
+ * componentes para onde tem arestas. Cada sucessora é juntada uma única vez por componente e,
+ * como a linha de "d" só tem bits até "d", só são percorridas as primeiras "d / 64 + 1" palavras.
+ *
+ * @param fecho Apontador para o fecho.
+ *
+ * @note Custo O(V + E + C * S / 64), com C componentes e S pares (componente, sucessora) distintos.
+ *
+ * @return 1 se a matriz foi reconstruída, 0 se já estava atualizada.
+ * @return "FT_ERRO_FECHO_PONTEIRO_INVALIDO" se o fecho for inválido.
+ * @return "FT_ERRO_LIMITE_ANTENAS" se a cidade tiver mais antenas do que "limiteAntenas".
+ * @return "FT_ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int FT_atualizarFechoTransitivo(FechoTransitivo *fecho)
+{
+    // Verifica se o apontador é válido
+    if (fecho == NULL) return FT_ERRO_FECHO_PONTEIRO_INVALIDO;
+
+    if ((*fecho).geracao == geracaoCidade((*fecho).cidade)) return 0;
+
+    limparFechoTransitivo(fecho);
+
+    if ((*(*fecho).cidade).numAntenas > (*fecho).limiteAntenas) return FT_ERRO_LIMITE_ANTENAS;
+
+    // A matriz inclui as arestas pendentes (ver "interligarAntenasPendente")
+    int resultado = materializarTodasArestas((*fecho).cidade);
+    if (resultado < 0) return resultado;
+
+    uint32_t numAntenas = (uint32_t)numerarAntenas((*fecho).cidade);
+    size_t posicoes = (numAntenas > 0) ? numAntenas : 1;
+
+    // Aloca os vetores auxiliares
+    Vertice **antenas = malloc(posicoes * sizeof(Vertice *));
+    Aresta **cursores = malloc(posicoes * sizeof(Aresta *));
+    uint32_t *ordem = malloc(posicoes * sizeof(uint32_t));
+    uint32_t *baixo = malloc(posicoes * sizeof(uint32_t));
+    uint32_t *pilha = malloc(posicoes * sizeof(uint32_t));
+    uint32_t *chamadas = malloc(posicoes * sizeof(uint32_t));
+    uint32_t *componente = malloc(posicoes * sizeof(uint32_t));
+    uint32_t *tamanhoComponente = malloc(posicoes * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (antenas == NULL || cursores == NULL || ordem == NULL || baixo == NULL || pilha == NULL || chamadas == NULL || componente == NULL || tamanhoComponente == NULL)
+    {
+        free(antenas); free(cursores); free(ordem); free(baixo);
+        free(pilha); free(chamadas); free(componente); free(tamanhoComponente);
+        return FT_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    for (Vertice *antenaAtual = (*(*fecho).cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        antenas[(*antenaAtual).indice] = antenaAtual;
+    }
+
+    uint32_t numComponentes = calcularComponentes(antenas, numAntenas, componente, tamanhoComponente, ordem, baixo, pilha, chamadas, cursores);
+    uint32_t palavrasPorLinha = (numComponentes + 63) / 64;
+    uint64_t *alcance = calloc((size_t)numComponentes * palavrasPorLinha + 1, sizeof(uint64_t));
+
+    if (alcance == NULL)
+    {
+        free(antenas); free(cursores); free(ordem); free(baixo);
+        free(pilha); free(chamadas); free(componente); free(tamanhoComponente);
+        return FT_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    // Agrupa as antenas por componente ("baixo" passa a ser o início de cada componente em "pilha")
+    uint32_t *inicioComponente = baixo;
+    uint32_t *membros = pilha;
+    uint32_t *ultimaJuncao = ordem; /* Última componente que juntou a linha de cada componente */
+
+    for (uint32_t c = 0, soma = 0; c < numComponentes; c++)
+    {
+        inicioComponente[c] = soma;
+        soma += tamanhoComponente[c];
+        ultimaJuncao[c] = FT_SEM_VALOR;
+    }
+    for (uint32_t v = 0; v < numAntenas; v++)
+    {
+        membros[inicioComponente[componente[v]]++] = v;
+    }
+
+    // Preenche as linhas por ordem crescente de componente (as sucessoras já estão completas)
+    for (uint32_t c = 0, posicao = 0; c < numComponentes; c++)
+    {
+        uint64_t *linha = &alcance[(size_t)c * palavrasPorLinha];
+        linha[c >> 6] |= 1ULL << (c & 63);
+        ultimaJuncao[c] = c;
+
+        for (uint32_t fim = posicao + tamanhoComponente[c]; posicao < fim; posicao++)
+        {
+            for (Aresta *arestaAtual = (*antenas[membros[posicao]]).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
+            {
+                uint32_t d = componente[(*(*arestaAtual).destino).indice];
+
+                if (ultimaJuncao[d] == c) continue;
+                ultimaJuncao[d] = c;
+
+                const uint64_t *linhaSucessora = &alcance[(size_t)d * palavrasPorLinha];
+                for (uint32_t p = 0; p <= (d >> 6); p++) linha[p] |= linhaSucessora[p];
+            }
+        }
+    }
+
+    free(antenas); free(cursores); free(ordem); free(baixo); free(pilha); free(chamadas);
+
+    (*fecho).numAntenas = numAntenas;
+    (*fecho).numComponentes = numComponentes;
+    (*fecho).palavrasPorLinha = palavrasPorLinha;
+    (*fecho).componente = componente;
+    (*fecho).tamanhoComponente = tamanhoComponente;
+    (*fecho).alcance = alcance;
+    (*fecho).geracao = geracaoCidade((*fecho).cidade);
+
+    return 1;
+}
+
+/**
+ * @brief Verifica se uma antena alcança outra (existe um caminho de "inicio" até "destino").
+ *
+ * @param fecho Apontador para o fecho da cidade das antenas.
+ * @param inicio Antena de origem.
+ * @param destino Antena de destino.
+ *
+ * @note Reconstrói a matriz se a cidade tiver mudado. Uma antena alcança-se sempre a si própria.
+ *
+ * @return 1 se "destino" for alcançável a partir de "inicio", 0 caso contrário.
+ * @return "FT_ERRO_ANTENA_INICIO_INVALIDA" ou "FT_ERRO_ANTENA_DESTINO_INVALIDA" se alguma antena for inválida.
+ * @return Erro de "FT_atualizarFechoTransitivo".
+ */
+int FT_alcancavel(FechoTransitivo *fecho, Vertice *inicio, Vertice *destino)
+{
+    int erro = FT_atualizarFechoTransitivo(fecho);
+    if (erro < 0) return erro;
+
+    // Verifica se os apontadores são válidos
+    if (inicio == NULL || (*inicio).indice < 0 || (uint32_t)(*inicio).indice >= (*fecho).numAntenas) return FT_ERRO_ANTENA_INICIO_INVALIDA;
+    if (destino == NULL || (*destino).indice < 0 || (uint32_t)(*destino).indice >= (*fecho).numAntenas) return FT_ERRO_ANTENA_DESTINO_INVALIDA;
+
+    uint32_t c = (*fecho).componente[(*inicio).indice];
+    uint32_t d = (*fecho).componente[(*destino).indice];
+
+    return ((*fecho).alcance[(size_t)c * (*fecho).palavrasPorLinha + (d >> 6)] >> (d & 63)) & 1;
+}
+
+/**
+ * @brief Conta as antenas alcançáveis a partir de uma antena (incluindo a própria).
+ *
+ * @param fecho Apontador para o fecho da cidade da antena.
+ * @param inicio Antena de origem.
+ *
+ * @return Número de antenas alcançáveis.
+ * @return "FT_ERRO_ANTENA_INICIO_INVALIDA" se a antena for inválida.
+ * @return Erro de "FT_atualizarFechoTransitivo".
+ */
+int FT_contarAlcancaveis(FechoTransitivo *fecho, Vertice *inicio)
+{
+    int erro = FT_atualizarFechoTransitivo(fecho);
+    if (erro < 0) return erro;
+
+    // Verifica se o apontador é válido
+    if (inicio == NULL || (*inicio).indice < 0 || (uint32_t)(*inicio).indice >= (*fecho).numAntenas) return FT_ERRO_ANTENA_INICIO_INVALIDA;
+
+    uint32_t c = (*fecho).componente[(*inicio).indice];
+    const uint64_t *linha = &(*fecho).alcance[(size_t)c * (*fecho).palavrasPorLinha];
+    int total = 0;
+
+    for (uint32_t p = 0; p <= (c >> 6); p++)
+    {
+        for (uint64_t palavra = linha[p]; palavra != 0; palavra &= palavra - 1)
+        {
+            total += (int)(*fecho).tamanhoComponente[p * 64 + __builtin_ctzll(palavra)];
+        }
+    }
+
+    return total;
+}
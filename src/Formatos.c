@@ -0,0 +1,1037 @@
+/**
+ * @file Formatos.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação dos formatos alternativos dos ficheiros de mapas
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Formatos.h"
+
+/*---- Leitura e escrita RLE -------------------------------------------------------------------------------------------------*/
+
+/**
+ * @struct FM_Leitor
+ * @brief Leitura de um ficheiro RLE por blocos (sem uma chamada à biblioteca por caracter).
+ */
+typedef struct FM_Leitor
+{
+    FILE *ficheiro;
+    char *buffer;
+    size_t posicao;
+    size_t quantidade;
+
+} FM_Leitor;
+
+/**
+ * @struct FM_Escritor
+ * @brief Escrita de símbolos RLE, com mudança de linha a cada "FM_COLUNAS_RLE" caracteres.
+ */
+typedef struct FM_Escritor
+{
+    FILE *ficheiro;
+    int coluna;
+
+} FM_Escritor;
+
+/**
+ * @brief Verifica se um caracter ocupa a posição (antena ou nefasto).
+ */
+static inline bool FM_posicaoOcupada(char caracter)
+{
+    return (caracter >= 'A' && caracter <= 'Z') || (caracter >= 'a' && caracter <= 'z') || caracter == '#';
+}
+
+/**
+ * @brief Lê o caracter seguinte do ficheiro.
+ *
+ * @return O caracter lido ou EOF no fim do ficheiro.
+ */
+static inline int FM_lerCaracter(FM_Leitor *leitor)
+{
+    if ((*leitor).posicao == (*leitor).quantidade)
+    {
+        (*leitor).quantidade = fread((*leitor).buffer, 1, FM_TAMANHO_LEITURA, (*leitor).ficheiro);
+        (*leitor).posicao = 0;
+
+        if ((*leitor).quantidade == 0) return EOF;
+    }
+
+    return (unsigned char)(*leitor).buffer[(*leitor).posicao++];
+}
+
+/**
+ * @brief Abre um mapa RLE e lê o cabeçalho.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "FM_ERRO_ABRIR_FICHEIRO", "FM_ERRO_FORMATO_INVALIDO" ou "FM_ERRO_ALOCACAO_MEMORIA" em caso de erro.
+ */
+static int FM_abrirMapaRLE(const char *localizacaoFicheiro, FM_Leitor *leitor, int *largura, int *altura)
+{
+    // Abre o ficheiro para leitura
+    (*leitor).ficheiro = fopen(localizacaoFicheiro, "r");
+
+    // Verifica se foi possível abrir o ficheiro
+    if ((*leitor).ficheiro == NULL) return FM_ERRO_ABRIR_FICHEIRO;
+
+    // Lê o cabeçalho ("RLE1 largura altura")
+    if (fscanf((*leitor).ficheiro, FM_CABECALHO_RLE " %d %d", largura, altura) != 2 || *largura < 0 || *altura < 0)
+    {
+        fclose((*leitor).ficheiro);
+        return FM_ERRO_FORMATO_INVALIDO;
+    }
+
+    (*leitor).buffer = malloc(FM_TAMANHO_LEITURA);
+    (*leitor).posicao = (*leitor).quantidade = 0;
+
+    // Verifica se foi possível alocar a memória
+    if ((*leitor).buffer == NULL)
+    {
+        fclose((*leitor).ficheiro);
+        return FM_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Fecha um mapa RLE aberto com "FM_abrirMapaRLE".
+ */
+static void FM_fecharMapaRLE(FM_Leitor *leitor)
+{
+    free((*leitor).buffer);
+    fclose((*leitor).ficheiro);
+}
+
+/**
+ * @brief Lê o símbolo seguinte (com o número de repetições), ignorando as mudanças de linha.
+ *
+ * @return 1 se foi lido um símbolo.
+ * @return 0 no fim do ficheiro.
+ * @return "FM_ERRO_FORMATO_INVALIDO" se o símbolo for inválido.
+ */
+static int FM_lerSimboloRLE(FM_Leitor *leitor, int *repeticoes, char *simbolo)
+{
+    int caracter;
+
+    do caracter = FM_lerCaracter(leitor);
+    while (caracter == '\n' || caracter == '\r' || caracter == ' ' || caracter == '\t');
+
+    if (caracter == EOF) return 0;
+
+    // Número de repetições (opcional)
+    int64_t numero = -1;
+    while (caracter >= '0' && caracter <= '9')
+    {
+        numero = ((numero < 0) ? 0 : numero * 10) + (caracter - '0');
+        if (numero > INT32_MAX) return FM_ERRO_FORMATO_INVALIDO;
+        caracter = FM_lerCaracter(leitor);
+    }
+
+    if (numero == 0) return FM_ERRO_FORMATO_INVALIDO;
+    if (caracter != '.' && caracter != '$' && caracter != '!' && !FM_posicaoOcupada((char)caracter)) return FM_ERRO_FORMATO_INVALIDO;
+
+    *repeticoes = (numero < 0) ? 1 : (int)numero;
+    *simbolo = (char)caracter;
+
+    return 1;
+}
+
+/**
+ * @brief Escreve um símbolo RLE (precedido do número de repetições, se for maior do que 1).
+ */
+static int FM_escreverSimboloRLE(FM_Escritor *escritor, int repeticoes, char simbolo)
+{
+    int escritos = (repeticoes > 1) ? fprintf((*escritor).ficheiro, "%d%c", repeticoes, simbolo) : (fputc(simbolo, (*escritor).ficheiro) == EOF ? -1 : 1);
+
+    if (escritos < 0) return FM_ERRO_ESCRITA;
+
+    (*escritor).coluna += escritos;
+    if ((*escritor).coluna >= FM_COLUNAS_RLE)
+    {
+        if (fputc('\n', (*escritor).ficheiro) == EOF) return FM_ERRO_ESCRITA;
+        (*escritor).coluna = 0;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Percorre as posições ocupadas de um mapa RLE, saltando diretamente as posições vazias.
+ *
+ * @param localizacaoFicheiro Caminho do mapa RLE.
+ * @param funcao Função chamada para cada posição ocupada (antena ou '#'), por ordem (y, x).
+ * @param contexto Apontador passado a "funcao".
+ * @param largura Apontador opcional (pode ser NULL) que recebe a largura do mapa.
+ * @param altura Apontador opcional (pode ser NULL) que recebe a altura do mapa.
+ *
+ * @note O custo é proporcional ao tamanho do ficheiro RLE (e não ao número de posições da grelha).
+ *
+ * @return Número de posições ocupadas.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" se não for possível abrir o ficheiro.
+ * @return "FM_ERRO_FORMATO_INVALIDO" se o ficheiro não for um mapa RLE válido (ou sair da grelha).
+ * @return "FM_ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ * @return O valor negativo devolvido por "funcao", se a interromper.
+ */
+int FM_percorrerMapaRLE(const char *localizacaoFicheiro, FuncaoPosicaoRLE funcao, void *contexto, int *largura, int *altura)
+{
+    FM_Leitor leitor;
+    int larguraMapa, alturaMapa;
+    int resultado = FM_abrirMapaRLE(localizacaoFicheiro, &leitor, &larguraMapa, &alturaMapa);
+
+    if (resultado < 0) return resultado;
+
+    int x = 0, y = 0, repeticoes, ocupadas = 0;
+    char simbolo = '\0';
+
+    while (resultado >= 0 && (resultado = FM_lerSimboloRLE(&leitor, &repeticoes, &simbolo)) == 1 && simbolo != '!')
+    {
+        if (simbolo == '$')
+        {
+            y += repeticoes;
+            x = 0;
+            if (y > alturaMapa) resultado = FM_ERRO_FORMATO_INVALIDO;
+            continue;
+        }
+
+        // Posições fora da grelha
+        if (repeticoes > larguraMapa - x || (simbolo != '.' && y >= alturaMapa))
+        {
+            resultado = FM_ERRO_FORMATO_INVALIDO;
+            break;
+        }
+
+        if (simbolo != '.' && funcao != NULL)
+        {
+            for (int i = 0; i < repeticoes && resultado >= 0; i++) resultado = funcao(simbolo, x + i, y, contexto);
+        }
+        if (simbolo != '.') ocupadas += repeticoes;
+        x += repeticoes;
+    }
+
+    // Fim do ficheiro sem '!'
+    if (resultado == 0) resultado = FM_ERRO_FORMATO_INVALIDO;
+
+    FM_fecharMapaRLE(&leitor);
+
+    if (largura != NULL) *largura = larguraMapa;
+    if (altura != NULL) *altura = alturaMapa;
+
+    return (resultado < 0) ? resultado : ocupadas;
+}
+
+/*---- Conversores -----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Converte um mapa de texto (grelha de caracteres) para o formato RLE.
+ *
+ * O mapa é lido duas vezes: a primeira mede a grelha (cabeçalho) e a segunda escreve os símbolos, linha a linha.
+ * Os caracteres que não são antenas nem '#' são guardados como posições vazias.
+ *
+ * @param localizacaoTexto Caminho do mapa de texto.
+ * @param localizacaoRLE Caminho do mapa RLE a criar (ou substituir).
+ *
+ * @return Número de posições ocupadas.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" se não for possível abrir ou criar algum dos ficheiros.
+ * @return "FM_ERRO_ESCRITA" se ocorrer um erro de escrita.
+ */
+int FM_converterTextoRLE(const char *localizacaoTexto, const char *localizacaoRLE)
+{
+    // Abre o ficheiro para leitura
+    FILE *texto = fopen(localizacaoTexto, "r");
+
+    // Verifica se foi possível abrir o ficheiro
+    if (texto == NULL) return FM_ERRO_ABRIR_FICHEIRO;
+
+    // Variáveis necessárias para leitura (com getline)
+    char *linha = NULL;
+    size_t tamanho = 0;
+    ssize_t lidos;
+
+    // 1.ª leitura: dimensões da grelha
+    int largura = 0, altura = 0;
+
+    while ((lidos = getline(&linha, &tamanho, texto)) != -1)
+    {
+        while (lidos > 0 && (linha[lidos - 1] == '\n' || linha[lidos - 1] == '\r')) lidos--;
+        if (lidos > largura) largura = (int)lidos;
+        altura++;
+    }
+
+    FM_Escritor escritor = { fopen(localizacaoRLE, "w"), 0 };
+
+    if (escritor.ficheiro == NULL)
+    {
+        free(linha);
+        fclose(texto);
+        return FM_ERRO_ABRIR_FICHEIRO;
+    }
+
+    // 2.ª leitura: símbolos (as linhas e posições vazias só são escritas antes de uma posição ocupada)
+    int resultado = (fprintf(escritor.ficheiro, "%s %d %d\n", FM_CABECALHO_RLE, largura, altura) < 0) ? FM_ERRO_ESCRITA : 0;
+    int linhasPendentes = 0, ocupadas = 0;
+
+    rewind(texto);
+
+    for (int y = 0; resultado == 0 && (lidos = getline(&linha, &tamanho, texto)) != -1; y++)
+    {
+        while (lidos > 0 && (linha[lidos - 1] == '\n' || linha[lidos - 1] == '\r')) lidos--;
+        if (y > 0) linhasPendentes++;
+
+        int vazias = 0;
+
+        for (int x = 0; x < lidos && resultado == 0; )
+        {
+            if (!FM_posicaoOcupada(linha[x]))
+            {
+                vazias++;
+                x++;
+                continue;
+            }
+
+            // Sequência de posições iguais
+            int fim = x + 1;
+            while (fim < lidos && linha[fim] == linha[x]) fim++;
+
+            if (linhasPendentes > 0) resultado = FM_escreverSimboloRLE(&escritor, linhasPendentes, '$');
+            if (resultado == 0 && vazias > 0) resultado = FM_escreverSimboloRLE(&escritor, vazias, '.');
+            if (resultado == 0) resultado = FM_escreverSimboloRLE(&escritor, fim - x, linha[x]);
+
+            ocupadas += fim - x;
+            linhasPendentes = vazias = 0;
+            x = fim;
+        }
+    }
+
+    if (resultado == 0 && fputs("!\n", escritor.ficheiro) == EOF) resultado = FM_ERRO_ESCRITA;
+    if (fclose(escritor.ficheiro) != 0 && resultado == 0) resultado = FM_ERRO_ESCRITA;
+
+    free(linha);
+    fclose(texto);
+
+    return (resultado < 0) ? resultado : ocupadas;
+}
+
+/**
+ * @brief Converte um mapa RLE para um mapa de texto (grelha de caracteres, com '.' nas posições vazias).
+ *
+ * Cada linha da grelha é preenchida num só buffer e escrita quando o mapa passa à linha seguinte.
+ *
+ * @param localizacaoRLE Caminho do mapa RLE.
+ * @param localizacaoTexto Caminho do mapa de texto a criar (ou substituir).
+ *
+ * @note Todas as linhas são escritas com a largura do mapa.
+ *
+ * @return Número de posições ocupadas.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" se não for possível abrir ou criar algum dos ficheiros.
+ * @return "FM_ERRO_FORMATO_INVALIDO" se o ficheiro não for um mapa RLE válido.
+ * @return "FM_ERRO_ESCRITA" se ocorrer um erro de escrita.
+ * @return "FM_ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int FM_converterRLETexto(const char *localizacaoRLE, const char *localizacaoTexto)
+{
+    FM_Leitor leitor;
+    int largura, altura;
+    int resultado = FM_abrirMapaRLE(localizacaoRLE, &leitor, &largura, &altura);
+
+    if (resultado < 0) return resultado;
+
+    // Buffer de uma linha (posições + mudança de linha)
+    char *linha = malloc((size_t)largura + 1);
+    FILE *texto = fopen(localizacaoTexto, "w");
+
+    if (linha == NULL || texto == NULL)
+    {
+        free(linha);
+        if (texto != NULL) fclose(texto);
+        FM_fecharMapaRLE(&leitor);
+        return (linha == NULL) ? FM_ERRO_ALOCACAO_MEMORIA : FM_ERRO_ABRIR_FICHEIRO;
+    }
+
+    memset(linha, '.', (size_t)largura);
+    linha[largura] = '\n';
+
+    int x = 0, y = 0, repeticoes, ocupadas = 0;
+    char simbolo = '\0';
+
+    while ((resultado = FM_lerSimboloRLE(&leitor, &repeticoes, &simbolo)) == 1 && simbolo != '!')
+    {
+        if (simbolo == '$')
+        {
+            if (y + repeticoes > altura)
+            {
+                resultado = FM_ERRO_FORMATO_INVALIDO;
+                break;
+            }
+
+            // Escreve a linha atual e as linhas vazias seguintes
+            for (int i = 0; i < repeticoes && resultado >= 0; i++, y++)
+            {
+                if (fwrite(linha, 1, (size_t)largura + 1, texto) != (size_t)largura + 1) resultado = FM_ERRO_ESCRITA;
+                if (i == 0) memset(linha, '.', (size_t)largura);
+            }
+            x = 0;
+            continue;
+        }
+
+        if (repeticoes > largura - x || (simbolo != '.' && y >= altura))
+        {
+            resultado = FM_ERRO_FORMATO_INVALIDO;
+            break;
+        }
+
+        if (simbolo != '.')
+        {
+            memset(linha + x, simbolo, (size_t)repeticoes);
+            ocupadas += repeticoes;
+        }
+        x += repeticoes;
+    }
+
+    if (resultado == 0) resultado = FM_ERRO_FORMATO_INVALIDO; /* Fim do ficheiro sem '!' */
+
+    // Escreve a última linha e as linhas vazias do fim do mapa
+    for (; resultado >= 0 && y < altura; y++)
+    {
+        if (fwrite(linha, 1, (size_t)largura + 1, texto) != (size_t)largura + 1) resultado = FM_ERRO_ESCRITA;
+        memset(linha, '.', (size_t)largura);
+    }
+
+    if (fclose(texto) != 0 && resultado >= 0) resultado = FM_ERRO_ESCRITA;
+    free(linha);
+    FM_fecharMapaRLE(&leitor);
+
+    return (resultado < 0) ? resultado : ocupadas;
+}
+
+/*---- Carregamento ----------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @struct FM_Carregamento
+ * @brief Estado do carregamento de um mapa RLE (último elemento inserido, para inserir no fim).
+ */
+typedef struct FM_Carregamento
+{
+    Grafo *cidade;
+    Vertice *ultimaAntena;
+
+    Rede *rede;
+    Antena *ultimaAntenaRede;
+    Nefasto *ultimoNefasto;
+
+    RegistoAntena *lote;
+    int numLote;
+    int capacidadeLote;
+
+} FM_Carregamento;
+
+/**
+ * @brief Acrescenta uma antena ao lote do carregamento (aumentando-o se for preciso).
+ */
+static int FM_acrescentarLote(FM_Carregamento *carregamento, char simbolo, int x, int y)
+{
+    // Garante espaço no lote
+    if ((*carregamento).numLote == (*carregamento).capacidadeLote)
+    {
+        int capacidade = (*carregamento).capacidadeLote * 2;
+        RegistoAntena *temp = realloc((*carregamento).lote, capacidade * sizeof(RegistoAntena));
+        if (temp == NULL) return FM_ERRO_ALOCACAO_MEMORIA;
+
+        (*carregamento).lote = temp;
+        (*carregamento).capacidadeLote = capacidade;
+    }
+
+    (*carregamento).lote[(*carregamento).numLote++] = (RegistoAntena){ simbolo, x, y };
+
+    return 0;
+}
+
+/**
+ * @brief Insere uma antena na cidade (no fim da lista, pela ordem do mapa, ou no lote se a cidade não estava vazia).
+ */
+static int FM_carregarVertice(char simbolo, int x, int y, void *contexto)
+{
+    FM_Carregamento *carregamento = contexto;
+    int erro = 0;
+
+    if (simbolo == '#') return 0;
+
+    // Cidade com antenas: inserção no lote
+    if ((*carregamento).lote != NULL) return FM_acrescentarLote(carregamento, simbolo, x, y);
+
+    (*carregamento).ultimaAntena = adicionarAntenaFim((*carregamento).cidade, (*carregamento).ultimaAntena, simbolo, x, y, &erro);
+
+    return ((*carregamento).ultimaAntena == NULL) ? erro : 0;
+}
+
+/**
+ * @brief Insere uma antena na rede (no fim da lista ou, nos outros modos da rede, no lote).
+ */
+static int FM_carregarAntena(char simbolo, int x, int y, void *contexto)
+{
+    FM_Carregamento *carregamento = contexto;
+    int erro = 0;
+
+    if (simbolo == '#') return 0;
+
+    // Rede com lista ligada: inserção no fim
+    if ((*carregamento).lote == NULL)
+    {
+        (*carregamento).ultimaAntenaRede = LL_adicionarAntenaFim((*carregamento).rede, (*carregamento).ultimaAntenaRede, simbolo, x, y, &erro);
+        return ((*carregamento).ultimaAntenaRede == NULL) ? erro : 0;
+    }
+
+    return FM_acrescentarLote(carregamento, simbolo, x, y);
+}
+
+/**
+ * @brief Insere um efeito nefasto na rede (no fim da lista, pela ordem do mapa).
+ */
+static int FM_carregarNefasto(char simbolo, int x, int y, void *contexto)
+{
+    FM_Carregamento *carregamento = contexto;
+    int erro = 0;
+
+    if (simbolo != '#') return 0;
+
+    (*carregamento).ultimoNefasto = LL_adicionarNefastoFim((*carregamento).rede, (*carregamento).ultimoNefasto, x, y, &erro);
+
+    return ((*carregamento).ultimoNefasto == NULL) ? erro : 0;
+}
+
+/**
+ * @brief Carrega as antenas de um mapa RLE para a cidade (equivalente a "carregarCidade").
+ *
+ * Se a cidade estiver vazia, as antenas são inseridas diretamente no fim da lista (o mapa já está ordenado);
+ * caso contrário, são inseridas num só lote ("adicionarAntenasLote"), que ignora as posições já ocupadas.
+ *
+ * @param cidade Ponteiro para a estrutura do grafo que representa a cidade.
+ * @param localizacaoFicheiro Caminho do mapa RLE.
+ *
+ * @note As dimensões do mapa ficam registadas em "largura" e "altura" da cidade.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" ou "FM_ERRO_FORMATO_INVALIDO" se não for possível ler o mapa.
+ * @return "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int FM_carregarCidadeRLE(Grafo *cidade, const char *localizacaoFicheiro)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    FM_Carregamento carregamento = { .cidade = cidade };
+
+    // Cidade com antenas: as do mapa são juntas num lote (a inserção no fim só mantém a ordem numa cidade vazia)
+    if ((*cidade).numAntenas > 0)
+    {
+        carregamento.capacidadeLote = 1024;
+        carregamento.lote = malloc(carregamento.capacidadeLote * sizeof(RegistoAntena));
+
+        // Verifica se foi possível alocar a memória
+        if (carregamento.lote == NULL) return ERRO_ALOCACAO_MEMORIA;
+    }
+
+    int resultado = FM_percorrerMapaRLE(localizacaoFicheiro, FM_carregarVertice, &carregamento, &(*cidade).largura, &(*cidade).altura);
+
+    if (resultado >= 0 && carregamento.lote != NULL) resultado = adicionarAntenasLote(cidade, carregamento.lote, carregamento.numLote, NULL);
+    free(carregamento.lote);
+
+    return (resultado < 0) ? resultado : 0;
+}
+
+/**
+ * @brief Carrega as antenas de um mapa RLE para a rede (equivalente a "LL_carregarAntenas").
+ *
+ * Na rede com lista ligada, as antenas são inseridas no fim (o mapa já está ordenado); nos outros
+ * modos (vetorial ou partilhada), são inseridas num só lote.
+ *
+ * @param rede Ponteiro para a estrutura da rede onde serão adicionadas as antenas.
+ * @param localizacaoFicheiro Caminho do mapa RLE.
+ *
+ * @note As dimensões do mapa ficam registadas em "largura" e "altura" da rede (e da cidade partilhada).
+ *
+ * @return 0 em caso de sucesso.
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se o ponteiro para a rede for inválido.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" ou "FM_ERRO_FORMATO_INVALIDO" se não for possível ler o mapa.
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória.
+ */
+int FM_carregarAntenasRLE(Rede *rede, const char *localizacaoFicheiro)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    FM_Carregamento carregamento = { .rede = rede };
+
+    // Modos sem lista ligada: as antenas são juntas num lote
+    if ((*rede).vetorial || (*rede).cidade != NULL)
+    {
+        carregamento.capacidadeLote = 1024;
+        carregamento.lote = malloc(carregamento.capacidadeLote * sizeof(RegistoAntena));
+
+        // Verifica se foi possível alocar a memória
+        if (carregamento.lote == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    int largura, altura;
+    int resultado = FM_percorrerMapaRLE(localizacaoFicheiro, FM_carregarAntena, &carregamento, &largura, &altura);
+
+    if (resultado >= 0 && carregamento.lote != NULL) resultado = LL_adicionarAntenasLote(rede, carregamento.lote, carregamento.numLote, NULL);
+    free(carregamento.lote);
+
+    if (resultado < 0) return resultado;
+
+    (*rede).largura = largura;
+    (*rede).altura = altura;
+    if ((*rede).cidade != NULL)
+    {
+        (*(*rede).cidade).largura = largura;
+        (*(*rede).cidade).altura = altura;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Carrega os efeitos nefastos ('#') de um mapa RLE para a rede (equivalente a "LL_carregarNefastos").
+ *
+ * @param rede Ponteiro para a estrutura da rede onde serão adicionados os efeitos nefastos.
+ * @param localizacaoFicheiro Caminho do mapa RLE.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se o ponteiro para a rede for inválido.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" ou "FM_ERRO_FORMATO_INVALIDO" se não for possível ler o mapa.
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória.
+ */
+int FM_carregarNefastosRLE(Rede *rede, const char *localizacaoFicheiro)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    FM_Carregamento carregamento = { .rede = rede };
+    int resultado = FM_percorrerMapaRLE(localizacaoFicheiro, FM_carregarNefasto, &carregamento, NULL, NULL);
+
+    return (resultado < 0) ? resultado : 0;
+}
+
+/*---- Listas de coordenadas -------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Verifica se um caracter separa os campos de uma lista de coordenadas.
+ */
+static inline bool FM_separadorCoordenadas(char caracter)
+{
+    return caracter == ',' || caracter == ';' || caracter == '\t';
+}
+
+/**
+ * @brief Avança os espaços (não inclui as tabulações, que são separadores).
+ */
+static inline const char *FM_saltarEspacos(const char *posicao, const char *fim)
+{
+    while (posicao < fim && *posicao == ' ') posicao++;
+
+    return posicao;
+}
+
+/**
+ * @brief Lê um inteiro não negativo (sem sinal, até INT32_MAX).
+ *
+ * @return Posição seguinte ao número ou NULL se não existir um número válido.
+ */
+static inline const char *FM_lerNatural(const char *posicao, const char *fim, int *valor)
+{
+    if (posicao == fim || *posicao < '0' || *posicao > '9') return NULL;
+
+    int64_t numero = 0;
+    do
+    {
+        numero = numero * 10 + (*posicao - '0');
+        if (numero > INT32_MAX) return NULL;
+        posicao++;
+
+    } while (posicao < fim && *posicao >= '0' && *posicao <= '9');
+
+    *valor = (int)numero;
+
+    return posicao;
+}
+
+/**
+ * @brief Lê um registo (frequência, x, y) de uma linha.
+ *
+ * @return "fim" se a linha for um registo válido; outro valor (ou NULL) caso contrário.
+ */
+static const char *FM_lerRegistoCoordenadas(const char *posicao, const char *fim, RegistoAntena *registo)
+{
+    char frequencia = *posicao++;
+
+    if (!(frequencia >= 'A' && (frequencia <= 'Z' || (frequencia >= 'a' && frequencia <= 'z')))) return NULL;
+
+    posicao = FM_saltarEspacos(posicao, fim);
+    if (posicao == fim || !FM_separadorCoordenadas(*posicao)) return NULL;
+
+    posicao = FM_lerNatural(FM_saltarEspacos(posicao + 1, fim), fim, &(*registo).x);
+    if (posicao == NULL) return NULL;
+
+    posicao = FM_saltarEspacos(posicao, fim);
+    if (posicao == fim || !FM_separadorCoordenadas(*posicao)) return NULL;
+
+    posicao = FM_lerNatural(FM_saltarEspacos(posicao + 1, fim), fim, &(*registo).y);
+    if (posicao == NULL) return NULL;
+
+    posicao = FM_saltarEspacos(posicao, fim);
+    if (posicao < fim && *posicao == '\r') posicao++;
+
+    (*registo).frequencia = frequencia;
+
+    return posicao;
+}
+
+/**
+ * @brief Lê uma lista de coordenadas (CSV/TSV) para um vetor de registos.
+ *
+ * O ficheiro é lido de uma só vez e os números são convertidos diretamente (sem "sscanf" nem "strtol").
+ * Durante a leitura é verificado se os registos estão por ordem (y, x) e sem repetições.
+ *
+ * @param localizacaoFicheiro Caminho da lista de coordenadas.
+ * @param registos Apontador que recebe o vetor de registos (libertado com "free" por quem chama).
+ * @param resumo Apontador opcional (pode ser NULL) que recebe "numRegistos", "ordenado" e "linhaErro".
+ *
+ * @return Número de registos lidos.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" se não for possível ler o ficheiro.
+ * @return "FM_ERRO_FORMATO_INVALIDO" se alguma linha não for um registo válido (ver "linhaErro").
+ * @return "FM_ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int FM_lerCoordenadas(const char *localizacaoFicheiro, RegistoAntena **registos, ResumoCoordenadas *resumo)
+{
+    ResumoCoordenadas leitura = { .ordenado = true };
+
+    *registos = NULL;
+    if (resumo != NULL) *resumo = leitura;
+
+    // Abre o ficheiro para leitura
+    FILE *ficheiro = fopen(localizacaoFicheiro, "rb");
+
+    // Verifica se foi possível abrir o ficheiro
+    if (ficheiro == NULL) return FM_ERRO_ABRIR_FICHEIRO;
+
+    // Lê o ficheiro inteiro
+    long tamanho = (fseek(ficheiro, 0, SEEK_END) == 0) ? ftell(ficheiro) : -1;
+    char *dados = (tamanho >= 0) ? malloc((size_t)tamanho + 1) : NULL;
+
+    if (dados == NULL || fseek(ficheiro, 0, SEEK_SET) != 0 || fread(dados, 1, (size_t)tamanho, ficheiro) != (size_t)tamanho)
+    {
+        free(dados);
+        fclose(ficheiro);
+        return (tamanho < 0) ? FM_ERRO_ABRIR_FICHEIRO : FM_ERRO_ALOCACAO_MEMORIA;
+    }
+    fclose(ficheiro);
+
+    const char *fim = dados + tamanho;
+
+    // O número de linhas limita o número de registos
+    size_t numLinhas = 1;
+    for (const char *posicao = dados; (posicao = memchr(posicao, '\n', fim - posicao)) != NULL; posicao++) numLinhas++;
+
+    RegistoAntena *vetor = malloc(numLinhas * sizeof(RegistoAntena));
+
+    // Verifica se foi possível alocar a memória
+    if (vetor == NULL)
+    {
+        free(dados);
+        return FM_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    int quantidade = 0, linha = 0;
+
+    for (const char *posicao = dados; posicao < fim; )
+    {
+        const char *fimLinha = memchr(posicao, '\n', fim - posicao);
+        if (fimLinha == NULL) fimLinha = fim;
+
+        const char *inicio = FM_saltarEspacos(posicao, fimLinha);
+        linha++;
+        posicao = fimLinha + 1;
+
+        // Linhas vazias, comentários e cabeçalho
+        if (inicio == fimLinha || *inicio == '\r' || *inicio == '#') continue;
+        if (linha == 1 && inicio + 1 < fimLinha && inicio[1] != ' ' && inicio[1] != '\r' && !FM_separadorCoordenadas(inicio[1])) continue;
+
+        RegistoAntena *registo = &vetor[quantidade];
+
+        if (FM_lerRegistoCoordenadas(inicio, fimLinha, registo) != fimLinha)
+        {
+            leitura.linhaErro = linha;
+            break;
+        }
+
+        // Ordem (y, x) estritamente crescente
+        if (quantidade > 0 && leitura.ordenado)
+        {
+            const RegistoAntena *anterior = registo - 1;
+            leitura.ordenado = ((*registo).y > (*anterior).y || ((*registo).y == (*anterior).y && (*registo).x > (*anterior).x));
+        }
+        quantidade++;
+    }
+
+    free(dados);
+
+    leitura.numRegistos = quantidade;
+    if (resumo != NULL) *resumo = leitura;
+
+    if (leitura.linhaErro != 0)
+    {
+        free(vetor);
+        return FM_ERRO_FORMATO_INVALIDO;
+    }
+
+    *registos = vetor;
+
+    return quantidade;
+}
+
+/**
+ * @brief Converte um mapa de texto (grelha de caracteres) para uma lista de coordenadas (CSV).
+ *
+ * @param localizacaoTexto Caminho do mapa de texto.
+ * @param localizacaoCoordenadas Caminho da lista de coordenadas a criar (ou substituir).
+ *
+ * @note Os registos são escritos por ordem (y, x), pelo que o carregamento usa a inserção direta no fim.
+ *
+ * @return Número de antenas escritas.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" se não for possível abrir ou criar algum dos ficheiros.
+ * @return "FM_ERRO_ESCRITA" se ocorrer um erro de escrita.
+ */
+int FM_converterTextoCoordenadas(const char *localizacaoTexto, const char *localizacaoCoordenadas)
+{
+    // Abre os ficheiros
+    FILE *texto = fopen(localizacaoTexto, "r");
+    FILE *coordenadas = (texto != NULL) ? fopen(localizacaoCoordenadas, "w") : NULL;
+
+    // Verifica se foi possível abrir os ficheiros
+    if (coordenadas == NULL)
+    {
+        if (texto != NULL) fclose(texto);
+        return FM_ERRO_ABRIR_FICHEIRO;
+    }
+
+    // Variáveis necessárias para leitura (com getline)
+    char *linha = NULL;
+    size_t tamanho = 0;
+    ssize_t lidos;
+
+    int resultado = (fprintf(coordenadas, "%s\n", FM_CABECALHO_COORDENADAS) < 0) ? FM_ERRO_ESCRITA : 0;
+    int numAntenas = 0;
+
+    for (int y = 0; resultado == 0 && (lidos = getline(&linha, &tamanho, texto)) != -1; y++)
+    {
+        for (int x = 0; x < lidos && resultado == 0; x++)
+        {
+            if (linha[x] >= 'A' && (linha[x] <= 'Z' || (linha[x] >= 'a' && linha[x] <= 'z')))
+            {
+                if (fprintf(coordenadas, "%c,%d,%d\n", linha[x], x, y) < 0) resultado = FM_ERRO_ESCRITA;
+                numAntenas++;
+            }
+        }
+    }
+
+    if (fclose(coordenadas) != 0 && resultado == 0) resultado = FM_ERRO_ESCRITA;
+
+    free(linha);
+    fclose(texto);
+
+    return (resultado < 0) ? resultado : numAntenas;
+}
+
+/**
+ * @brief Ordena os registos por (y, x) com uma ordenação por dígitos (radix) estável, de 8 bits por passagem.
+ *
+ * O número de passagens depende das maiores coordenadas (ex.: 3 numa grelha de 4000 x 4000). Como a ordenação
+ * é estável, o primeiro registo de cada posição fica à frente dos repetidos.
+ *
+ * @return 0 em caso de sucesso ou "FM_ERRO_ALOCACAO_MEMORIA".
+ */
+static int FM_ordenarRegistos(RegistoAntena *registos, int quantidade)
+{
+    int maiorX = 0, maiorY = 0;
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (registos[i].x > maiorX) maiorX = registos[i].x;
+        if (registos[i].y > maiorY) maiorY = registos[i].y;
+    }
+
+    // Bits de cada coordenada na chave (y, x)
+    int bitsX = 0, bitsY = 0;
+    while (bitsX < 31 && (maiorX >> bitsX) != 0) bitsX++;
+    while (bitsY < 31 && (maiorY >> bitsY) != 0) bitsY++;
+
+    RegistoAntena *auxiliar = malloc((size_t)quantidade * sizeof(RegistoAntena));
+
+    // Verifica se foi possível alocar a memória
+    if (auxiliar == NULL) return FM_ERRO_ALOCACAO_MEMORIA;
+
+    RegistoAntena *origem = registos, *destino = auxiliar;
+
+    for (int deslocamento = 0; deslocamento < bitsX + bitsY; deslocamento += 8)
+    {
+        int contagem[257] = { 0 };
+
+        for (int i = 0; i < quantidade; i++) contagem[((((uint64_t)origem[i].y << bitsX) | (uint64_t)origem[i].x) >> deslocamento & 0xFF) + 1]++;
+        for (int i = 0; i < 256; i++) contagem[i + 1] += contagem[i];
+        for (int i = 0; i < quantidade; i++) destino[contagem[(((uint64_t)origem[i].y << bitsX) | (uint64_t)origem[i].x) >> deslocamento & 0xFF]++] = origem[i];
+
+        RegistoAntena *temp = origem;
+        origem = destino;
+        destino = temp;
+    }
+
+    if (origem != registos) memcpy(registos, origem, (size_t)quantidade * sizeof(RegistoAntena));
+    free(auxiliar);
+
+    return 0;
+}
+
+/**
+ * @brief Aumenta as dimensões da grelha para conter todos os registos.
+ */
+static void FM_atualizarDimensoes(const RegistoAntena *registos, int quantidade, int *largura, int *altura)
+{
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (registos[i].x >= *largura) *largura = registos[i].x + 1;
+        if (registos[i].y >= *altura) *altura = registos[i].y + 1;
+    }
+}
+
+/**
+ * @brief Carrega as antenas de uma lista de coordenadas para a cidade.
+ *
+ * Se a cidade estiver vazia, as antenas são inseridas diretamente no fim da lista (os registos fora de ordem
+ * são antes ordenados com "FM_ordenarRegistos"); caso contrário, são inseridas num só lote ("adicionarAntenasLote").
+ * Em ambos os casos, as antenas repetidas são ignoradas.
+ *
+ * @param cidade Ponteiro para a estrutura do grafo que representa a cidade.
+ * @param localizacaoFicheiro Caminho da lista de coordenadas.
+ * @param resumo Apontador opcional (pode ser NULL) que recebe o resumo do carregamento.
+ *
+ * @note As dimensões da cidade ("largura" e "altura") aumentam para conter todas as antenas.
+ *
+ * @return Número de antenas inseridas.
+ * @return "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" ou "FM_ERRO_FORMATO_INVALIDO" se não for possível ler a lista.
+ * @return "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória (as antenas já inseridas mantêm-se).
+ */
+int FM_carregarCidadeCoordenadas(Grafo *cidade, const char *localizacaoFicheiro, ResumoCoordenadas *resumo)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    RegistoAntena *registos;
+    ResumoCoordenadas leitura;
+    int quantidade = FM_lerCoordenadas(localizacaoFicheiro, &registos, &leitura);
+    int inseridas = 0;
+
+    if (quantidade < 0)
+    {
+        if (resumo != NULL) *resumo = leitura;
+        return quantidade;
+    }
+
+    // Inserção direta no fim (cidade vazia), depois de ordenar os registos se for preciso
+    if ((*cidade).numAntenas == 0 && (leitura.ordenado || FM_ordenarRegistos(registos, quantidade) == 0))
+    {
+        Vertice *ultimaAntena = NULL;
+        int erro = 0;
+
+        for (int i = 0; i < quantidade && inseridas >= 0; i++)
+        {
+            // Repetidos (o primeiro registo de cada posição prevalece)
+            if (ultimaAntena != NULL && (*ultimaAntena).x == registos[i].x && (*ultimaAntena).y == registos[i].y) continue;
+
+            ultimaAntena = adicionarAntenaFim(cidade, ultimaAntena, registos[i].frequencia, registos[i].x, registos[i].y, &erro);
+            inseridas = (ultimaAntena == NULL) ? erro : inseridas + 1;
+        }
+    }
+    else inseridas = adicionarAntenasLote(cidade, registos, quantidade, NULL);
+
+    FM_atualizarDimensoes(registos, quantidade, &(*cidade).largura, &(*cidade).altura);
+    free(registos);
+
+    if (inseridas >= 0)
+    {
+        leitura.numInseridas = inseridas;
+        leitura.numRepetidas = quantidade - inseridas;
+    }
+    if (resumo != NULL) *resumo = leitura;
+
+    return inseridas;
+}
+
+/**
+ * @brief Carrega as antenas de uma lista de coordenadas para a rede.
+ *
+ * Na rede com lista ligada vazia, as antenas são inseridas diretamente no fim (os registos fora de ordem são
+ * antes ordenados com "FM_ordenarRegistos"); caso contrário (ou nos outros modos da rede), são inseridas num só
+ * lote ("LL_adicionarAntenasLote"). Em ambos os casos, as antenas repetidas são ignoradas.
+ *
+ * @param rede Ponteiro para a estrutura da rede onde serão adicionadas as antenas.
+ * @param localizacaoFicheiro Caminho da lista de coordenadas.
+ * @param resumo Apontador opcional (pode ser NULL) que recebe o resumo do carregamento.
+ *
+ * @note As dimensões da rede (e da cidade partilhada) aumentam para conter todas as antenas.
+ *
+ * @return Número de antenas inseridas.
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se o ponteiro para a rede for inválido.
+ * @return "FM_ERRO_ABRIR_FICHEIRO" ou "FM_ERRO_FORMATO_INVALIDO" se não for possível ler a lista.
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória (as antenas já inseridas mantêm-se).
+ */
+int FM_carregarAntenasCoordenadas(Rede *rede, const char *localizacaoFicheiro, ResumoCoordenadas *resumo)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    RegistoAntena *registos;
+    ResumoCoordenadas leitura;
+    int quantidade = FM_lerCoordenadas(localizacaoFicheiro, &registos, &leitura);
+    int inseridas = 0;
+
+    if (quantidade < 0)
+    {
+        if (resumo != NULL) *resumo = leitura;
+        return quantidade;
+    }
+
+    // Inserção direta no fim (lista ligada vazia), depois de ordenar os registos se for preciso
+    if (!(*rede).vetorial && (*rede).cidade == NULL && (*rede).numAntenas == 0 && (leitura.ordenado || FM_ordenarRegistos(registos, quantidade) == 0))
+    {
+        Antena *ultimaAntena = NULL;
+        int erro = 0;
+
+        for (int i = 0; i < quantidade && inseridas >= 0; i++)
+        {
+            // Repetidos (o primeiro registo de cada posição prevalece)
+            if (ultimaAntena != NULL && (*ultimaAntena).x == registos[i].x && (*ultimaAntena).y == registos[i].y) continue;
+
+            ultimaAntena = LL_adicionarAntenaFim(rede, ultimaAntena, registos[i].frequencia, registos[i].x, registos[i].y, &erro);
+            inseridas = (ultimaAntena == NULL) ? erro : inseridas + 1;
+        }
+    }
+    else inseridas = LL_adicionarAntenasLote(rede, registos, quantidade, NULL);
+
+    FM_atualizarDimensoes(registos, quantidade, &(*rede).largura, &(*rede).altura);
+    if ((*rede).cidade != NULL) FM_atualizarDimensoes(registos, quantidade, &(*(*rede).cidade).largura, &(*(*rede).cidade).altura);
+    free(registos);
+
+    if (inseridas >= 0)
+    {
+        leitura.numInseridas = inseridas;
+        leitura.numRepetidas = quantidade - inseridas;
+    }
+    if (resumo != NULL) *resumo = leitura;
+
+    return inseridas;
+}
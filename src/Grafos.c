@@ -10,6 +10,98 @@
  */
 #include "../include/Grafos.h"
 
+// Funções auxiliares da reserva de arestas
+static inline Aresta *reservarAresta(Grafo *cidade);
+static void devolverAresta(Grafo *cidade, Aresta *aresta);
+static void libertarBlocosArestas(Grafo *cidade);
+
+// Funções auxiliares da tabela de dispersão de arestas
+static void inserirTabelaArestas(Vertice *origem, Aresta *aresta, bool maisRecente);
+static void retirarTabelaArestas(Vertice *origem, Aresta *aresta);
+static void redimensionarTabelaArestas(Vertice *origem, int capacidade);
+static Aresta *procurarArestaDestino(Vertice *inicio, Vertice *destino);
+
+// Funções auxiliares das operações em lote
+typedef struct ChaveLote
+{
+    int64_t chave;
+    int indice;
+
+} ChaveLote;
+
+static inline int64_t chaveCoordenadas(int x, int y);
+static ChaveLote *ordenarLote(const RegistoAntena *lote, int quantidade);
+
+// Funções auxiliares da interligação por distância
+typedef struct VizinhoCandidato
+{
+    Vertice *antena;
+    int64_t distancia2;
+
+} VizinhoCandidato;
+
+typedef struct RecolhaVizinhos
+{
+    Vertice *origem;
+    bool FrequenciasIguais;
+    bool FrequenciasDiferentes;
+    VizinhoCandidato *candidatos;
+    int numCandidatos;
+    int capacidade;
+
+} RecolhaVizinhos;
+
+static int recolherVizinho(int x, int y, void *dados, void *contexto);
+static int compararVizinhos(const void *a, const void *b);
+
+// Funções auxiliares dos núcleos (kernels) de "interligarAntenas"
+typedef int (*NucleoInterligacao)(Grafo *cidade);
+
+static int interligarIguais(Grafo *cidade);
+static int interligarIguaisVerificando(Grafo *cidade);
+static int interligarDiferentes(Grafo *cidade);
+static int interligarDiferentesVerificando(Grafo *cidade);
+static int interligarTodas(Grafo *cidade);
+static int interligarTodasVerificando(Grafo *cidade);
+
+// Funções auxiliares da procura de todas as interseções
+typedef struct IntersecoesVistas
+{
+    int64_t *pontos;
+    uint16_t *pares;
+    size_t capacidade;
+    size_t numChaves;
+
+} IntersecoesVistas;
+
+static int inserirIntersecaoVista(IntersecoesVistas *vistas, int x, int y, uint16_t par);
+
+// Funções auxiliares da procura de caminhos com poda
+typedef struct ProcuraPodada
+{
+    Vertice *destino;
+    Vertice **caminho;
+    Vertice **fila;
+    int *distancia;
+    RegistoAntena *registos;
+    size_t *inicioEntradas;
+    Vertice **origens;
+    int numAntenas;
+    OpcoesCaminhos *opcoes;
+    Saida *saida;
+
+} ProcuraPodada;
+
+static void calcularDistanciasDestino(ProcuraPodada *procura);
+static bool mantemDistancias(ProcuraPodada *procura, Vertice *antena);
+static int procurarCaminhosPodadosRecursiva(ProcuraPodada *procura, Vertice *atual, int tamanho);
+
+// Funções auxiliares dos índices (por frequência e espacial)
+static void indexarAntena(Grafo *cidade, Vertice *antena);
+static void desindexarAntena(Grafo *cidade, Vertice *antena);
+static void indexarFrequencia(Grafo *cidade, Vertice *antena);
+static void desindexarFrequencia(Grafo *cidade, Vertice *antena);
+
 /**
  * @brief Cria e inicializa uma nova cidade (grafo).
  * 
@@ -21,7 +113,12 @@
 Grafo *criarCidade()
 {
     // Aloca o espaço na memória para a cidade (e inicializa as variáveis)
-    return calloc(1, sizeof(Grafo));
+    Grafo *cidade = calloc(1, sizeof(Grafo));
+
+    // A geração começa em 1 (0 indica uma estrutura derivada ainda por construir)
+    if (cidade != NULL) (*cidade).geracao = 1;
+
+    return cidade;
 }
 
 /**
@@ -31,7 +128,7 @@ Grafo *criarCidade()
  * @param x Coordenada horizontal da antena.
  * @param y Coordenada vertical da antena.
  * 
- * @note Campos "visitada", "primeiraAresta" e "prox" são inicializados a false/NULL.
+ * @note Campos "visitada", "arestasPendentes", "primeiraAresta", "primeiraArestaEntrada", "tabelaArestas" e "prox" são inicializados a false/NULL/0.
  * 
  * @return Ponteiro para a antena alocada.
  * @return NULL se a alocação falhar.
@@ -49,26 +146,41 @@ Vertice *criarAntena(char frequencia, int x, int y)
     (*novo).x = x;
     (*novo).y = y;
     (*novo).visitada = false;
+    (*novo).arestasPendentes = false;
+    (*novo).indice = -1;
     (*novo).primeiraAresta = NULL;
+#ifdef ADJACENCIA_INVERSA
+    (*novo).primeiraArestaEntrada = NULL;
+#endif
+    (*novo).numArestas = 0;
+    (*novo).capacidadeTabela = 0;
+    (*novo).tabelaArestas = NULL;
     (*novo).prox = NULL;
+    (*novo).proxFrequencia = NULL;
+    (*novo).anteriorFrequencia = NULL;
+    (*novo).cidade = NULL;
+    (*novo).geracaoInsercao = 0;
 
     return novo;
 }
 
 /**
- * @brief Cria uma nova aresta que liga a um vértice de destino.
+ * @brief Cria uma nova aresta que liga um vértice de origem a um vértice de destino.
  * 
+ * @param origem Ponteiro para o vértice de origem da aresta.
  * @param destino Ponteiro para o vértice de destino da aresta.
  * 
- * @note O campo "prox" é inicializado a NULL.
+ * @note Os apontadores das listas de saída e de entrada são inicializados a NULL ("origem" só é
+ *       guardada com "ADJACENCIA_INVERSA"). A aresta só fica visível no grafo depois de "ligarAresta()".
+ * @note Se a origem pertencer a uma cidade, a aresta é reservada dos blocos da cidade (ver "Grafo").
  * 
  * @return Ponteiro para a aresta alocada.
  * @return NULL se a alocação falhar.
  */
-Aresta *criarAresta(Vertice *destino)
+Aresta *criarAresta(Vertice *origem, Vertice *destino)
 {
-    // Aloca o espaço na memória para a cidade (e inicializa as variáveis)
-    Aresta *novo = malloc(sizeof(Aresta));
+    // Reserva o espaço para a aresta (nos blocos da cidade da origem, se existir)
+    Aresta *novo = (origem != NULL && (*origem).cidade != NULL) ? reservarAresta((*origem).cidade) : malloc(sizeof(Aresta));
 
     // Verifica se foi possível alocar a memória
     if (novo == NULL) return NULL;
@@ -76,10 +188,30 @@ Aresta *criarAresta(Vertice *destino)
     // Popula as variáveis da estrutura
     (*novo).destino = destino;
     (*novo).prox = NULL;
+#ifdef ADJACENCIA_INVERSA
+    (*novo).origem = origem;
+    (*novo).anterior = NULL;
+    (*novo).proxEntrada = NULL;
+    (*novo).anteriorEntrada = NULL;
+#endif
 
     return novo;
 }
 
+/**
+ * @brief Liberta uma aresta criada com "criarAresta".
+ * 
+ * @param origem Vértice de origem da aresta (o mesmo indicado em "criarAresta()").
+ * @param aresta Apontador para a aresta (já desligada das listas de adjacência, se for o caso).
+ * 
+ * @note Se a origem pertencer a uma cidade, a aresta volta à lista de arestas livres da cidade e
+ *       é reutilizada pela próxima reserva (os blocos só são libertados com as arestas da cidade).
+ */
+void libertarAresta(Vertice *origem, Aresta *aresta)
+{
+    devolverAresta((*origem).cidade, aresta);
+}
+
 /**
  * @brief Liberta toda a memória associada a uma cidade (grafo), incluindo antenas e arestas.
  * 
@@ -95,8 +227,9 @@ Grafo *libertarCidade(Grafo *cidade)
     // Verifica se o apontador é válido
     if (cidade == NULL) return NULL; /* Return NULL caso não exista a cidade */
 
-    // Liberta as antenas (e, posteriormente, as arestas)
+    // Liberta as antenas (e, posteriormente, as arestas) e o índice espacial
     libertarAntenas(cidade);
+    (*cidade).indiceEspacial = libertarIndiceEspacial((*cidade).indiceEspacial);
 
     // Liberta a cidade
     free(cidade);
@@ -109,8 +242,9 @@ Grafo *libertarCidade(Grafo *cidade)
  * 
  * @param cidade Ponteiro para a cidade cujas antenas serão libertadas.
  * 
- * @note Percorre a lista de antenas, libertando cada aresta associada antes de libertar a antena.
- *       No final, reseta o contador de antenas ("numAntenas") e o ponteiro para a primeira antena.
+ * @note Percorre a lista de antenas, libertando a tabela de dispersão das arestas de cada uma antes de libertar
+ *       a antena, e liberta os blocos das arestas de uma só vez. No final, reseta o contador de antenas
+ *       ("numAntenas") e o ponteiro para a primeira antena.
  * 
  * @return Retorna 0 em caso de sucesso
  * @return "ERRO_CIDADE_PONTEIRO_INVALIDO" se "cidade" for NULL.
@@ -122,13 +256,8 @@ int libertarAntenas(Grafo *cidade)
 
     for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; )
     {
-        // Liberta as arestas
-        for (Aresta *arestaAtual = (*antenaAtual).primeiraAresta; arestaAtual != NULL; )
-        {
-            Aresta *temp = arestaAtual;
-            arestaAtual = (*arestaAtual).prox;
-            free(temp);
-        }
+        // Liberta a tabela de dispersão das arestas
+        free((*antenaAtual).tabelaArestas);
 
         // Liberta as antenas
         Vertice *temp = antenaAtual;
@@ -136,9 +265,19 @@ int libertarAntenas(Grafo *cidade)
         free(temp);
     }
 
+    // Liberta as arestas
+    libertarBlocosArestas(cidade);
+
     // Dá reset das variáveis da cidade
+    (*cidade).geracao++;
     (*cidade).numAntenas = 0;
     (*cidade).primeiraAntena = NULL;
+    memset((*cidade).primeiraAntenaFrequencia, 0, sizeof((*cidade).primeiraAntenaFrequencia));
+    memset((*cidade).ultimaAntenaFrequencia, 0, sizeof((*cidade).ultimaAntenaFrequencia));
+    memset((*cidade).numAntenasFrequencia, 0, sizeof((*cidade).numAntenasFrequencia));
+    if ((*cidade).indiceEspacial != NULL) limparIndiceEspacial((*cidade).indiceEspacial);
+    (*cidade).largura = 0;
+    (*cidade).altura = 0;
 
     return 0;
 }
@@ -148,8 +287,8 @@ int libertarAntenas(Grafo *cidade)
  * 
  * @param cidade Ponteiro para a cidade cujas arestas serão libertadas.
  * 
- * @note Percorre todas as antenas, libertando as suas arestas e definindo "primeiraAresta" como NULL.
- *       As antenas não são libertadas, apenas as suas ligações (arestas).
+ * @note Percorre todas as antenas, definindo "primeiraAresta" e "primeiraArestaEntrada" (se existir) como NULL,
+ *       e liberta os blocos das arestas de uma só vez. As antenas não são libertadas, apenas as suas ligações (arestas).
  * 
  * @return Retorna 0 em caso de sucesso
  * @return "ERRO_CIDADE_PONTEIRO_INVALIDO" se "cidade" for NULL.
@@ -159,20 +298,27 @@ int libertarArestas(Grafo *cidade)
     // Verifica se os apontadores são válidos
     if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
 
+    (*cidade).geracao++;
+
     for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
     {
-        // Liberta as arestas
-        for (Aresta *arestaAtual = (*antenaAtual).primeiraAresta; arestaAtual != NULL; )
-        {
-            Aresta *temp = arestaAtual;
-            arestaAtual = (*arestaAtual).prox;
-            free(temp);
-        }
+        // Liberta a tabela de dispersão das arestas
+        free((*antenaAtual).tabelaArestas);
 
-        // Limpa o ponteiro
+        // Limpa os ponteiros
+        (*antenaAtual).arestasPendentes = false;
         (*antenaAtual).primeiraAresta = NULL;
+#ifdef ADJACENCIA_INVERSA
+        (*antenaAtual).primeiraArestaEntrada = NULL;
+#endif
+        (*antenaAtual).numArestas = 0;
+        (*antenaAtual).capacidadeTabela = 0;
+        (*antenaAtual).tabelaArestas = NULL;
     }
 
+    // Liberta as arestas
+    libertarBlocosArestas(cidade);
+
     return 0;
 }
 
@@ -201,11 +347,98 @@ int resetVisitados(Grafo *cidade)
     return 0;
 }
 
+/**
+ * @brief Numera as antenas da cidade pela ordem da lista (0, 1, 2, ...), guardando o número em "indice".
+ *
+ * @param cidade Ponteiro para a estrutura do grafo que representa a cidade.
+ *
+ * @return int número de antenas numeradas.
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido (NULL).
+ */
+int numerarAntenas(Grafo *cidade)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    int indice = 0;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        (*antenaAtual).indice = indice++;
+    }
+
+    return indice;
+}
+
+/**
+ * @brief Devolve a geração atual da cidade.
+ *
+ * A geração da cidade é incrementada sempre que uma antena é inserida ou removida, ou uma aresta entre
+ * as suas antenas é ligada ou desligada (cada antena inserida guarda a sua cidade, pelo que
+ * "adicionarAresta"/"removerAresta" não precisam de a receber). Permite a estruturas derivadas
+ * (ex.: "FechoTransitivo") saberem se ainda estão atualizadas.
+ *
+ * @param cidade Ponteiro para a estrutura do grafo da cidade.
+ *
+ * @note As alterações de uma cidade não mudam a geração das outras.
+ * @note Tal como as restantes funções de alteração, não é segura com edições em simultâneo na mesma cidade.
+ *
+ * @return Geração atual (nunca 0), ou 0 se a cidade for inválida (NULL).
+ */
+uint64_t geracaoCidade(const Grafo *cidade)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return 0;
+
+    return (*cidade).geracao;
+}
+
+/**
+ * @brief Cria (ou recria) o índice espacial das antenas da cidade.
+ *
+ * A partir deste momento o índice é mantido em cada inserção e remoção de antenas e é usado
+ * pelas consultas "procurarAntenasRaio", "procurarAntenasRetangulo" e "procurarAntenasProximas".
+ *
+ * @param cidade Ponteiro para a estrutura do grafo que representa a cidade.
+ * @param tamanhoCelula Lado de cada célula da grelha (<= 0 usa "TAMANHO_CELULA_PREDEFINIDO").
+ *
+ * @return int 0 se o índice for criado com sucesso.
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido (NULL).
+ * @return int "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória (a cidade fica sem índice).
+ */
+int criarIndiceCidade(Grafo *cidade, int tamanhoCelula)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    // Substitui o índice anterior
+    (*cidade).indiceEspacial = libertarIndiceEspacial((*cidade).indiceEspacial);
+
+    IndiceEspacial *indice = criarIndiceEspacial(tamanhoCelula);
+
+    // Verifica se foi possível alocar a memória
+    if (indice == NULL) return ERRO_ALOCACAO_MEMORIA;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        if (inserirIndiceEspacial(indice, (*antenaAtual).x, (*antenaAtual).y, antenaAtual) < 0)
+        {
+            libertarIndiceEspacial(indice);
+            return ERRO_ALOCACAO_MEMORIA;
+        }
+    }
+
+    (*cidade).indiceEspacial = indice;
+
+    return 0;
+}
+
 /**
  * @brief Carrega a cidade a partir de um ficheiro de texto.
  *
  * Lê o ficheiro linha a linha, identificando antenas através de caracteres entre 'A' e 'Z',
  * e adiciona essas antenas à cidade com as respetivas coordenadas (x, y).
+ * As dimensões da grelha (maior largura de linha e número de linhas) ficam registadas em "largura" e "altura".
  *
  * @param cidade Ponteiro para a estrutura do grafo que representa a cidade.
  * @param localizacaoFicheiro Caminho para o ficheiro de entrada.
@@ -235,9 +468,19 @@ int carregarCidade(Grafo *cidade, const char *localizacaoFicheiro)
     size_t tamanho = 0;
     ssize_t lidos;
 
+    // Dimensões da grelha
+    (*cidade).largura = 0;
+    (*cidade).altura = 0;
+
     // Percorre o ficheiro e verifica a existência de antenas
     for (int y = 0; (lidos = getline(&linha, &tamanho, ficheiro)) != -1; y++)
     {
+        // Regista a largura (sem a mudança de linha) e a altura da grelha
+        int larguraLinha = (int)lidos;
+        while (larguraLinha > 0 && (linha[larguraLinha - 1] == '\n' || linha[larguraLinha - 1] == '\r')) larguraLinha--;
+        if (larguraLinha > (*cidade).largura) (*cidade).largura = larguraLinha;
+        (*cidade).altura = y + 1;
+
         for (int x = 0; x < lidos; x++)
         {
             // Verifica se o caracter é uma letra (com early exit)
@@ -271,6 +514,11 @@ int carregarCidade(Grafo *cidade, const char *localizacaoFicheiro)
  * - Frequências diferentes: liga antenas com frequências diferentes.
  * - Pode opcionalmente evitar repetições de arestas.
  *
+ * Os critérios são resolvidos uma só vez, à entrada: cada combinação tem um núcleo próprio, sem testes
+ * dos critérios nem validações dos apontadores no ciclo interior, que reserva as arestas diretamente dos
+ * blocos da cidade (ver "Grafo"). As arestas criadas são as mesmas de "interligarAntenasGenerica", pela mesma ordem
+ * nas listas de adjacência (os grupos de frequência seguem a ordem da lista de antenas).
+ *
  * @param cidade Ponteiro para a estrutura do grafo da cidade.
  * @param FrequenciasIguais Se verdadeiro, liga antenas com a mesma frequência.
  * @param FrequenciasDiferentes Se verdadeiro, liga antenas com frequências diferentes.
@@ -281,10 +529,67 @@ int carregarCidade(Grafo *cidade, const char *localizacaoFicheiro)
  * @return int "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória ao adicionar uma aresta.
  */
 int interligarAntenas(Grafo *cidade, bool FrequenciasIguais, bool FrequenciasDiferentes, bool verificarRepetidas)
+{
+    // Núcleos por critério: [iguais, diferentes, ambos][verificarRepetidas]
+    static const NucleoInterligacao nucleos[3][2] =
+    {
+        { interligarIguais, interligarIguaisVerificando },
+        { interligarDiferentes, interligarDiferentesVerificando },
+        { interligarTodas, interligarTodasVerificando }
+    };
+
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    // As arestas pendentes passam a ser criadas aqui
+    if (FrequenciasIguais)
+    {
+        for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+        {
+            (*antenaAtual).arestasPendentes = false;
+        }
+    }
+    else if (!FrequenciasDiferentes) return 0;
+
+    int criterio = FrequenciasIguais ? (FrequenciasDiferentes ? 2 : 0) : 1;
+
+    return nucleos[criterio][verificarRepetidas ? 1 : 0](cidade);
+}
+
+/**
+ * @brief Cria arestas entre antenas da cidade com base nas frequências (versão genérica, de referência).
+ *
+ * Interliga as antenas do grafo conforme os critérios fornecidos:
+ * - Frequências iguais: liga antenas com a mesma frequência.
+ * - Frequências diferentes: liga antenas com frequências diferentes.
+ * - Pode opcionalmente evitar repetições de arestas.
+ *
+ * @note Os critérios são avaliados para cada par de antenas e cada aresta é criada com "adicionarAresta".
+ *       Usada como referência para os núcleos de "interligarAntenas" (ver "Comparador.c").
+ *
+ * @param cidade Ponteiro para a estrutura do grafo da cidade.
+ * @param FrequenciasIguais Se verdadeiro, liga antenas com a mesma frequência.
+ * @param FrequenciasDiferentes Se verdadeiro, liga antenas com frequências diferentes.
+ * @param verificarRepetidas Se verdadeiro, verifica se já existe ligação antes de adicionar.
+ *
+ * @return int 0 se as interligações forem feitas com sucesso.  
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido (NULL).  
+ * @return int "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória ao adicionar uma aresta.
+ */
+int interligarAntenasGenerica(Grafo *cidade, bool FrequenciasIguais, bool FrequenciasDiferentes, bool verificarRepetidas)
 {
     // Verifica se o apontador é válido
     if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
 
+    // As arestas pendentes passam a ser criadas aqui
+    if (FrequenciasIguais)
+    {
+        for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+        {
+            (*antenaAtual).arestasPendentes = false;
+        }
+    }
+
     // Cria arestas entre antenas com a mesma frequência, diferentes ou ambos
     for (Vertice *antenaAtual1 = (*cidade).primeiraAntena; antenaAtual1 != NULL; antenaAtual1 = (*antenaAtual1).prox)
     {
@@ -302,6 +607,211 @@ int interligarAntenas(Grafo *cidade, bool FrequenciasIguais, bool FrequenciasDif
     return 0;
 }
 
+/**
+ * @brief Cria arestas apenas entre antenas a uma distância (euclidiana) inferior ou igual a "raio".
+ *
+ * Variante de "interligarAntenas" para cidades grandes: os pares candidatos são obtidos a partir de
+ * uma grelha espacial temporária com células de lado "raio", pelo que cada antena só é comparada
+ * com as antenas das células vizinhas (O(n·vizinhos) em vez de O(n²)).
+ *
+ * @param cidade Ponteiro para a estrutura do grafo da cidade.
+ * @param FrequenciasIguais Se verdadeiro, liga antenas com a mesma frequência.
+ * @param FrequenciasDiferentes Se verdadeiro, liga antenas com frequências diferentes.
+ * @param verificarRepetidas Se verdadeiro, verifica se já existe ligação antes de adicionar.
+ * @param raio Distância máxima entre duas antenas ligadas.
+ * @param maxVizinhos Se > 0, cada antena só liga (aresta de saída) às "maxVizinhos" antenas mais próximas
+ *                    dentro do raio (empates resolvidos pela ordem (y, x)); se <= 0, as ligações são
+ *                    criadas nos dois sentidos para todos os pares dentro do raio.
+ *
+ * @return int 0 se as interligações forem feitas com sucesso.
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido (NULL).
+ * @return int "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int interligarAntenasRaio(Grafo *cidade, bool FrequenciasIguais, bool FrequenciasDiferentes, bool verificarRepetidas, int raio, int maxVizinhos)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+    if (raio < 0 || (!FrequenciasIguais && !FrequenciasDiferentes)) return 0;
+
+    // Grelha temporária com células do tamanho do raio (a vizinhança de cada antena são 3x3 células)
+    IndiceEspacial *grelha = criarIndiceEspacial(raio > 0 ? raio : 1);
+
+    // Verifica se foi possível alocar a memória
+    if (grelha == NULL) return ERRO_ALOCACAO_MEMORIA;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        if (inserirIndiceEspacial(grelha, (*antenaAtual).x, (*antenaAtual).y, antenaAtual) < 0)
+        {
+            libertarIndiceEspacial(grelha);
+            return ERRO_ALOCACAO_MEMORIA;
+        }
+    }
+
+    RecolhaVizinhos recolha = { NULL, FrequenciasIguais, FrequenciasDiferentes, NULL, 0, 0 };
+    int erro = 0;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL && erro == 0; antenaAtual = (*antenaAtual).prox)
+    {
+        // Recolhe os candidatos dentro do raio
+        recolha.origem = antenaAtual;
+        recolha.numCandidatos = 0;
+
+        if (consultarRaio(grelha, (*antenaAtual).x, (*antenaAtual).y, raio, recolherVizinho, &recolha) < 0)
+        {
+            erro = ERRO_ALOCACAO_MEMORIA;
+            break;
+        }
+
+        int numLigacoes = recolha.numCandidatos;
+
+        // Limita aos k vizinhos mais próximos
+        if (maxVizinhos > 0 && numLigacoes > maxVizinhos)
+        {
+            qsort(recolha.candidatos, numLigacoes, sizeof(VizinhoCandidato), compararVizinhos);
+            numLigacoes = maxVizinhos;
+        }
+
+        for (int i = 0; i < numLigacoes && erro == 0; i++)
+        {
+            Vertice *vizinho = recolha.candidatos[i].antena;
+
+            if (maxVizinhos > 0)
+            {
+                if (adicionarAresta(antenaAtual, vizinho, verificarRepetidas) == ERRO_ALOCACAO_MEMORIA) erro = ERRO_ALOCACAO_MEMORIA;
+            }
+            // Sem limite, cada par é tratado uma única vez (pela antena que surge primeiro na lista)
+            else if (chaveCoordenadas((*antenaAtual).x, (*antenaAtual).y) < chaveCoordenadas((*vizinho).x, (*vizinho).y))
+            {
+                if (adicionarAresta(antenaAtual, vizinho, verificarRepetidas) == ERRO_ALOCACAO_MEMORIA) erro = ERRO_ALOCACAO_MEMORIA;
+                else if (adicionarAresta(vizinho, antenaAtual, verificarRepetidas) == ERRO_ALOCACAO_MEMORIA) erro = ERRO_ALOCACAO_MEMORIA;
+            }
+        }
+    }
+
+    free(recolha.candidatos);
+    libertarIndiceEspacial(grelha);
+
+    return erro;
+}
+
+/**
+ * @brief Interliga as antenas com a mesma frequência de forma diferida.
+ *
+ * Equivalente a "interligarAntenas(cidade, true, false, ...)", mas as arestas de cada antena só são
+ * criadas quando a antena é expandida pela primeira vez (procuras, listagem de arestas, procura ou
+ * remoção de uma aresta com origem nela, conversão para a representação compacta, ...). A operação
+ * é O(n) e só se paga a interligação da parte do grafo que for de facto percorrida.
+ *
+ * @param cidade Ponteiro para a estrutura do grafo da cidade.
+ *
+ * @note Uma antena pendente só se liga às antenas com a sua frequência que já existiam nesta chamada
+ *       (e que continuarem na cidade quando for expandida). As antenas inseridas depois não ficam
+ *       pendentes nem são destino das pendentes, pelo que o resultado é o de "interligarAntenas".
+ *
+ * @return int número de antenas que ficaram pendentes.
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido (NULL).
+ */
+int interligarAntenasPendente(Grafo *cidade)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    int pendentes = 0;
+    (*cidade).geracao++; /* As arestas pendentes já fazem parte do grafo */
+    (*cidade).geracaoPendente = (*cidade).geracao;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        if (!(*antenaAtual).arestasPendentes)
+        {
+            (*antenaAtual).arestasPendentes = true;
+            pendentes++;
+        }
+    }
+
+    return pendentes;
+}
+
+/**
+ * @brief Cria as arestas pendentes de uma antena (para as antenas com a mesma frequência).
+ *
+ * O grupo da frequência é percorrido desde o início (recuando a partir da própria antena por
+ * "anteriorFrequencia"), pelo que não é necessário o grafo e as arestas ficam pela ordem da lista,
+ * como em "interligarAntenas". Se a antena já tiver arestas (criadas
+ * manualmente ou numa tentativa anterior), os destinos repetidos são ignorados. As antenas inseridas
+ * depois de "interligarAntenasPendente" são ignoradas (ver "geracaoInsercao").
+ *
+ * @param antena Apontador para a antena.
+ *
+ * @return int número de arestas criadas (0 se a antena não estiver pendente).
+ * @return int "ERRO_ANTENA_INICIO_INVALIDA" se a antena for inválida.
+ * @return int "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória (a antena continua pendente).
+ */
+int materializarArestas(Vertice *antena)
+{
+    // Verifica se o apontador é válido
+    if (antena == NULL) return ERRO_ANTENA_INICIO_INVALIDA;
+
+    if (!(*antena).arestasPendentes) return 0;
+
+    bool verificarRepetidas = ((*antena).numArestas > 0);
+    int criadas = 0;
+
+    // Só as antenas que já existiam em "interligarAntenasPendente" são destino
+    uint64_t limite = ((*antena).cidade != NULL) ? (*(*antena).cidade).geracaoPendente : UINT64_MAX;
+
+    Vertice *primeira = antena;
+    while ((*primeira).anteriorFrequencia != NULL) primeira = (*primeira).anteriorFrequencia;
+
+    for (Vertice *outra = primeira; outra != NULL; outra = (*outra).proxFrequencia)
+    {
+        if (outra == antena || (*outra).geracaoInsercao > limite) continue;
+        if (verificarRepetidas && procurarArestaDestino(antena, outra) != NULL) continue;
+
+        Aresta *nova = criarAresta(antena, outra);
+
+        // Verifica se foi possível alocar a memória
+        if (nova == NULL) return ERRO_ALOCACAO_MEMORIA;
+
+        ligarAresta(antena, nova);
+        criadas++;
+    }
+
+    (*antena).arestasPendentes = false;
+
+    return criadas;
+}
+
+/**
+ * @brief Cria as arestas pendentes de todas as antenas da cidade.
+ *
+ * @param cidade Ponteiro para a estrutura do grafo da cidade.
+ *
+ * @note Usada antes das operações que precisam do grafo completo (ex.: "GC_criarGrafoCompacto").
+ *
+ * @return int número de arestas criadas.
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido (NULL).
+ * @return int "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int materializarTodasArestas(Grafo *cidade)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    int criadas = 0;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        int resultado = materializarArestas(antenaAtual);
+        if (resultado < 0) return resultado;
+
+        criadas += resultado;
+    }
+
+    return criadas;
+}
+
 /**
  * @brief Adiciona uma antena à cidade nas coordenadas especificadas.
  *
@@ -345,6 +855,7 @@ int adicionarAntenaOrdenada(Grafo *cidade, char *frequencia, int x, int y)
         // Insere a antena na posição correspondente da lista
         (*nova).prox = (*cidade).primeiraAntena;
         (*cidade).primeiraAntena = nova;
+        indexarAntena(cidade, nova);
     }
     // Insere no meio e fim da lista
     else
@@ -373,6 +884,7 @@ int adicionarAntenaOrdenada(Grafo *cidade, char *frequencia, int x, int y)
         // Insere a antena na posição correspondente da lista
         (*antenaAnterior).prox = nova;
         (*nova).prox = antenaAtual;
+        indexarAntena(cidade, nova);
     }
 
     (*cidade).numAntenas++;
@@ -390,6 +902,8 @@ int adicionarAntenaOrdenada(Grafo *cidade, char *frequencia, int x, int y)
  * @param y Coordenada vertical da antena.
  * @param erro Ponteiro para inteiro onde será armazenado o código de erro, caso ocorra.
  * 
+ * @note Só serve para encher uma cidade vazia pela ordem da lista: com "ultimaAntena" a NULL, a cidade tem
+ *       de estar vazia ("ERRO_CIDADE_NAO_VAZIA"); numa cidade com antenas, usar "adicionarAntenasLote".
  * @note Esta função:
  *       - Verifica a validade dos parâmetros de entrada.
  *       - Aloca memória para a nova antena.
@@ -408,6 +922,13 @@ Vertice *adicionarAntenaFim(Grafo *cidade, Vertice *ultimaAntena, char frequenci
         return NULL;
     }
 
+    // Sem a última antena, a nova seria a primeira (e as restantes ficariam fora da lista)
+    if (ultimaAntena == NULL && (*cidade).primeiraAntena != NULL)
+    {
+        *erro = ERRO_CIDADE_NAO_VAZIA;
+        return NULL;
+    }
+
     // Cria o espaço na memória para a nova antena
     Vertice *nova = criarAntena(frequencia, x, y);
 
@@ -430,63 +951,343 @@ Vertice *adicionarAntenaFim(Grafo *cidade, Vertice *ultimaAntena, char frequenci
         ultimaAntena = nova;
     }
 
-    // Incrementa o número de antenas
+    // Incrementa o número de antenas e agrupa-a pela frequência
     (*cidade).numAntenas++;
+    indexarAntena(cidade, nova);
 
     return nova;
 }
 
 /**
- * @brief Adiciona uma aresta entre duas antenas.
+ * @brief Adiciona um lote de antenas à cidade com uma única passagem de junção.
  * 
- * @param inicio Apontador para a antena de origem.
- * @param destino Apontador para a antena de destino.
- * @param verificarRepetidas Booleano que indica se deve verificar arestas repetidas.
- * @return int 0 se for bem-sucedido, ou código de erro:
- * @return int "ERRO_ANTENAS_INICIO_DESTINO_INVALIDAS" se os vértices forem inválidos,
- * @return int "ERRO_ANTENA_INICIO_INVALIDA" se o vértice de início for inválido,
- * @return int "ERRO_ANTENA_DESTINO_INVALIDA" se o vértice de destino for inválido,
- * @return int "ERRO_ARESTA_JA_EXISTE" se a aresta já existir (quando verificarRepetidas for verdadeiro),
- * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ * O lote é ordenado pela chave (y, x) e junto à lista de antenas (também ordenada por (y, x))
+ * numa única passagem linear, em vez de uma inserção ordenada O(n) por antena.
+ * Antenas repetidas dentro do lote ou já existentes na cidade não são inseridas.
+ * 
+ * @param cidade Ponteiro para a estrutura do grafo da cidade.
+ * @param lote Vetor de registos (frequência, x, y) a inserir.
+ * @param quantidade Número de registos do lote.
+ * @param resultados Vetor opcional (pode ser NULL) com "quantidade" posições, preenchido pela ordem do lote com:
+ *        0 se a antena foi inserida,
+ *        "ERRO_ANTENA_JA_EXISTE" se já existia na cidade,
+ *        "ERRO_ANTENA_REPETIDA_LOTE" se um registo anterior do lote tem as mesmas coordenadas,
+ *        "ERRO_ALOCACAO_MEMORIA" se não chegou a ser inserida por falta de memória.
+ * 
+ * @return int número de antenas inseridas.
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido (NULL).
+ * @return int "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória (as antenas já inseridas mantêm-se).
  */
-int adicionarAresta(Vertice *inicio, Vertice *destino, bool verificarRepetidas)
+int adicionarAntenasLote(Grafo *cidade, const RegistoAntena *lote, int quantidade, int *resultados)
 {
-    // Verifica se as antenas de início e destino são válidas
-    if (inicio == NULL)
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+    if (lote == NULL || quantidade <= 0) return 0;
+
+    // Ordena o lote por (y, x), mantendo a ordem original em caso de empate
+    ChaveLote *ordem = ordenarLote(lote, quantidade);
+
+    // Verifica se foi possível alocar a memória
+    if (ordem == NULL) return ERRO_ALOCACAO_MEMORIA;
+
+    int inseridas = 0;
+    int resultado = 0;
+    Vertice **ligacao = &(*cidade).primeiraAntena;
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        int indice = ordem[i].indice;
+
+        if (resultados != NULL) resultados[indice] = ERRO_ALOCACAO_MEMORIA;
+        if (resultado < 0) continue;
+
+        // Assinala os repetidos dentro do lote (o primeiro registo de cada posição prevalece)
+        if (i > 0 && ordem[i].chave == ordem[i - 1].chave)
+        {
+            if (resultados != NULL) resultados[indice] = ERRO_ANTENA_REPETIDA_LOTE;
+            continue;
+        }
+
+        // Avança na lista até à posição do registo
+        while (*ligacao != NULL && chaveCoordenadas((**ligacao).x, (**ligacao).y) < ordem[i].chave) ligacao = &(**ligacao).prox;
+
+        // Verifica se a antena já existe
+        if (*ligacao != NULL && chaveCoordenadas((**ligacao).x, (**ligacao).y) == ordem[i].chave)
+        {
+            if (resultados != NULL) resultados[indice] = ERRO_ANTENA_JA_EXISTE;
+            continue;
+        }
+
+        Vertice *nova = criarAntena(lote[indice].frequencia, lote[indice].x, lote[indice].y);
+
+        // Verifica se foi possível alocar a memória
+        if (nova == NULL)
+        {
+            resultado = ERRO_ALOCACAO_MEMORIA;
+            continue;
+        }
+
+        // Insere a antena na posição correspondente da lista
+        (*nova).prox = *ligacao;
+        *ligacao = nova;
+        ligacao = &(*nova).prox;
+        indexarAntena(cidade, nova);
+
+        if (resultados != NULL) resultados[indice] = 0;
+        inseridas++;
+    }
+
+    (*cidade).numAntenas += inseridas;
+
+    free(ordem);
+
+    return resultado < 0 ? resultado : inseridas;
+}
+
+/**
+ * @brief Adiciona uma aresta entre duas antenas.
+ * 
+ * @param inicio Apontador para a antena de origem.
+ * @param destino Apontador para a antena de destino.
+ * @param verificarRepetidas Booleano que indica se deve verificar arestas repetidas.
+ * @return int 0 se for bem-sucedido, ou código de erro:
+ * @return int "ERRO_ANTENAS_INICIO_DESTINO_INVALIDAS" se os vértices forem inválidos,
+ * @return int "ERRO_ANTENA_INICIO_INVALIDA" se o vértice de início for inválido,
+ * @return int "ERRO_ANTENA_DESTINO_INVALIDA" se o vértice de destino for inválido,
+ * @return int "ERRO_ARESTA_JA_EXISTE" se a aresta já existir (quando verificarRepetidas for verdadeiro),
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int adicionarAresta(Vertice *inicio, Vertice *destino, bool verificarRepetidas)
+{
+    // Verifica se as antenas de início e destino são válidas
+    if (inicio == NULL)
     {
         if (destino == NULL) return ERRO_ANTENAS_INICIO_DESTINO_INVALIDAS;
         else return ERRO_ANTENA_INICIO_INVALIDA;
     }
     else if (destino == NULL) return ERRO_ANTENA_DESTINO_INVALIDA;
 
-    // Verifica se já existe a aresta (se verificarRepetidas for true)
+    // Verifica se já existe a aresta (se verificarRepetidas for true), incluindo as pendentes
     if (verificarRepetidas)
     {
-        for (Aresta *arestaAtual = (*inicio).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
-        {
-            if ((*arestaAtual).destino == destino)
-            {
-                return ERRO_ARESTA_JA_EXISTE;
-            }
-        }
+        int resultado = materializarArestas(inicio);
+        if (resultado < 0) return resultado;
+
+        if (procurarArestaDestino(inicio, destino) != NULL) return ERRO_ARESTA_JA_EXISTE;
     }
 
     // Cria a nova aresta
-    Aresta *nova = criarAresta(destino);
+    Aresta *nova = criarAresta(inicio, destino);
 
     // Verifica se foi possível alocar a memória
     if (nova == NULL) return ERRO_ALOCACAO_MEMORIA;
 
-    // Nova aresta é introduzida no início da lista ligada
-    (*nova).prox = (*inicio).primeiraAresta;
-    (*inicio).primeiraAresta = nova;
+    // Nova aresta é introduzida no início da lista de saída da origem (e da lista de entrada do destino)
+    ligarAresta(inicio, nova);
 
     return 0;
 }
 
+/**
+ * @brief Liga uma aresta às listas de adjacência da sua origem e do seu destino.
+ * 
+ * A aresta é introduzida no início da lista de saída de "origem" e, com "ADJACENCIA_INVERSA",
+ * no início da lista de entrada (adjacência inversa) do destino.
+ * 
+ * @param origem Vértice de origem (o mesmo indicado em "criarAresta()").
+ * @param aresta Apontador para a aresta criada com "criarAresta()".
+ */
+void ligarAresta(Vertice *origem, Aresta *aresta)
+{
+    if ((*origem).cidade != NULL) (*(*origem).cidade).geracao++;
+
+    // Lista de saída da origem
+    (*aresta).prox = (*origem).primeiraAresta;
+#ifdef ADJACENCIA_INVERSA
+    Vertice *destino = (*aresta).destino;
+
+    (*aresta).anterior = NULL;
+    if ((*origem).primeiraAresta != NULL) (*(*origem).primeiraAresta).anterior = aresta;
+#endif
+    (*origem).primeiraAresta = aresta;
+
+#ifdef ADJACENCIA_INVERSA
+    // Lista de entrada do destino
+    (*aresta).anteriorEntrada = NULL;
+    (*aresta).proxEntrada = (*destino).primeiraArestaEntrada;
+    if ((*destino).primeiraArestaEntrada != NULL) (*(*destino).primeiraArestaEntrada).anteriorEntrada = aresta;
+    (*destino).primeiraArestaEntrada = aresta;
+#endif
+
+    // Indexa a aresta na tabela de dispersão da origem (criando-a ao ultrapassar o limiar)
+    (*origem).numArestas++;
+
+    if ((*origem).tabelaArestas != NULL && (*origem).numArestas * 2 <= (*origem).capacidadeTabela)
+    {
+        inserirTabelaArestas(origem, aresta, true);
+    }
+    else if ((*origem).numArestas > LIMIAR_TABELA_ARESTAS)
+    {
+        // A reconstrução volta a indexar todas as arestas da lista (incluindo esta)
+        redimensionarTabelaArestas(origem, (*origem).capacidadeTabela * 2);
+    }
+}
+
+/**
+ * @brief Calcula a posição inicial de um destino na tabela de dispersão de arestas.
+ * 
+ * @param destino Vértice de destino (a chave é o próprio endereço).
+ * @param capacidade Número de posições da tabela (potência de 2).
+ * 
+ * @return Índice da posição.
+ */
+static inline int baldeTabelaArestas(const Vertice *destino, int capacidade)
+{
+    // Dispersão multiplicativa (Fibonacci) do endereço
+    uint64_t chave = ((uint64_t)(uintptr_t)destino >> 4) * 0x9E3779B97F4A7C15ULL;
+
+    return (int)(chave >> 32) & (capacidade - 1);
+}
+
+/**
+ * @brief Insere uma aresta na tabela de dispersão da sua origem (sondagem linear).
+ * 
+ * @param origem Vértice de origem com a tabela já criada (e com posições livres).
+ * @param aresta Aresta a indexar.
+ * @param maisRecente Se verdadeiro, a aresta passa à frente das arestas com o mesmo destino (como na
+ *        lista de adjacência, onde é inserida no início); se falso, fica depois delas.
+ */
+static void inserirTabelaArestas(Vertice *origem, Aresta *aresta, bool maisRecente)
+{
+    int mascara = (*origem).capacidadeTabela - 1;
+
+    for (int i = baldeTabelaArestas((*aresta).destino, (*origem).capacidadeTabela); ; i = (i + 1) & mascara)
+    {
+        Aresta *ocupante = (*origem).tabelaArestas[i];
+
+        if (ocupante == NULL)
+        {
+            (*origem).tabelaArestas[i] = aresta;
+            return;
+        }
+
+        // Troca com a aresta mais antiga para o mesmo destino, que continua a ser inserida mais à frente
+        if (maisRecente && (*ocupante).destino == (*aresta).destino)
+        {
+            (*origem).tabelaArestas[i] = aresta;
+            aresta = ocupante;
+        }
+    }
+}
+
+/**
+ * @brief Retira uma aresta da tabela de dispersão da sua origem.
+ * 
+ * As arestas seguintes da mesma sequência de sondagem recuam para a posição libertada, pelo que a
+ * tabela não precisa de marcas de posições apagadas.
+ * 
+ * @param origem Vértice de origem com a tabela já criada.
+ * @param aresta Aresta a retirar (comparada pelo endereço).
+ */
+static void retirarTabelaArestas(Vertice *origem, Aresta *aresta)
+{
+    Aresta **tabela = (*origem).tabelaArestas;
+    int mascara = (*origem).capacidadeTabela - 1;
+    int livre = baldeTabelaArestas((*aresta).destino, (*origem).capacidadeTabela);
+
+    while (tabela[livre] != aresta)
+    {
+        if (tabela[livre] == NULL) return;
+        livre = (livre + 1) & mascara;
+    }
+
+    for (int i = (livre + 1) & mascara; tabela[i] != NULL; i = (i + 1) & mascara)
+    {
+        int inicio = baldeTabelaArestas((*tabela[i]).destino, (*origem).capacidadeTabela);
+
+        // Só recua se a posição inicial da aresta não estiver entre a posição livre e a atual
+        if (((i - inicio) & mascara) >= ((i - livre) & mascara))
+        {
+            tabela[livre] = tabela[i];
+            livre = i;
+        }
+    }
+
+    tabela[livre] = NULL;
+}
+
+/**
+ * @brief (Re)constrói a tabela de dispersão das arestas de saída de um vértice.
+ * 
+ * @param origem Vértice cujas arestas serão indexadas.
+ * @param capacidade Número de posições pretendido (no mínimo o dobro das arestas e "LIMIAR_TABELA_ARESTAS" * 4).
+ * 
+ * @note Se a alocação falhar, a tabela é descartada e volta-se à procura linear, que continua correta.
+ */
+static void redimensionarTabelaArestas(Vertice *origem, int capacidade)
+{
+    if (capacidade < LIMIAR_TABELA_ARESTAS * 4) capacidade = LIMIAR_TABELA_ARESTAS * 4;
+    while (capacidade < (*origem).numArestas * 2) capacidade *= 2;
+
+    Aresta **tabela = calloc(capacidade, sizeof(Aresta *));
+
+    free((*origem).tabelaArestas);
+    (*origem).tabelaArestas = tabela;
+    (*origem).capacidadeTabela = 0;
+
+    // Verifica se foi possível alocar a memória
+    if (tabela == NULL) return;
+
+    (*origem).capacidadeTabela = capacidade;
+
+    // A lista começa na aresta mais recente, que fica à frente das restantes para o mesmo destino
+    for (Aresta *arestaAtual = (*origem).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
+    {
+        inserirTabelaArestas(origem, arestaAtual, false);
+    }
+}
+
+/**
+ * @brief Procura a aresta de saída de "inicio" para "destino".
+ * 
+ * Utiliza a tabela de dispersão do vértice quando existe (O(1) esperado),
+ * caso contrário percorre a lista de adjacência (grau abaixo do limiar).
+ * 
+ * @param inicio Vértice de origem (válido).
+ * @param destino Vértice de destino (válido).
+ * 
+ * @return Apontador para a aresta, ou NULL se não existir.
+ */
+static Aresta *procurarArestaDestino(Vertice *inicio, Vertice *destino)
+{
+    if ((*inicio).tabelaArestas != NULL)
+    {
+        int mascara = (*inicio).capacidadeTabela - 1;
+
+        for (int i = baldeTabelaArestas(destino, (*inicio).capacidadeTabela); (*inicio).tabelaArestas[i] != NULL; i = (i + 1) & mascara)
+        {
+            if ((*(*inicio).tabelaArestas[i]).destino == destino) return (*inicio).tabelaArestas[i];
+        }
+
+        return NULL;
+    }
+
+    for (Aresta *arestaAtual = (*inicio).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
+    {
+        if ((*arestaAtual).destino == destino) return arestaAtual;
+    }
+
+    return NULL;
+}
+
 /**
  * @brief Remove uma antena da cidade.
  * 
+ * Todas as arestas incidentes na antena (de saída e de entrada) são desligadas das
+ * antenas vizinhas e libertadas. Com "ADJACENCIA_INVERSA" o tempo é proporcional ao grau da
+ * antena; sem ela, as arestas de entrada são procuradas nas restantes antenas da cidade (a
+ * tabela de dispersão de cada uma, se existir, evita percorrer as listas que não chegam à antena).
+ * 
  * @param cidade Apontador para o grafo da cidade.
  * @param frequencia Apontador para guardar a frequência da antena removida.
  * @param x Coordenada X da antena.
@@ -521,6 +1322,35 @@ int removerAntena(Grafo *cidade, char *frequencia, int x, int y)
             }
 
             (*cidade).numAntenas--;
+            desindexarAntena(cidade, antenaAtual);
+
+            // Desliga e liberta as arestas de saída (a antena já não pertence à cidade, mas as arestas sim)
+            while ((*antenaAtual).primeiraAresta != NULL)
+            {
+                Aresta *temp = (*antenaAtual).primeiraAresta;
+                desligarAresta(antenaAtual, temp);
+                devolverAresta(cidade, temp);
+            }
+
+            // Desliga e liberta as arestas de entrada
+#ifdef ADJACENCIA_INVERSA
+            while ((*antenaAtual).primeiraArestaEntrada != NULL)
+            {
+                Aresta *temp = (*antenaAtual).primeiraArestaEntrada;
+                Vertice *origem = (*temp).origem;
+                desligarAresta(origem, temp);
+                libertarAresta(origem, temp);
+            }
+#else
+            for (Vertice *outra = (*cidade).primeiraAntena; outra != NULL; outra = (*outra).prox)
+            {
+                for (Aresta *temp = procurarArestaDestino(outra, antenaAtual); temp != NULL; temp = procurarArestaDestino(outra, antenaAtual))
+                {
+                    desligarAresta(outra, temp);
+                    libertarAresta(outra, temp);
+                }
+            }
+#endif
 
             // Liberta a memória
             free(antenaAtual);
@@ -556,39 +1386,77 @@ int removerAresta(Vertice *inicio, Vertice *destino)
     }
     else if (destino == NULL) return ERRO_ANTENA_DESTINO_INVALIDA;
 
-    Aresta *arestaAnterior = NULL;
-    Aresta *arestaAtual = (*inicio).primeiraAresta;
+    // Cria as arestas pendentes da origem (a aresta pode ser uma delas)
+    int resultado = materializarArestas(inicio);
+    if (resultado < 0) return resultado;
 
-    if ((*arestaAtual).destino == destino)
-    {
-        (*inicio).primeiraAresta = (*arestaAtual).prox;
-        return 0;
-    }
-    else
-    {
-        arestaAnterior = arestaAtual;
-        arestaAtual = (*arestaAtual).prox;
+    // Procura a aresta (tabela de dispersão ou lista de adjacência)
+    Aresta *aresta = procurarArestaDestino(inicio, destino);
 
-        while (arestaAtual != NULL)
-        {
-            // Verifica se a aresta atual é a que queremos remover
-            if ((*arestaAtual).destino == destino)
-            {
-                // Verifica a posição da aresta (início ou meio/fim)
-                (*arestaAnterior).prox = (*arestaAtual).prox;
+    if (aresta == NULL) return ERRO_ARESTA_NAO_EXISTE;
 
-                // Liberta a memória
-                free(arestaAtual);
+    // Desliga a aresta da origem e do destino
+    desligarAresta(inicio, aresta);
 
-                return 0;
-            }
+    // Liberta a memória
+    libertarAresta(inicio, aresta);
+
+    return 0;
+}
 
-            arestaAnterior = arestaAtual;
-            arestaAtual = (*arestaAtual).prox;
+/**
+ * @brief Desliga uma aresta das listas de adjacência da sua origem e do seu destino.
+ * 
+ * Com "ADJACENCIA_INVERSA" ambas as listas são duplamente ligadas e a operação é O(1); sem ela,
+ * a aresta é procurada na lista de saída da origem.
+ * 
+ * @param origem Vértice de origem da aresta.
+ * @param aresta Apontador para a aresta a desligar (não é libertada).
+ */
+void desligarAresta(Vertice *origem, Aresta *aresta)
+{
+    if ((*origem).cidade != NULL) (*(*origem).cidade).geracao++;
+
+#ifdef ADJACENCIA_INVERSA
+    // Lista de saída da origem
+    if ((*aresta).anterior != NULL) (*(*aresta).anterior).prox = (*aresta).prox;
+    else (*origem).primeiraAresta = (*aresta).prox;
+    if ((*aresta).prox != NULL) (*(*aresta).prox).anterior = (*aresta).anterior;
+
+    // Lista de entrada do destino
+    if ((*aresta).anteriorEntrada != NULL) (*(*aresta).anteriorEntrada).proxEntrada = (*aresta).proxEntrada;
+    else (*(*aresta).destino).primeiraArestaEntrada = (*aresta).proxEntrada;
+    if ((*aresta).proxEntrada != NULL) (*(*aresta).proxEntrada).anteriorEntrada = (*aresta).anteriorEntrada;
+#else
+    // Lista de saída da origem
+    Aresta **ligacao = &(*origem).primeiraAresta;
+    while (*ligacao != aresta) ligacao = &(**ligacao).prox;
+    *ligacao = (*aresta).prox;
+#endif
+
+    // Retira a aresta da tabela de dispersão da origem
+    (*origem).numArestas--;
+
+    if ((*origem).tabelaArestas != NULL)
+    {
+        if ((*origem).numArestas <= LIMIAR_TABELA_ARESTAS / 2)
+        {
+            // Volta à procura linear (histerese evita reconstruções sucessivas)
+            free((*origem).tabelaArestas);
+            (*origem).tabelaArestas = NULL;
+            (*origem).capacidadeTabela = 0;
+        }
+        else
+        {
+            retirarTabelaArestas(origem, aresta);
         }
     }
 
-    return ERRO_ARESTA_NAO_EXISTE;
+    (*aresta).prox = NULL;
+#ifdef ADJACENCIA_INVERSA
+    (*aresta).anterior = NULL;
+    (*aresta).proxEntrada = (*aresta).anteriorEntrada = NULL;
+#endif
 }
 
 /**
@@ -641,8 +1509,8 @@ Vertice *procurarAntena(Grafo *cidade, int x, int y, int *erro)
  * @note A função:
  *       - Verifica a validade dos vértices de início e destino
  *       - Atribui códigos de erro específicos para cada caso de vértice inválido
- *       - Percorre a lista de arestas do vértice de início
- *       - Compara cada destino de aresta com o vértice destino fornecido
+ *       - Consulta a tabela de dispersão do vértice de início (O(1) esperado) ou,
+ *         abaixo de "LIMIAR_TABELA_ARESTAS", percorre a sua lista de arestas
  * 
  * @note Códigos de erro possíveis:
  *       - ERRO_ANTENAS_INICIO_DESTINO_INVALIDAS se ambos vértices forem NULL
@@ -668,15 +1536,20 @@ Aresta *procurarAresta(Vertice *inicio, Vertice *destino, int *erro)
         return NULL;
     }
 
-    // Percorre as arestas e verifica se existe a aresta especificada
-    for (Aresta *arestaAtual = (*inicio).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
+    // Cria as arestas pendentes da origem (a aresta pode ser uma delas)
+    int resultado = materializarArestas(inicio);
+
+    if (resultado < 0)
     {
-        if ((*arestaAtual).destino == destino)
-        {
-            return arestaAtual;
-        }
+        *erro = resultado;
+        return NULL;
     }
 
+    // Verifica se existe a aresta especificada (tabela de dispersão ou lista de adjacência)
+    Aresta *aresta = procurarArestaDestino(inicio, destino);
+
+    if (aresta != NULL) return aresta;
+
     *erro = ERRO_ARESTA_NAO_EXISTE;
     return NULL; /* Retorna NULL caso não tenha encontrado a aresta */
 }
@@ -685,25 +1558,34 @@ Aresta *procurarAresta(Vertice *inicio, Vertice *destino, int *erro)
  * @brief Realiza uma procura em profundidade (DFS) a partir de uma antena.
  * 
  * @param inicio Apontador para a antena de partida.
+ * @param saida Destino das antenas visitadas (NULL escreve no terminal).
  * 
  * @return int 0 se for bem-sucedido
  * @return int "ERRO_ANTENA_INICIO_INVALIDA" se a antena de início for inválida.
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível criar as arestas pendentes de uma antena.
+ * @return int Valor negativo devolvido pela saída (a procura é interrompida).
  */
-int procurarProfundidade(Vertice *inicio)
+int procurarProfundidade(Vertice *inicio, Saida *saida)
 {
     // Verifica se a antena início é válida
     if (inicio == NULL) return ERRO_ANTENA_INICIO_INVALIDA;
 
-    // Marca como visitada e imprime
+    // Marca como visitada e envia para a saída
     (*inicio).visitada = true;
-    printf("'%c'(%d, %d)\n", (*inicio).frequencia, (*inicio).x, (*inicio).y);
+    int resultado = escreverAntena(saida, (*inicio).frequencia, (*inicio).x, (*inicio).y);
+    if (resultado < 0) return resultado;
+
+    // Cria as arestas pendentes antes de expandir a antena
+    resultado = materializarArestas(inicio);
+    if (resultado < 0) return resultado;
 
     // Percorre de forma recursiva as antenas adjacentes não visitadas
     for (Aresta *arestaAtual = (*inicio).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
     {
         if (!(*(*arestaAtual).destino).visitada)
         {
-            procurarProfundidade((*arestaAtual).destino);
+            resultado = procurarProfundidade((*arestaAtual).destino, saida);
+            if (resultado < 0) return resultado;
         }
     }
 
@@ -715,12 +1597,15 @@ int procurarProfundidade(Vertice *inicio)
  * 
  * @param inicio Apontador para a antena de partida.
  * @param numeroAntenas Tamanho do array da lista.
+ * @param saida Destino das antenas visitadas (NULL escreve no terminal).
  * 
  * @return int 0 se for bem-sucedido,
  * @return int "ERRO_ANTENA_INICIO_INVALIDA" se a antena de início for inválida,
  * @return int "ERRO_OVERFLOW_LISTA" se a lista auxiliar exceder o tamanho máximo permitido (overflow).
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível criar as arestas pendentes de uma antena.
+ * @return int Valor negativo devolvido pela saída (a procura é interrompida).
  */
-int procurarLargura(Vertice *inicio, int numeroAntenas)
+int procurarLargura(Vertice *inicio, int numeroAntenas, Saida *saida)
 {
     // Verifica se a antena início é válida
     if (inicio == NULL) return ERRO_ANTENA_INICIO_INVALIDA;
@@ -737,7 +1622,12 @@ int procurarLargura(Vertice *inicio, int numeroAntenas)
     while (anterior > atual)
     {
         Vertice *antenaAtual = lista[atual++];
-        printf("'%c'(%d, %d)\n", (*antenaAtual).frequencia, (*antenaAtual).x, (*antenaAtual).y);
+        int resultado = escreverAntena(saida, (*antenaAtual).frequencia, (*antenaAtual).x, (*antenaAtual).y);
+        if (resultado < 0) return resultado;
+
+        // Cria as arestas pendentes antes de expandir a antena
+        resultado = materializarArestas(antenaAtual);
+        if (resultado < 0) return resultado;
 
         // Percorre os adjacentes não visitados
         for (Aresta *arestaAtual = (*antenaAtual).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
@@ -747,14 +1637,14 @@ int procurarLargura(Vertice *inicio, int numeroAntenas)
             // Adiciona antenas adjacentes não visitadas à fila
             if (!(*destino).visitada)
             {
-                (*destino).visitada = true;
-                lista[anterior++] = destino;
-
-                // Proteção contra overflow da lista (impossível de acontecer)
+                // Proteção contra overflow da lista (antes de escrever fora do vetor)
                 if (anterior >= numeroAntenas)
                 {
                     return ERRO_OVERFLOW_LISTA;
                 }
+
+                (*destino).visitada = true;
+                lista[anterior++] = destino;
             }
         }
     }
@@ -772,6 +1662,7 @@ int procurarLargura(Vertice *inicio, int numeroAntenas)
  * @param inicio Apontador para a antena de origem.
  * @param destino Apontador para a antena de destino.
  * @param numeroAntenas Número total de antenas, utilizado para definir o tamanho máximo do array de caminho.
+ * @param saida Destino dos caminhos encontrados (NULL escreve no terminal).
  * 
  * @return int 1 se pelo menos um caminho for encontrado e impresso,  
  * @return int 0 se nenhum caminho for encontrado,  
@@ -779,7 +1670,7 @@ int procurarLargura(Vertice *inicio, int numeroAntenas)
  * @return int "ERRO_ANTENA_INICIO_INVALIDA" se a antena de início for inválida (NULL),  
  * @return int "ERRO_ANTENA_DESTINO_INVALIDA" se a antena de destino for inválida (NULL).
  */
-int procurarCaminhos(Vertice *inicio, Vertice *destino, int numeroAntenas)
+int procurarCaminhos(Vertice *inicio, Vertice *destino, int numeroAntenas, Saida *saida)
 {
     // Verifica se as antenas de início e destino são válidas
     if (inicio == NULL)
@@ -793,7 +1684,7 @@ int procurarCaminhos(Vertice *inicio, Vertice *destino, int numeroAntenas)
     Vertice *caminho[numeroAntenas];
 
     // Chama a função recursiva de procurar caminhos
-    return procurarCaminhosRecursiva(inicio, destino, caminho, 0);
+    return procurarCaminhosRecursiva(inicio, destino, caminho, 0, saida);
 }
 
 /**
@@ -807,11 +1698,14 @@ int procurarCaminhos(Vertice *inicio, Vertice *destino, int numeroAntenas)
  * @param destino Apontador para o vértice de destino (antena a atingir).
  * @param caminho Array de apontadores para armazenar o caminho atual.
  * @param tamanho Tamanho atual do caminho (número de antenas no caminho até agora).
+ * @param saida Destino dos caminhos encontrados (NULL escreve no terminal).
  * 
  * @return int 1 se pelo menos um caminho for encontrado e impresso,  
  * @return int 0 se nenhum caminho for encontrado a partir deste ramo.
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível criar as arestas pendentes de uma antena.
+ * @return int Valor negativo devolvido pela saída (a procura é interrompida).
  */
-int procurarCaminhosRecursiva(Vertice *inicio, Vertice *destino, Vertice **caminho, int tamanho)
+int procurarCaminhosRecursiva(Vertice *inicio, Vertice *destino, Vertice **caminho, int tamanho, Saida *saida)
 {
     int imprimiu = 0;
 
@@ -819,26 +1713,32 @@ int procurarCaminhosRecursiva(Vertice *inicio, Vertice *destino, Vertice **camin
     (*inicio).visitada = true;
     caminho[tamanho++] = inicio;
 
-    // Se o destino for alcançado, imprimime o caminho completo
+    // Se o destino for alcançado, envia o caminho completo para a saída
     if (inicio == destino)
     {
+        RegistoAntena registos[tamanho];
+
         for (int i = 0; i < tamanho; i++)
         {
-            printf("'%c'(%d, %d)", (*caminho[i]).frequencia, (*caminho[i]).x, (*caminho[i]).y);
-            if (i == tamanho - 1) printf("\n");
-            else printf(" -> ");
+            registos[i] = (RegistoAntena){ (*caminho[i]).frequencia, (*caminho[i]).x, (*caminho[i]).y };
         }
 
-        imprimiu = 1;
+        Resultado resultado = { .tipo = RESULTADO_CAMINHO, .caminho = registos, .tamanho = tamanho };
+        imprimiu = escreverResultado(saida, &resultado);
+        if (imprimiu == 0) imprimiu = 1;
     }
-    else
+    else if ((imprimiu = materializarArestas(inicio)) >= 0) /* Cria as arestas pendentes antes de expandir a antena */
     {
+        imprimiu = 0;
+
         // Percorre de forma recursiva as antenas adjacentes não visitadas
-        for (Aresta *arestaAtual = (*inicio).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
+        for (Aresta *arestaAtual = (*inicio).primeiraAresta; arestaAtual != NULL && imprimiu >= 0; arestaAtual = (*arestaAtual).prox)
         {
             if (!(*(*arestaAtual).destino).visitada)
             {
-                if (procurarCaminhosRecursiva((*arestaAtual).destino, destino, caminho, tamanho) == 1) imprimiu = 1;
+                int resultado = procurarCaminhosRecursiva((*arestaAtual).destino, destino, caminho, tamanho, saida);
+                if (resultado < 0) imprimiu = resultado;
+                else if (resultado == 1) imprimiu = 1;
             }
         }
     }
@@ -850,99 +1750,773 @@ int procurarCaminhosRecursiva(Vertice *inicio, Vertice *destino, Vertice **camin
 }
 
 /**
- * @brief Lista as interseções entre antenas de duas frequências específicadas.
+ * @brief Procura os caminhos entre duas antenas, podando os ramos que já não alcançam o destino.
  * 
- * Para cada par de antenas com frequências diferentes, calcula e imprime o ponto médio entre ambas.
+ * Enumera os mesmos caminhos de "procurarCaminhos" e pela mesma ordem, mas só avança para uma antena
+ * adjacente se esta ainda alcançar o destino sem passar pelas antenas do caminho atual. Para isso mantém
+ * a distância (em arestas) de cada antena ao destino no grafo sem o caminho, calculada por uma procura
+ * em largura nas arestas de entrada a partir do destino (a adjacência inversa é construída no início da
+ * procura, pelos identificadores das antenas, e partilhada por todos os recálculos). Ao acrescentar uma antena
+ * ao caminho, essa procura só é repetida se a antena puder ser um vértice de corte (ver "mantemDistancias").
+ * As distâncias permitem também podar os caminhos que excederiam "maxAntenas".
  * 
- * @param cidade Apontador para o grafo que representa a cidade.
- * @param frequencia1 Carácter da primeira frequência a considerar.
- * @param frequencia2 Carácter da segunda frequência a considerar.
+ * @param cidade Ponteiro para a estrutura do grafo da cidade (as arestas pendentes são criadas e as antenas numeradas).
+ * @param inicio Apontador para a antena de início.
+ * @param destino Apontador para a antena de destino.
+ * @param opcoes Opções da procura (NULL para enviar todos os caminhos para a saída); recebe o número de caminhos.
+ * @param saida Destino dos caminhos encontrados (NULL escreve no terminal).
  * 
- * @return int "imprimiu" que contem o número de interseções encontradas.
- * @return int 0 se não forem encontradas interseções.
- * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o grafo da cidade for inválido.
+ * @return int 1 se pelo menos um caminho for encontrado.  
+ * @return int 0 se nenhum caminho for encontrado.  
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o ponteiro da cidade for inválido (NULL).  
+ * @return int "ERRO_ANTENAS_INICIO_DESTINO_INVALIDAS", "ERRO_ANTENA_INICIO_INVALIDA" ou "ERRO_ANTENA_DESTINO_INVALIDA" se as antenas forem inválidas.  
+ * @return int "ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.  
+ * @return int Valor negativo devolvido pela saída (a procura é interrompida).
+ * 
+ * @note Tal como "procurarCaminhos", assume que nenhuma antena está marcada como visitada.
  */
-int listarIntersecoes(Grafo *cidade, char frequencia1, char frequencia2)
+int procurarCaminhosPodados(Grafo *cidade, Vertice *inicio, Vertice *destino, OpcoesCaminhos *opcoes, Saida *saida)
 {
     // Verifica se o apontador é válido
     if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
 
-    int imprimiu = 0;
+    // Verifica se as antenas de início e destino são válidas
+    if (inicio == NULL)
+    {
+        if (destino == NULL) return ERRO_ANTENAS_INICIO_DESTINO_INVALIDAS;
+        else return ERRO_ANTENA_INICIO_INVALIDA;
+    }
+    else if (destino == NULL) return ERRO_ANTENA_DESTINO_INVALIDA;
 
-    // Verifica as interseções
-    for (Vertice *antenaAtual1 = (*cidade).primeiraAntena; antenaAtual1 != NULL; antenaAtual1 = (*antenaAtual1).prox)
+    OpcoesCaminhos opcoesBase = { 0 };
+    if (opcoes == NULL) opcoes = &opcoesBase;
+    (*opcoes).numCaminhos = 0;
+
+    // As arestas de entrada só ficam completas depois de criadas as arestas pendentes
+    int resultado = materializarTodasArestas(cidade);
+    if (resultado < 0) return resultado;
+
+    numerarAntenas(cidade);
+
+    int numAntenas = (*cidade).numAntenas;
+    ProcuraPodada procura = { destino, NULL, NULL, NULL, NULL, NULL, NULL, numAntenas, opcoes, saida };
+
+    size_t numArestas = 0;
+    for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox) numArestas += (*antena).numArestas;
+
+    procura.caminho = malloc(numAntenas * sizeof(Vertice *));
+    procura.fila = malloc(numAntenas * sizeof(Vertice *));
+    procura.distancia = malloc(numAntenas * sizeof(int));
+    procura.inicioEntradas = calloc((size_t)numAntenas + 1, sizeof(size_t));
+    procura.origens = malloc((numArestas > 0 ? numArestas : 1) * sizeof(Vertice *));
+    if (!(*opcoes).apenasContar) procura.registos = malloc(numAntenas * sizeof(RegistoAntena));
+
+    // Verifica se foi possível alocar a memória
+    if (procura.caminho == NULL || procura.fila == NULL || procura.distancia == NULL || procura.inicioEntradas == NULL
+      || procura.origens == NULL || (!(*opcoes).apenasContar && procura.registos == NULL)) resultado = ERRO_ALOCACAO_MEMORIA;
+    else
     {
-        // Verifica se corresponde à 1.ª frequência
-        if ((*antenaAtual1).frequencia == frequencia1)
+        // Adjacência inversa: conta as arestas de entrada de cada antena e coloca cada origem no fim do seu intervalo
+        for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
         {
-            for (Vertice *antenaAtual2 = (*cidade).primeiraAntena; antenaAtual2 != NULL; antenaAtual2 = (*antenaAtual2).prox)
-            {
-                // Verifica se corresponde à 2.ª frequência
-                if ((*antenaAtual2).frequencia == frequencia2)
-                {
-                    // Filtra vértices iguais
-                    if (antenaAtual1 == antenaAtual2) continue;
-
-                    imprimiu++;
+            for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox) procura.inicioEntradas[(*(*aresta).destino).indice]++;
+        }
+        for (int i = 1; i <= numAntenas; i++) procura.inicioEntradas[i] += procura.inicioEntradas[i - 1];
+        for (Vertice *antena = (*cidade).primeiraAntena; antena != NULL; antena = (*antena).prox)
+        {
+            for (Aresta *aresta = (*antena).primeiraAresta; aresta != NULL; aresta = (*aresta).prox) procura.origens[--procura.inicioEntradas[(*(*aresta).destino).indice]] = antena;
+        }
 
-                    // Calcula a interseção
-                    int intersecaoX = ((*antenaAtual1).x + (*antenaAtual2).x) / 2;
-                    int intersecaoY = ((*antenaAtual1).y + (*antenaAtual2).y) / 2;
+        // O início faz parte do caminho: as distâncias são as do grafo sem ele
+        (*inicio).visitada = true;
+        procura.caminho[0] = inicio;
 
-                    // Imprime os pontos de interseção
-                    printf("'%c'(%d, %d) -x- '%c'(%d, %d) > (%d, %d)\n",
-                      (*antenaAtual1).frequencia, (*antenaAtual1).x, (*antenaAtual1).y,
-                      (*antenaAtual2).frequencia, (*antenaAtual2).x, (*antenaAtual2).y,
-                      intersecaoX, intersecaoY);
-                }
-            }
+        if (inicio == destino) resultado = procurarCaminhosPodadosRecursiva(&procura, inicio, 1);
+        else
+        {
+            calcularDistanciasDestino(&procura);
+            resultado = procurarCaminhosPodadosRecursiva(&procura, inicio, 1);
         }
+
+        (*inicio).visitada = false;
     }
 
-    return imprimiu;
+    free(procura.caminho);
+    free(procura.fila);
+    free(procura.distancia);
+    free(procura.inicioEntradas);
+    free(procura.origens);
+    free(procura.registos);
+
+    if (resultado < 0) return resultado;
+
+    return ((*opcoes).numCaminhos > 0) ? 1 : 0;
 }
 
 /**
- * @brief Lista todas as antenas existentes na cidade.
- * 
- * Imprime todas as antenas (vértices) presentes no grafo, incluindo a sua frequência e coordenadas.
- * 
- * @param cidade Apontador para o grafo que representa a cidade.
+ * @brief Calcula a distância de cada antena ao destino sem passar pelas antenas visitadas (o caminho atual).
  * 
- * @return int 0 se for bem-sucedido, ou -1 se o grafo da cidade for inválido.
+ * Procura em largura nas arestas de entrada, a partir do destino; as antenas que já não o alcançam ficam com -1.
  */
-int listarAntenas(Grafo *cidade)
+static void calcularDistanciasDestino(ProcuraPodada *procura)
 {
-    // Verifica se o apontador é válido
-    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+    Vertice *destino = (*procura).destino;
+    int inicioFila = 0, fimFila = 0;
 
-    // Imprime as antenas
-    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    memset((*procura).distancia, 0xFF, (*procura).numAntenas * sizeof(int));
+
+    (*procura).distancia[(*destino).indice] = 0;
+    (*procura).fila[fimFila++] = destino;
+
+    while (inicioFila < fimFila)
     {
-        printf("'%c'(%d, %d)\n", (*antenaAtual).frequencia, (*antenaAtual).x, (*antenaAtual).y);
-    }
+        Vertice *antena = (*procura).fila[inicioFila++];
+        int distancia = (*procura).distancia[(*antena).indice] + 1;
 
-    return 0;
+        for (size_t e = (*procura).inicioEntradas[(*antena).indice]; e < (*procura).inicioEntradas[(*antena).indice + 1]; e++)
+        {
+            Vertice *origem = (*procura).origens[e];
+
+            if ((*origem).visitada || (*procura).distancia[(*origem).indice] >= 0) continue;
+
+            (*procura).distancia[(*origem).indice] = distancia;
+            (*procura).fila[fimFila++] = origem;
+        }
+    }
 }
 
 /**
- * @brief Lista todas as arestas de uma antena.
- *
- * Esta função percorre e imprime todas as arestas associadas a uma antena específica,
- * apresentando a ligação entre a antena de origem e as antenas de destino.
- * 
- * @param antena Apontador para a antena cujas arestas se pretende listar.
+ * @brief Verifica, de forma barata, que retirar "antena" do grafo não altera as distâncias das restantes ao destino.
  * 
- * @return int 1 se existirem arestas e forem impressas com sucesso.  
- * @return int 0 se a antena for válida mas não tiver arestas.  
- * @return int "ERRO_ANTENA_INICIO_INVALIDA" se o apontador para a antena for inválido (NULL).
+ * Só as antenas à distância d + 1 (sendo d a distância de "antena") podem perder o seu caminho mais curto
+ * através de "antena"; se cada uma delas tiver outro sucessor não visitado à distância d, as distâncias
+ * mantêm-se todas e "antena" não é um vértice de corte. Caso contrário (possível corte), devolve falso e
+ * as distâncias têm de ser recalculadas.
  */
-int listarArestasAntena(Vertice *antena)
+static bool mantemDistancias(ProcuraPodada *procura, Vertice *antena)
 {
-    // Verifica se o apontador antena é valido
+    const int *distancia = (*procura).distancia;
+    int distanciaAntena = distancia[(*antena).indice];
+
+    for (size_t e = (*procura).inicioEntradas[(*antena).indice]; e < (*procura).inicioEntradas[(*antena).indice + 1]; e++)
+    {
+        Vertice *anterior = (*procura).origens[e];
+
+        if ((*anterior).visitada || distancia[(*anterior).indice] != distanciaAntena + 1) continue;
+
+        bool alternativa = false;
+        for (Aresta *saida = (*anterior).primeiraAresta; saida != NULL && !alternativa; saida = (*saida).prox)
+        {
+            Vertice *seguinte = (*saida).destino;
+            alternativa = (seguinte != antena && !(*seguinte).visitada && distancia[(*seguinte).indice] == distanciaAntena);
+        }
+
+        if (!alternativa) return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Função auxiliar recursiva da procura de caminhos com poda.
+ * 
+ * @param procura Estado da procura ("caminho" com "tamanho" antenas, a última é "atual").
+ * @param atual Última antena do caminho (visitada; as distâncias são as do grafo sem o caminho).
+ * @param tamanho Número de antenas do caminho.
+ * 
+ * @return int 0 para continuar a procura, 1 se foi atingido "maxCaminhos".  
+ * @return int Valor negativo devolvido pela saída (a procura é interrompida).
+ */
+static int procurarCaminhosPodadosRecursiva(ProcuraPodada *procura, Vertice *atual, int tamanho)
+{
+    OpcoesCaminhos *opcoes = (*procura).opcoes;
+
+    // Se o destino for alcançado, envia o caminho completo para a saída
+    if (atual == (*procura).destino)
+    {
+        (*opcoes).numCaminhos++;
+
+        if (!(*opcoes).apenasContar)
+        {
+            for (int i = 0; i < tamanho; i++)
+            {
+                Vertice *antena = (*procura).caminho[i];
+                (*procura).registos[i] = (RegistoAntena){ (*antena).frequencia, (*antena).x, (*antena).y };
+            }
+
+            Resultado resultado = { .tipo = RESULTADO_CAMINHO, .caminho = (*procura).registos, .tamanho = tamanho };
+            int escrita = escreverResultado((*procura).saida, &resultado);
+            if (escrita < 0) return escrita;
+        }
+
+        return ((*opcoes).maxCaminhos > 0 && (*opcoes).numCaminhos >= (*opcoes).maxCaminhos) ? 1 : 0;
+    }
+
+    for (Aresta *arestaAtual = (*atual).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
+    {
+        Vertice *seguinte = (*arestaAtual).destino;
+        int distancia = (*procura).distancia[(*seguinte).indice];
+
+        // Poda: a antena já está no caminho, já não alcança o destino ou o caminho ficaria demasiado longo
+        if ((*seguinte).visitada || distancia < 0) continue;
+        if ((*opcoes).maxAntenas > 0 && tamanho + 1 + distancia > (*opcoes).maxAntenas) continue;
+
+        bool recalcular = (seguinte != (*procura).destino && !mantemDistancias(procura, seguinte));
+
+        (*seguinte).visitada = true;
+        (*procura).caminho[tamanho] = seguinte;
+        if (recalcular) calcularDistanciasDestino(procura);
+
+        int resultado = procurarCaminhosPodadosRecursiva(procura, seguinte, tamanho + 1);
+
+        // Repõe o estado (e as distâncias) do caminho anterior; sem recálculo, só a distância de "seguinte"
+        // pode ter mudado (os recálculos mais abaixo tratam-na como parte do caminho)
+        (*seguinte).visitada = false;
+        if (recalcular) calcularDistanciasDestino(procura);
+        else (*procura).distancia[(*seguinte).indice] = distancia;
+
+        if (resultado != 0) return resultado;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Insere um ponto médio no conjunto (tabela de dispersão com endereçamento aberto).
+ * 
+ * @param pontos Conjunto de pontos médios (inicializado a zeros; as chaves são libertadas com "free").
+ * @param x Coordenada x do ponto médio.
+ * @param y Coordenada y do ponto médio.
+ * 
+ * @return 1 se o ponto é novo, 0 se já existia ou "ERRO_ALOCACAO_MEMORIA" se não for possível aumentar a tabela.
+ */
+int inserirPontoMedio(PontosMedios *pontos, int x, int y)
+{
+    int64_t chave = chaveCoordenadas(x, y);
+
+    // A chave reservada para as posições vazias é guardada à parte
+    if (chave == PONTO_MEDIO_VAZIO)
+    {
+        if ((*pontos).temVazio) return 0;
+        (*pontos).temVazio = true;
+        return 1;
+    }
+
+    // Mantém a ocupação abaixo de 1/2
+    if (2 * ((*pontos).numChaves + 1) > (*pontos).capacidade)
+    {
+        // Verifica se a nova capacidade é representável antes de alocar
+        if ((*pontos).capacidade > SIZE_MAX / 2 / sizeof(int64_t)) return ERRO_ALOCACAO_MEMORIA;
+
+        size_t capacidade = ((*pontos).capacidade > 0) ? (*pontos).capacidade * 2 : 1024;
+        int64_t *chaves = malloc(capacidade * sizeof(int64_t));
+
+        // Verifica se foi possível alocar a memória
+        if (chaves == NULL) return ERRO_ALOCACAO_MEMORIA;
+
+        for (size_t i = 0; i < capacidade; i++) chaves[i] = PONTO_MEDIO_VAZIO;
+
+        for (size_t i = 0; i < (*pontos).capacidade; i++)
+        {
+            if ((*pontos).chaves[i] == PONTO_MEDIO_VAZIO) continue;
+
+            size_t posicao = ((uint64_t)(*pontos).chaves[i] * 0x9E3779B97F4A7C15ULL) & (capacidade - 1);
+            while (chaves[posicao] != PONTO_MEDIO_VAZIO) posicao = (posicao + 1) & (capacidade - 1);
+            chaves[posicao] = (*pontos).chaves[i];
+        }
+
+        free((*pontos).chaves);
+        (*pontos).chaves = chaves;
+        (*pontos).capacidade = capacidade;
+    }
+
+    size_t posicao = ((uint64_t)chave * 0x9E3779B97F4A7C15ULL) & ((*pontos).capacidade - 1);
+
+    while ((*pontos).chaves[posicao] != PONTO_MEDIO_VAZIO)
+    {
+        if ((*pontos).chaves[posicao] == chave) return 0;
+        posicao = (posicao + 1) & ((*pontos).capacidade - 1);
+    }
+
+    (*pontos).chaves[posicao] = chave;
+    (*pontos).numChaves++;
+
+    return 1;
+}
+
+/**
+ * @brief Calcula as interseções de um par de grupos de frequência, sem repetir pontos médios.
+ * 
+ * Os pares são percorridos pela ordem dos grupos e cada ponto médio é entregue à função assim que surge
+ * pela primeira vez (com o par que o originou). Só os pontos médios já vistos são guardados (num conjunto
+ * de chaves), pelo que a memória depende do número de interseções distintas e não do número de pares.
+ * 
+ * @param cidade Grafo da cidade (válido).
+ * @param frequencia1 1.ª frequência.
+ * @param frequencia2 2.ª frequência (se for igual à 1.ª, cada par não ordenado é considerado uma vez).
+ * @param funcao Função chamada para cada ponto médio distinto.
+ * @param contexto Apontador passado à função.
+ * @param distintas Recebe o número de interseções distintas.
+ * 
+ * @return 0 em caso de sucesso, ou o valor negativo devolvido pela função / "ERRO_ALOCACAO_MEMORIA".
+ */
+static int intersecoesFrequencias(Grafo *cidade, char frequencia1, char frequencia2, FuncaoIntersecao funcao, void *contexto, int64_t *distintas)
+{
+    unsigned char indice1 = (unsigned char)frequencia1;
+    unsigned char indice2 = (unsigned char)frequencia2;
+    PontosMedios pontos = { NULL, 0, 0, false };
+    int resultado = 0;
+
+    // Percorre apenas os grupos das duas frequências: O(k1 * k2)
+    for (Vertice *antena1 = (*cidade).primeiraAntenaFrequencia[indice1]; antena1 != NULL && resultado == 0; antena1 = (*antena1).proxFrequencia)
+    {
+        Vertice *inicio2 = (indice1 == indice2) ? (*antena1).proxFrequencia : (*cidade).primeiraAntenaFrequencia[indice2];
+
+        for (Vertice *antena2 = inicio2; antena2 != NULL; antena2 = (*antena2).proxFrequencia)
+        {
+            Intersecao intersecao = { antena1, antena2, ((*antena1).x + (*antena2).x) / 2, ((*antena1).y + (*antena2).y) / 2 };
+
+            resultado = inserirPontoMedio(&pontos, intersecao.x, intersecao.y);
+            if (resultado < 0) break;
+            if (resultado == 0) continue;
+
+            (*distintas)++;
+            resultado = (funcao != NULL) ? funcao(&intersecao, contexto) : 0;
+            if (resultado < 0) break;
+            resultado = 0;
+        }
+    }
+
+    free(pontos.chaves);
+
+    return resultado;
+}
+
+/**
+ * @brief Procura as interseções entre antenas de duas frequências específicadas.
+ * 
+ * Para cada par de antenas (uma de cada frequência), calcula o ponto médio entre ambas. Só são percorridos
+ * os grupos das duas frequências (O(k1 * k2)) e cada ponto médio é entregue uma única vez à função indicada,
+ * assim que surge (pela ordem dos grupos de frequência), com o primeiro par que o origina.
+ * 
+ * @note Se "frequencia1" e "frequencia2" forem iguais, cada par não ordenado é considerado uma vez: os pares
+ *       (a, b) e (b, a) têm o mesmo ponto médio, pelo que o resultado é o mesmo que com os pares ordenados
+ *       (o par apresentado é um dos dois). Os pares de uma antena consigo própria não são considerados.
+ * @note O número de interseções é limitado a INT_MAX (a procura continua a entregá-las todas à função).
+ * 
+ * @param cidade Apontador para o grafo que representa a cidade.
+ * @param frequencia1 Carácter da primeira frequência a considerar.
+ * @param frequencia2 Carácter da segunda frequência a considerar.
+ * @param funcao Função chamada para cada interseção (pode ser NULL para apenas contar).
+ * @param contexto Apontador passado à função.
+ * 
+ * @return int número de interseções distintas encontradas (0 se não existirem).
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o grafo da cidade for inválido.
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ * @return int o valor negativo devolvido pela função, se esta interromper a procura.
+ */
+int procurarIntersecoes(Grafo *cidade, char frequencia1, char frequencia2, FuncaoIntersecao funcao, void *contexto)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    int64_t distintas = 0;
+    int resultado = intersecoesFrequencias(cidade, frequencia1, frequencia2, funcao, contexto, &distintas);
+    if (resultado < 0) return resultado;
+
+    return (distintas > INT_MAX) ? INT_MAX : (int)distintas;
+}
+
+/**
+ * @brief Insere um ponto médio de um par de frequências no conjunto das interseções já vistas.
+ * 
+ * @param vistas Conjunto (inicializado a zeros; os vetores são libertados com "free").
+ * @param x Coordenada x do ponto médio.
+ * @param y Coordenada y do ponto médio.
+ * @param par Par de frequências (f1 * 256 + f2, com f1 < f2; nunca é 0, que marca as posições vazias).
+ * 
+ * @return 1 se a interseção é nova, 0 se já existia ou "ERRO_ALOCACAO_MEMORIA" se não for possível aumentar a tabela.
+ */
+static int inserirIntersecaoVista(IntersecoesVistas *vistas, int x, int y, uint16_t par)
+{
+    int64_t ponto = chaveCoordenadas(x, y);
+
+    // Mantém a ocupação abaixo de 1/2
+    if (2 * ((*vistas).numChaves + 1) > (*vistas).capacidade)
+    {
+        // Verifica se a nova capacidade é representável antes de alocar
+        if ((*vistas).capacidade > SIZE_MAX / 2 / sizeof(int64_t)) return ERRO_ALOCACAO_MEMORIA;
+
+        size_t capacidade = ((*vistas).capacidade > 0) ? (*vistas).capacidade * 2 : 1024;
+        int64_t *pontos = malloc(capacidade * sizeof(int64_t));
+        uint16_t *pares = calloc(capacidade, sizeof(uint16_t));
+
+        // Verifica se foi possível alocar a memória
+        if (pontos == NULL || pares == NULL)
+        {
+            free(pontos);
+            free(pares);
+            return ERRO_ALOCACAO_MEMORIA;
+        }
+
+        for (size_t i = 0; i < (*vistas).capacidade; i++)
+        {
+            if ((*vistas).pares[i] == 0) continue;
+
+            uint64_t chave = ((uint64_t)(*vistas).pontos[i] ^ ((uint64_t)(*vistas).pares[i] << 48)) * 0x9E3779B97F4A7C15ULL;
+            size_t posicao = (size_t)(chave >> 32) & (capacidade - 1);
+            while (pares[posicao] != 0) posicao = (posicao + 1) & (capacidade - 1);
+            pontos[posicao] = (*vistas).pontos[i];
+            pares[posicao] = (*vistas).pares[i];
+        }
+
+        free((*vistas).pontos);
+        free((*vistas).pares);
+        (*vistas).pontos = pontos;
+        (*vistas).pares = pares;
+        (*vistas).capacidade = capacidade;
+    }
+
+    uint64_t chave = ((uint64_t)ponto ^ ((uint64_t)par << 48)) * 0x9E3779B97F4A7C15ULL;
+    size_t posicao = (size_t)(chave >> 32) & ((*vistas).capacidade - 1);
+
+    while ((*vistas).pares[posicao] != 0)
+    {
+        if ((*vistas).pares[posicao] == par && (*vistas).pontos[posicao] == ponto) return 0;
+        posicao = (posicao + 1) & ((*vistas).capacidade - 1);
+    }
+
+    (*vistas).pontos[posicao] = ponto;
+    (*vistas).pares[posicao] = par;
+    (*vistas).numChaves++;
+
+    return 1;
+}
+
+/**
+ * @brief Procura as interseções de todos os pares de frequências distintas numa única passagem.
+ * 
+ * A lista de antenas é percorrida uma só vez: cada antena é emparelhada com os grupos das frequências
+ * maiores do que a sua (pelo índice por frequência), pelo que cada par de antenas com frequências
+ * diferentes é visto uma vez. Os pontos médios já entregues são guardados num único conjunto, indexado
+ * pelo ponto médio e pelo par de frequências (em vez de um conjunto por par de frequências).
+ * 
+ * @note Cada interseção é entregue com a antena da menor frequência em "antena1", tal como em
+ *       "procurarIntersecoes" com a menor frequência em "frequencia1".
+ * 
+ * @param cidade Apontador para o grafo que representa a cidade.
+ * @param funcao Função chamada para cada interseção (pode ser NULL para apenas contar).
+ * @param contexto Apontador passado à função.
+ * 
+ * @return int número total de interseções distintas (somadas por par de frequências).
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o grafo da cidade for inválido.
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ * @return int o valor negativo devolvido pela função, se esta interromper a procura.
+ */
+int procurarTodasIntersecoes(Grafo *cidade, FuncaoIntersecao funcao, void *contexto)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    // Frequências presentes na cidade e, para cada frequência, a posição da primeira frequência maior
+    unsigned char frequencias[NUM_FREQUENCIAS];
+    int seguinte[NUM_FREQUENCIAS];
+    int numFrequencias = 0;
+
+    for (int i = 0; i < NUM_FREQUENCIAS; i++)
+    {
+        if ((*cidade).numAntenasFrequencia[i] > 0) frequencias[numFrequencias++] = (unsigned char)i;
+        seguinte[i] = numFrequencias;
+    }
+
+    IntersecoesVistas vistas = { NULL, NULL, 0, 0 };
+    int64_t total = 0;
+    int resultado = 0;
+
+    for (Vertice *antena1 = (*cidade).primeiraAntena; antena1 != NULL && resultado == 0; antena1 = (*antena1).prox)
+    {
+        unsigned char frequencia1 = (unsigned char)(*antena1).frequencia;
+
+        for (int j = seguinte[frequencia1]; j < numFrequencias && resultado == 0; j++)
+        {
+            uint16_t par = (uint16_t)(frequencia1 * NUM_FREQUENCIAS + frequencias[j]);
+
+            for (Vertice *antena2 = (*cidade).primeiraAntenaFrequencia[frequencias[j]]; antena2 != NULL; antena2 = (*antena2).proxFrequencia)
+            {
+                Intersecao intersecao = { antena1, antena2, ((*antena1).x + (*antena2).x) / 2, ((*antena1).y + (*antena2).y) / 2 };
+
+                resultado = inserirIntersecaoVista(&vistas, intersecao.x, intersecao.y, par);
+                if (resultado < 0) break;
+                if (resultado == 0) continue;
+
+                total++;
+                resultado = (funcao != NULL) ? funcao(&intersecao, contexto) : 0;
+                if (resultado < 0) break;
+                resultado = 0;
+            }
+        }
+    }
+
+    free(vistas.pontos);
+    free(vistas.pares);
+
+    if (resultado < 0) return resultado;
+
+    return (total > INT_MAX) ? INT_MAX : (int)total;
+}
+
+/**
+ * @brief Envia uma interseção para a saída "contexto" (função usada por "listarIntersecoes" e "listarTodasIntersecoes").
+ */
+static int imprimirIntersecao(const Intersecao *intersecao, void *contexto)
+{
+    Resultado resultado =
+    {
+        .tipo = RESULTADO_INTERSECAO,
+        .antena = { (*(*intersecao).antena1).frequencia, (*(*intersecao).antena1).x, (*(*intersecao).antena1).y },
+        .outra = { (*(*intersecao).antena2).frequencia, (*(*intersecao).antena2).x, (*(*intersecao).antena2).y },
+        .x = (*intersecao).x,
+        .y = (*intersecao).y
+    };
+
+    return escreverResultado((Saida *)contexto, &resultado);
+}
+
+/**
+ * @brief Contexto usado para recolher os resultados das consultas espaciais num vetor.
+ */
+typedef struct RecolhaAntenas
+{
+    Vertice **resultados;
+    int capacidade;
+    int total;
+
+} RecolhaAntenas;
+
+/**
+ * @brief Guarda uma antena encontrada no vetor de resultados (se ainda houver espaço).
+ */
+static int recolherAntena(int x, int y, void *dados, void *contexto)
+{
+    (void)x;
+    (void)y;
+    RecolhaAntenas *recolha = contexto;
+
+    if ((*recolha).resultados != NULL && (*recolha).total < (*recolha).capacidade) (*recolha).resultados[(*recolha).total] = dados;
+    (*recolha).total++;
+
+    return 0;
+}
+
+/**
+ * @brief Procura as antenas a uma distância (euclidiana) de (x, y) inferior ou igual a "raio".
+ *
+ * @param cidade Apontador para o grafo que representa a cidade.
+ * @param x Coordenada x do centro.
+ * @param y Coordenada y do centro.
+ * @param raio Raio da procura.
+ * @param resultados Vetor onde são guardadas as antenas encontradas (pode ser NULL para apenas contar).
+ * @param capacidade Número de posições de "resultados".
+ *
+ * @note Usa o índice espacial se existir; caso contrário percorre a lista de antenas.
+ *
+ * @return int número total de antenas encontradas (só as primeiras "capacidade" são guardadas).
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o grafo da cidade for inválido.
+ */
+int procurarAntenasRaio(Grafo *cidade, int x, int y, int raio, Vertice **resultados, int capacidade)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    RecolhaAntenas recolha = { resultados, capacidade, 0 };
+
+    if ((*cidade).indiceEspacial != NULL)
+    {
+        consultarRaio((*cidade).indiceEspacial, x, y, raio, recolherAntena, &recolha);
+        return recolha.total;
+    }
+
+    // Sem índice: percorre a lista (ordenada por y) apenas na faixa [y - raio, y + raio]
+    int64_t raio2 = (int64_t)raio * raio;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL && (int64_t)(*antenaAtual).y <= (int64_t)y + raio; antenaAtual = (*antenaAtual).prox)
+    {
+        int64_t dx = (int64_t)(*antenaAtual).x - x, dy = (int64_t)(*antenaAtual).y - y;
+        if (dx * dx + dy * dy <= raio2) recolherAntena((*antenaAtual).x, (*antenaAtual).y, antenaAtual, &recolha);
+    }
+
+    return recolha.total;
+}
+
+/**
+ * @brief Procura as antenas dentro do retângulo [x1, x2] x [y1, y2] (limites incluídos).
+ *
+ * @param cidade Apontador para o grafo que representa a cidade.
+ * @param x1 Limite esquerdo.
+ * @param y1 Limite superior.
+ * @param x2 Limite direito.
+ * @param y2 Limite inferior.
+ * @param resultados Vetor onde são guardadas as antenas encontradas (pode ser NULL para apenas contar).
+ * @param capacidade Número de posições de "resultados".
+ *
+ * @note Usa o índice espacial se existir; caso contrário percorre a lista de antenas.
+ *
+ * @return int número total de antenas encontradas (só as primeiras "capacidade" são guardadas).
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o grafo da cidade for inválido.
+ */
+int procurarAntenasRetangulo(Grafo *cidade, int x1, int y1, int x2, int y2, Vertice **resultados, int capacidade)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    RecolhaAntenas recolha = { resultados, capacidade, 0 };
+
+    if ((*cidade).indiceEspacial != NULL)
+    {
+        consultarRetangulo((*cidade).indiceEspacial, x1, y1, x2, y2, recolherAntena, &recolha);
+        return recolha.total;
+    }
+
+    // Sem índice: percorre a lista (ordenada por y) até ao limite inferior
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL && (*antenaAtual).y <= y2; antenaAtual = (*antenaAtual).prox)
+    {
+        if ((*antenaAtual).y >= y1 && (*antenaAtual).x >= x1 && (*antenaAtual).x <= x2) recolherAntena((*antenaAtual).x, (*antenaAtual).y, antenaAtual, &recolha);
+    }
+
+    return recolha.total;
+}
+
+/**
+ * @brief Procura as k antenas mais próximas de (x, y).
+ *
+ * @param cidade Apontador para o grafo que representa a cidade.
+ * @param x Coordenada x do ponto de consulta.
+ * @param y Coordenada y do ponto de consulta.
+ * @param k Número de antenas pretendido.
+ * @param resultados Vetor com pelo menos "k" posições, preenchido por ordem crescente de distância.
+ *
+ * @note Sem índice espacial é criado um índice temporário para a consulta.
+ *
+ * @return int número de antenas encontradas (no máximo "k").
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o grafo da cidade for inválido.
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int procurarAntenasProximas(Grafo *cidade, int x, int y, int k, Vertice **resultados)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+    if (resultados == NULL || k <= 0) return 0;
+
+    PontoEspacial **pontos = malloc(k * sizeof(PontoEspacial *));
+
+    // Verifica se foi possível alocar a memória
+    if (pontos == NULL) return ERRO_ALOCACAO_MEMORIA;
+
+    // Usa o índice da cidade ou um índice temporário
+    IndiceEspacial *indice = (*cidade).indiceEspacial;
+    bool temporario = (indice == NULL);
+
+    if (temporario)
+    {
+        indice = criarIndiceEspacial(TAMANHO_CELULA_PREDEFINIDO);
+        for (Vertice *antenaAtual = (*cidade).primeiraAntena; indice != NULL && antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+        {
+            if (inserirIndiceEspacial(indice, (*antenaAtual).x, (*antenaAtual).y, antenaAtual) < 0) indice = libertarIndiceEspacial(indice);
+        }
+    }
+
+    int encontrados = (indice != NULL) ? consultarVizinhosProximos(indice, x, y, k, pontos) : ERRO_ALOCACAO_MEMORIA;
+
+    for (int i = 0; i < encontrados; i++) resultados[i] = (*pontos[i]).dados;
+
+    if (temporario) libertarIndiceEspacial(indice);
+    free(pontos);
+
+    return (encontrados < 0) ? ERRO_ALOCACAO_MEMORIA : encontrados;
+}
+
+/**
+ * @brief Lista as interseções entre antenas de duas frequências específicadas.
+ * 
+ * Imprime cada ponto médio distinto (ver "procurarIntersecoes") com o primeiro par de antenas que o origina.
+ * 
+ * @param cidade Apontador para o grafo que representa a cidade.
+ * @param frequencia1 Carácter da primeira frequência a considerar.
+ * @param frequencia2 Carácter da segunda frequência a considerar.
+ * @param saida Destino das interseções (NULL escreve no terminal).
+ * 
+ * @return int "imprimiu" que contem o número de interseções encontradas.
+ * @return int 0 se não forem encontradas interseções.
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o grafo da cidade for inválido.
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int listarIntersecoes(Grafo *cidade, char frequencia1, char frequencia2, Saida *saida)
+{
+    return procurarIntersecoes(cidade, frequencia1, frequencia2, imprimirIntersecao, saida);
+}
+
+/**
+ * @brief Lista as interseções de todos os pares de frequências distintas da cidade.
+ * 
+ * @param cidade Apontador para o grafo que representa a cidade.
+ * @param saida Destino das interseções (NULL escreve no terminal).
+ * 
+ * @return int número total de interseções impressas (0 se não existirem).
+ * @return int "ERRO_CIDADE_PONTEIRO_INVALIDO" se o grafo da cidade for inválido.
+ * @return int "ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int listarTodasIntersecoes(Grafo *cidade, Saida *saida)
+{
+    return procurarTodasIntersecoes(cidade, imprimirIntersecao, saida);
+}
+
+/**
+ * @brief Lista todas as antenas existentes na cidade.
+ * 
+ * Imprime todas as antenas (vértices) presentes no grafo, incluindo a sua frequência e coordenadas.
+ * 
+ * @param cidade Apontador para o grafo que representa a cidade.
+ * @param saida Destino das antenas (NULL escreve no terminal).
+ * 
+ * @return int 0 se for bem-sucedido, ou -1 se o grafo da cidade for inválido.
+ */
+int listarAntenas(Grafo *cidade, Saida *saida)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    // Envia as antenas para a saída
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        int resultado = escreverAntena(saida, (*antenaAtual).frequencia, (*antenaAtual).x, (*antenaAtual).y);
+        if (resultado < 0) return resultado;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Lista todas as arestas de uma antena.
+ *
+ * Esta função percorre e imprime todas as arestas associadas a uma antena específica,
+ * apresentando a ligação entre a antena de origem e as antenas de destino.
+ * 
+ * @param antena Apontador para a antena cujas arestas se pretende listar.
+ * @param saida Destino das arestas (NULL escreve no terminal).
+ * 
+ * @return int 1 se existirem arestas e forem impressas com sucesso.  
+ * @return int 0 se a antena for válida mas não tiver arestas.  
+ * @return int "ERRO_ANTENA_INICIO_INVALIDA" se o apontador para a antena for inválido (NULL).
+ */
+int listarArestasAntena(Vertice *antena, Saida *saida)
+{
+    // Verifica se o apontador antena é valido
     if (antena == NULL) return ERRO_ANTENA_INICIO_INVALIDA;
 
-    int imprimiu = 0;
+    int imprimiu = materializarArestas(antena);
+    if (imprimiu < 0) return imprimiu;
+
+    imprimiu = 0;
 
     if ((*antena).primeiraAresta != NULL)
     {
@@ -950,11 +2524,409 @@ int listarArestasAntena(Vertice *antena)
 
         for (Aresta *arestaAtual = (*antena).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
         {
-            printf("'%c'(%d, %d) -> '%c'(%d, %d)\n",
-              (*antena).frequencia, (*antena).x, (*antena).y,
+            int resultado = escreverAresta(saida, (*antena).frequencia, (*antena).x, (*antena).y,
               (*(*arestaAtual).destino).frequencia, (*(*arestaAtual).destino).x, (*(*arestaAtual).destino).y);
+            if (resultado < 0) return resultado;
         }
     }
 
     return imprimiu;
-}
\ No newline at end of file
+}
+
+/**
+ * @brief Lista todas as arestas que chegam a uma antena (predecessores).
+ *
+ * Percorre a lista de entrada (adjacência inversa) da antena, apresentando a ligação
+ * entre cada antena de origem e a antena indicada. Sem "ADJACENCIA_INVERSA" as origens são
+ * procuradas nas listas de saída das antenas da cidade da antena (nenhuma, fora de uma cidade).
+ * 
+ * @param antena Apontador para a antena cujas arestas de entrada se pretende listar.
+ * @param saida Destino das arestas (NULL escreve no terminal).
+ * 
+ * @return int 1 se existirem arestas de entrada e forem impressas com sucesso.  
+ * @return int 0 se a antena for válida mas não tiver arestas de entrada.  
+ * @return int "ERRO_ANTENA_INICIO_INVALIDA" se o apontador para a antena for inválido (NULL).
+ */
+int listarArestasEntradaAntena(Vertice *antena, Saida *saida)
+{
+    // Verifica se o apontador antena é valido
+    if (antena == NULL) return ERRO_ANTENA_INICIO_INVALIDA;
+
+    // As arestas de entrada pendentes só podem vir de antenas com a mesma frequência
+    for (int sentido = 0; sentido < 2; sentido++)
+    {
+        for (Vertice *outra = (sentido == 0) ? (*antena).anteriorFrequencia : (*antena).proxFrequencia;
+             outra != NULL;
+             outra = (sentido == 0) ? (*outra).anteriorFrequencia : (*outra).proxFrequencia)
+        {
+            int resultado = materializarArestas(outra);
+            if (resultado < 0) return resultado;
+        }
+    }
+
+    int imprimiu = 0;
+
+#ifdef ADJACENCIA_INVERSA
+    for (Aresta *arestaAtual = (*antena).primeiraArestaEntrada; arestaAtual != NULL; arestaAtual = (*arestaAtual).proxEntrada)
+    {
+        Vertice *origem = (*arestaAtual).origem;
+        imprimiu = 1;
+
+        int resultado = escreverAresta(saida, (*origem).frequencia, (*origem).x, (*origem).y, (*antena).frequencia, (*antena).x, (*antena).y);
+        if (resultado < 0) return resultado;
+    }
+#else
+    for (Vertice *origem = ((*antena).cidade != NULL) ? (*(*antena).cidade).primeiraAntena : NULL; origem != NULL; origem = (*origem).prox)
+    {
+        // A tabela de dispersão (se existir) evita percorrer as listas que não chegam à antena
+        if (procurarArestaDestino(origem, antena) == NULL) continue;
+
+        for (Aresta *arestaAtual = (*origem).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
+        {
+            if ((*arestaAtual).destino != antena) continue;
+            imprimiu = 1;
+
+            int resultado = escreverAresta(saida, (*origem).frequencia, (*origem).x, (*origem).y, (*antena).frequencia, (*antena).x, (*antena).y);
+            if (resultado < 0) return resultado;
+        }
+    }
+#endif
+
+    return imprimiu;
+}
+
+/*---- Operações em lote -----------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Calcula a chave de ordenação (y, x) de umas coordenadas.
+ * 
+ * A chave agrupa y nos 32 bits superiores e x (deslocado para não negativo) nos 32 inferiores,
+ * pelo que a ordem das chaves coincide com a ordem (y crescente, x crescente) da lista de antenas.
+ * 
+ * @param x Coordenada x.
+ * @param y Coordenada y.
+ * 
+ * @return Chave de 64 bits.
+ */
+static inline int64_t chaveCoordenadas(int x, int y)
+{
+    return (int64_t)y * 4294967296LL + ((int64_t)x - INT32_MIN);
+}
+
+/**
+ * @brief Compara duas chaves de lote para o "qsort" (por chave e, em empate, pela posição original).
+ */
+static int compararChavesLote(const void *a, const void *b)
+{
+    const ChaveLote *chaveA = a;
+    const ChaveLote *chaveB = b;
+
+    if ((*chaveA).chave != (*chaveB).chave) return ((*chaveA).chave > (*chaveB).chave) - ((*chaveA).chave < (*chaveB).chave);
+
+    return (*chaveA).indice - (*chaveB).indice;
+}
+
+/**
+ * @brief Cria o vetor (chave, índice) de um lote, ordenado por (y, x) e, em empate, pela posição no lote.
+ * 
+ * @param lote Vetor de registos.
+ * @param quantidade Número de registos.
+ * 
+ * @return Vetor alocado (libertar com "free").
+ * @return NULL em caso de falha na alocação de memória.
+ */
+static ChaveLote *ordenarLote(const RegistoAntena *lote, int quantidade)
+{
+    ChaveLote *ordem = malloc(quantidade * sizeof(ChaveLote));
+
+    // Verifica se foi possível alocar a memória
+    if (ordem == NULL) return NULL;
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        ordem[i].chave = chaveCoordenadas(lote[i].x, lote[i].y);
+        ordem[i].indice = i;
+    }
+
+    qsort(ordem, quantidade, sizeof(ChaveLote), compararChavesLote);
+
+    return ordem;
+}
+
+/*---- Índices (por frequência e espacial) -----------------------------------------------------------------------------------*/
+
+/**
+ * @brief Acrescenta uma antena recém-inserida aos índices da cidade.
+ * 
+ * @note Se o índice espacial não conseguir alocar memória, é descartado (as consultas passam a percorrer a lista).
+ */
+static void indexarAntena(Grafo *cidade, Vertice *antena)
+{
+    (*cidade).geracao++;
+    (*antena).cidade = cidade;
+    (*antena).geracaoInsercao = (*cidade).geracao;
+    indexarFrequencia(cidade, antena);
+
+    if ((*cidade).indiceEspacial != NULL && inserirIndiceEspacial((*cidade).indiceEspacial, (*antena).x, (*antena).y, antena) < 0)
+    {
+        (*cidade).indiceEspacial = libertarIndiceEspacial((*cidade).indiceEspacial);
+    }
+}
+
+/**
+ * @brief Retira uma antena (prestes a ser removida) dos índices da cidade.
+ */
+static void desindexarAntena(Grafo *cidade, Vertice *antena)
+{
+    (*cidade).geracao++;
+    (*antena).cidade = NULL;
+    desindexarFrequencia(cidade, antena);
+
+    if ((*cidade).indiceEspacial != NULL) removerIndiceEspacial((*cidade).indiceEspacial, (*antena).x, (*antena).y, antena);
+}
+
+/**
+ * @brief Acrescenta uma antena ao grupo da sua frequência, na posição correspondente à da lista.
+ * 
+ * A posição é procurada a partir do fim do grupo pela ordem (y, x) da lista, pelo que as antenas
+ * acrescentadas no fim (carregamento de um mapa) são agrupadas em O(1).
+ * 
+ * @param cidade Grafo da cidade.
+ * @param antena Antena a agrupar.
+ */
+static void indexarFrequencia(Grafo *cidade, Vertice *antena)
+{
+    unsigned char indice = (unsigned char)(*antena).frequencia;
+    int64_t chave = chaveCoordenadas((*antena).x, (*antena).y);
+
+    Vertice *anterior = (*cidade).ultimaAntenaFrequencia[indice];
+    while (anterior != NULL && chaveCoordenadas((*anterior).x, (*anterior).y) > chave) anterior = (*anterior).anteriorFrequencia;
+
+    (*antena).anteriorFrequencia = anterior;
+    (*antena).proxFrequencia = (anterior != NULL) ? (*anterior).proxFrequencia : (*cidade).primeiraAntenaFrequencia[indice];
+
+    if (anterior != NULL) (*anterior).proxFrequencia = antena;
+    else (*cidade).primeiraAntenaFrequencia[indice] = antena;
+    if ((*antena).proxFrequencia != NULL) (*(*antena).proxFrequencia).anteriorFrequencia = antena;
+    else (*cidade).ultimaAntenaFrequencia[indice] = antena;
+
+    (*cidade).numAntenasFrequencia[indice]++;
+}
+
+/**
+ * @brief Retira uma antena do grupo da sua frequência (O(1)).
+ * 
+ * @param cidade Grafo da cidade.
+ * @param antena Antena a retirar.
+ */
+static void desindexarFrequencia(Grafo *cidade, Vertice *antena)
+{
+    unsigned char indice = (unsigned char)(*antena).frequencia;
+
+    if ((*antena).anteriorFrequencia != NULL) (*(*antena).anteriorFrequencia).proxFrequencia = (*antena).proxFrequencia;
+    else (*cidade).primeiraAntenaFrequencia[indice] = (*antena).proxFrequencia;
+    if ((*antena).proxFrequencia != NULL) (*(*antena).proxFrequencia).anteriorFrequencia = (*antena).anteriorFrequencia;
+    else (*cidade).ultimaAntenaFrequencia[indice] = (*antena).anteriorFrequencia;
+
+    (*antena).proxFrequencia = (*antena).anteriorFrequencia = NULL;
+    (*cidade).numAntenasFrequencia[indice]--;
+}
+
+/*---- Interligação por distância --------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Acrescenta uma antena encontrada na grelha aos candidatos da antena de origem.
+ * 
+ * @return 0 para continuar a consulta; -1 se não for possível alocar memória.
+ */
+static int recolherVizinho(int x, int y, void *dados, void *contexto)
+{
+    RecolhaVizinhos *recolha = contexto;
+    Vertice *antena = dados;
+    Vertice *origem = (*recolha).origem;
+
+    // Ignora a própria antena e as frequências não pedidas
+    if (antena == origem) return 0;
+    if ((*antena).frequencia == (*origem).frequencia ? !(*recolha).FrequenciasIguais : !(*recolha).FrequenciasDiferentes) return 0;
+
+    // Aumenta o vetor de candidatos se necessário
+    if ((*recolha).numCandidatos == (*recolha).capacidade)
+    {
+        int capacidade = (*recolha).capacidade > 0 ? 2 * (*recolha).capacidade : 16;
+        VizinhoCandidato *candidatos = realloc((*recolha).candidatos, capacidade * sizeof(VizinhoCandidato));
+
+        // Verifica se foi possível alocar a memória
+        if (candidatos == NULL) return -1;
+
+        (*recolha).candidatos = candidatos;
+        (*recolha).capacidade = capacidade;
+    }
+
+    int64_t dx = (int64_t)x - (*origem).x, dy = (int64_t)y - (*origem).y;
+    (*recolha).candidatos[(*recolha).numCandidatos].antena = antena;
+    (*recolha).candidatos[(*recolha).numCandidatos].distancia2 = dx * dx + dy * dy;
+    (*recolha).numCandidatos++;
+
+    return 0;
+}
+
+/**
+ * @brief Compara dois candidatos para o "qsort" (por distância e, em empate, pela ordem (y, x)).
+ */
+static int compararVizinhos(const void *a, const void *b)
+{
+    const VizinhoCandidato *vizinhoA = a;
+    const VizinhoCandidato *vizinhoB = b;
+
+    if ((*vizinhoA).distancia2 != (*vizinhoB).distancia2) return ((*vizinhoA).distancia2 > (*vizinhoB).distancia2) - ((*vizinhoA).distancia2 < (*vizinhoB).distancia2);
+
+    int64_t chaveA = chaveCoordenadas((*(*vizinhoA).antena).x, (*(*vizinhoA).antena).y);
+    int64_t chaveB = chaveCoordenadas((*(*vizinhoB).antena).x, (*(*vizinhoB).antena).y);
+
+    return (chaveA > chaveB) - (chaveA < chaveB);
+}
+
+/*---- Reserva de arestas ----------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Reserva uma aresta da cidade: uma libertada, se existir, senão a próxima posição do bloco atual
+ *        (alocando um bloco novo quando o atual está cheio).
+ * 
+ * @return Apontador para a aresta (por inicializar) ou NULL se não for possível alocar memória.
+ */
+static inline Aresta *reservarAresta(Grafo *cidade)
+{
+    // Reutiliza a última aresta libertada
+    Aresta *aresta = (*cidade).arestasLivres;
+
+    if (aresta != NULL)
+    {
+        (*cidade).arestasLivres = (*aresta).prox;
+        return aresta;
+    }
+
+    if ((*cidade).blocosArestas == NULL || (*cidade).arestasUsadasBloco == ARESTAS_POR_BLOCO)
+    {
+        BlocoArestas *bloco = malloc(sizeof(BlocoArestas) + ARESTAS_POR_BLOCO * sizeof(Aresta));
+
+        // Verifica se foi possível alocar a memória
+        if (bloco == NULL) return NULL;
+
+        (*bloco).prox = (*cidade).blocosArestas;
+        (*cidade).blocosArestas = bloco;
+        (*cidade).arestasUsadasBloco = 0;
+    }
+
+    return &(*(*cidade).blocosArestas).arestas[(*cidade).arestasUsadasBloco++];
+}
+
+/**
+ * @brief Devolve uma aresta à lista de arestas livres da cidade (ou liberta-a, se não houver cidade).
+ */
+static void devolverAresta(Grafo *cidade, Aresta *aresta)
+{
+    if (cidade == NULL)
+    {
+        free(aresta);
+        return;
+    }
+
+    (*aresta).prox = (*cidade).arestasLivres;
+    (*cidade).arestasLivres = aresta;
+}
+
+/**
+ * @brief Liberta todos os blocos de arestas da cidade (e, com eles, todas as arestas).
+ */
+static void libertarBlocosArestas(Grafo *cidade)
+{
+    while ((*cidade).blocosArestas != NULL)
+    {
+        BlocoArestas *temp = (*cidade).blocosArestas;
+        (*cidade).blocosArestas = (*temp).prox;
+        free(temp);
+    }
+
+    (*cidade).arestasUsadasBloco = 0;
+    (*cidade).arestasLivres = NULL;
+}
+
+/*---- Núcleos da interligação -----------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Cria a aresta "origem" -> "destino" (equivalente a "adicionarAresta", sem validar os apontadores).
+ * 
+ * @note "verificarRepetidas" é sempre uma constante nos núcleos, pelo que o teste desaparece na compilação.
+ */
+static inline int ligarAntenas(Vertice *origem, Vertice *destino, Grafo *cidade, const bool verificarRepetidas)
+{
+    if (verificarRepetidas)
+    {
+        if ((*origem).arestasPendentes && materializarArestas(origem) < 0) return ERRO_ALOCACAO_MEMORIA;
+        if (procurarArestaDestino(origem, destino) != NULL) return 0;
+    }
+
+    Aresta *aresta = reservarAresta(cidade);
+
+    // Verifica se foi possível alocar a memória
+    if (aresta == NULL) return ERRO_ALOCACAO_MEMORIA;
+
+    (*aresta).destino = destino;
+#ifdef ADJACENCIA_INVERSA
+    (*aresta).origem = origem;
+#endif
+    ligarAresta(origem, aresta);
+
+    return 0;
+}
+
+/**
+ * @brief Define um núcleo que liga, nos dois sentidos, os pares de antenas de cada grupo de frequência.
+ * 
+ * Percorre os grupos já mantidos pela cidade ("primeiraAntenaFrequencia" e "proxFrequencia"), pelo que
+ * só visita os pares com a mesma frequência (soma de n_f² em vez de n²), sem memória adicional.
+ */
+#define DEFINIR_NUCLEO_GRUPOS(nome, VERIFICAR)                                                                   \
+static int nome(Grafo *cidade)                                                                                   \
+{                                                                                                                \
+    for (int f = 0; f < NUM_FREQUENCIAS; f++)                                                                    \
+    {                                                                                                            \
+        for (Vertice *antena1 = (*cidade).primeiraAntenaFrequencia[f]; antena1 != NULL; antena1 = (*antena1).proxFrequencia) \
+        {                                                                                                        \
+            for (Vertice *antena2 = (*antena1).proxFrequencia; antena2 != NULL; antena2 = (*antena2).proxFrequencia) \
+            {                                                                                                    \
+                if (ligarAntenas(antena1, antena2, cidade, VERIFICAR) < 0) return ERRO_ALOCACAO_MEMORIA;        \
+                if (ligarAntenas(antena2, antena1, cidade, VERIFICAR) < 0) return ERRO_ALOCACAO_MEMORIA;        \
+            }                                                                                                    \
+        }                                                                                                        \
+    }                                                                                                            \
+                                                                                                                 \
+    return 0;                                                                                                    \
+}
+
+/**
+ * @brief Define um núcleo que liga, nos dois sentidos, todos os pares de antenas da lista que cumprem "CONDICAO".
+ */
+#define DEFINIR_NUCLEO_PARES(nome, CONDICAO, VERIFICAR)                                                          \
+static int nome(Grafo *cidade)                                                                                   \
+{                                                                                                                \
+    for (Vertice *antena1 = (*cidade).primeiraAntena; antena1 != NULL; antena1 = (*antena1).prox)                \
+    {                                                                                                            \
+        for (Vertice *antena2 = (*antena1).prox; antena2 != NULL; antena2 = (*antena2).prox)                     \
+        {                                                                                                        \
+            if (!(CONDICAO)) continue;                                                                           \
+                                                                                                                 \
+            if (ligarAntenas(antena1, antena2, cidade, VERIFICAR) < 0) return ERRO_ALOCACAO_MEMORIA;            \
+            if (ligarAntenas(antena2, antena1, cidade, VERIFICAR) < 0) return ERRO_ALOCACAO_MEMORIA;            \
+        }                                                                                                        \
+    }                                                                                                            \
+                                                                                                                 \
+    return 0;                                                                                                    \
+}
+
+DEFINIR_NUCLEO_GRUPOS(interligarIguais, false)
+DEFINIR_NUCLEO_GRUPOS(interligarIguaisVerificando, true)
+DEFINIR_NUCLEO_PARES(interligarDiferentes, (*antena1).frequencia != (*antena2).frequencia, false)
+DEFINIR_NUCLEO_PARES(interligarDiferentesVerificando, (*antena1).frequencia != (*antena2).frequencia, true)
+DEFINIR_NUCLEO_PARES(interligarTodas, true, false)
+DEFINIR_NUCLEO_PARES(interligarTodasVerificando, true, true)
@@ -0,0 +1,702 @@
+/**
+ * @file Grafos_Compactos.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação da representação compacta (indexada, CSR) dos grafos
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Grafos_Compactos.h"
+
+/**
+ * @brief Converte um "Grafo" para a representação compacta.
+ *
+ * As antenas são numeradas pela ordem da lista (ver "numerarAntenas") e as arestas de saída de cada
+ * antena são copiadas, pela ordem da lista de adjacência, para o vetor "destinos".
+ *
+ * @param cidade Apontador para o grafo a converter.
+ * @param coordenadas16 Se verdadeiro, guarda as coordenadas em 16 bits quando a grelha (largura e
+ *                      altura ocupadas) cabe em 65536 posições; caso contrário usa 32 bits.
+ * @param erro Apontador para a variável que recebe o código de erro (0 em caso de sucesso).
+ *
+ * @note O grafo compacto é uma cópia: alterações posteriores ao "Grafo" não se refletem nele.
+ * @note As arestas pendentes da cidade são criadas antes da cópia.
+ *
+ * @return Apontador para o grafo compacto criado.
+ * @return NULL em caso de erro ("GC_ERRO_CIDADE_PONTEIRO_INVALIDO", "GC_ERRO_LIMITE_IDENTIFICADORES"
+ *         ou "GC_ERRO_ALOCACAO_MEMORIA" em "erro").
+ */
+GrafoCompacto *GC_criarGrafoCompacto(Grafo *cidade, bool coordenadas16, int *erro)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL)
+    {
+        *erro = GC_ERRO_CIDADE_PONTEIRO_INVALIDO;
+        return NULL;
+    }
+
+    // A cópia inclui as arestas pendentes (ver "interligarAntenasPendente")
+    int resultado = materializarTodasArestas(cidade);
+
+    if (resultado < 0)
+    {
+        *erro = resultado;
+        return NULL;
+    }
+
+    // Numera as antenas e conta as antenas e as arestas (os identificadores têm de caber em 32 bits)
+    numerarAntenas(cidade);
+    uint64_t numAntenas = 0, numArestas = 0;
+    int minX = INT32_MAX, maxX = INT32_MIN, minY = INT32_MAX, maxY = INT32_MIN;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        numAntenas++;
+        numArestas += (uint64_t)(*antenaAtual).numArestas;
+
+        if ((*antenaAtual).x < minX) minX = (*antenaAtual).x;
+        if ((*antenaAtual).x > maxX) maxX = (*antenaAtual).x;
+        if ((*antenaAtual).y < minY) minY = (*antenaAtual).y;
+        if ((*antenaAtual).y > maxY) maxY = (*antenaAtual).y;
+    }
+
+    // "GC_SEM_VERTICE" (o maior valor de 32 bits) está reservado, tal como nos índices das arestas
+    if (numAntenas >= GC_SEM_VERTICE || numArestas >= GC_SEM_VERTICE)
+    {
+        *erro = GC_ERRO_LIMITE_IDENTIFICADORES;
+        return NULL;
+    }
+
+    uint32_t numVertices = (uint32_t)numAntenas;
+
+    // Aloca o espaço na memória para o grafo (e inicializa as variáveis)
+    GrafoCompacto *grafo = calloc(1, sizeof(GrafoCompacto));
+
+    // Verifica se foi possível alocar a memória
+    if (grafo == NULL)
+    {
+        *erro = GC_ERRO_ALOCACAO_MEMORIA;
+        return NULL;
+    }
+
+    (*grafo).numVertices = numVertices;
+    (*grafo).numArestas = (uint32_t)numArestas;
+    (*grafo).coordenadas16 = coordenadas16 && numVertices > 0 && (int64_t)maxX - minX <= UINT16_MAX && (int64_t)maxY - minY <= UINT16_MAX;
+    (*grafo).origemX = (*grafo).coordenadas16 ? minX : 0;
+    (*grafo).origemY = (*grafo).coordenadas16 ? minY : 0;
+
+    // Aloca os vetores (pelo menos 1 posição, para distinguir de uma falha de alocação)
+    size_t posicoes = (numVertices > 0) ? numVertices : 1;
+
+    if ((*grafo).coordenadas16)
+    {
+        (*grafo).x16 = malloc(posicoes * sizeof(uint16_t));
+        (*grafo).y16 = malloc(posicoes * sizeof(uint16_t));
+    }
+    else
+    {
+        (*grafo).x = malloc(posicoes * sizeof(int32_t));
+        (*grafo).y = malloc(posicoes * sizeof(int32_t));
+    }
+    (*grafo).frequencias = malloc(posicoes * sizeof(char));
+    (*grafo).inicioArestas = malloc(((size_t)numVertices + 1) * sizeof(uint32_t));
+    (*grafo).destinos = malloc((numArestas > 0 ? numArestas : 1) * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (((*grafo).coordenadas16 ? ((*grafo).x16 == NULL || (*grafo).y16 == NULL) : ((*grafo).x == NULL || (*grafo).y == NULL))
+      || (*grafo).frequencias == NULL || (*grafo).inicioArestas == NULL || (*grafo).destinos == NULL)
+    {
+        GC_libertarGrafoCompacto(grafo);
+        *erro = GC_ERRO_ALOCACAO_MEMORIA;
+        return NULL;
+    }
+
+    // Copia as antenas e as arestas
+    uint32_t vertice = 0, aresta = 0;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox, vertice++)
+    {
+        if ((*grafo).coordenadas16)
+        {
+            (*grafo).x16[vertice] = (uint16_t)((*antenaAtual).x - minX);
+            (*grafo).y16[vertice] = (uint16_t)((*antenaAtual).y - minY);
+        }
+        else
+        {
+            (*grafo).x[vertice] = (*antenaAtual).x;
+            (*grafo).y[vertice] = (*antenaAtual).y;
+        }
+        (*grafo).frequencias[vertice] = (*antenaAtual).frequencia;
+        (*grafo).inicioArestas[vertice] = aresta;
+
+        for (Aresta *arestaAtual = (*antenaAtual).primeiraAresta; arestaAtual != NULL; arestaAtual = (*arestaAtual).prox)
+        {
+            (*grafo).destinos[aresta++] = (uint32_t)(*(*arestaAtual).destino).indice;
+        }
+    }
+    (*grafo).inicioArestas[numVertices] = aresta;
+
+    *erro = 0;
+
+    return grafo;
+}
+
+/**
+ * @brief Liberta toda a memória associada a um grafo compacto.
+ *
+ * @param grafo Apontador para o grafo compacto (pode ser NULL).
+ *
+ * @return NULL para indicar que o grafo foi libertado com sucesso.
+ */
+GrafoCompacto *GC_libertarGrafoCompacto(GrafoCompacto *grafo)
+{
+    // Verifica se o apontador é válido
+    if (grafo == NULL) return NULL;
+
+    free((*grafo).x);
+    free((*grafo).y);
+    free((*grafo).x16);
+    free((*grafo).y16);
+    free((*grafo).frequencias);
+    free((*grafo).inicioArestas);
+    free((*grafo).destinos);
+    free((*grafo).inicioArestasEntrada);
+    free((*grafo).origens);
+    free((*grafo).inicioFrequencias);
+    free((*grafo).verticesFrequencias);
+    free(grafo);
+
+    return NULL;
+}
+
+/**
+ * @brief Cria as arestas de entrada (CSR inverso) do grafo compacto.
+ *
+ * As origens de cada antena ficam por ordem crescente de identificador.
+ *
+ * @param grafo Apontador para o grafo compacto.
+ *
+ * @note Tem de ser chamada antes de o grafo ser partilhado entre threads (por exemplo, antes de publicar a versão).
+ *
+ * @return 0 em caso de sucesso (ou se já existirem).
+ * @return "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se o grafo for inválido.
+ * @return "GC_ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int GC_criarArestasEntrada(GrafoCompacto *grafo)
+{
+    // Verifica se o apontador é válido
+    if (grafo == NULL) return GC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+    if ((*grafo).inicioArestasEntrada != NULL) return 0;
+
+    uint32_t *inicio = calloc((size_t)(*grafo).numVertices + 1, sizeof(uint32_t));
+    uint32_t *origens = malloc(((*grafo).numArestas > 0 ? (*grafo).numArestas : 1) * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (inicio == NULL || origens == NULL)
+    {
+        free(inicio);
+        free(origens);
+        return GC_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    // Conta o grau de entrada de cada antena e calcula os inícios (soma acumulada)
+    for (uint32_t i = 0; i < (*grafo).numArestas; i++) inicio[(*grafo).destinos[i] + 1]++;
+    for (uint32_t v = 0; v < (*grafo).numVertices; v++) inicio[v + 1] += inicio[v];
+
+    // Distribui as origens (percorrer as origens por ordem mantém cada lista ordenada)
+    for (uint32_t v = 0; v < (*grafo).numVertices; v++)
+    {
+        for (uint32_t i = (*grafo).inicioArestas[v]; i < (*grafo).inicioArestas[v + 1]; i++)
+        {
+            origens[inicio[(*grafo).destinos[i]]++] = v;
+        }
+    }
+
+    // Repõe os inícios (foram avançados durante a distribuição)
+    for (uint32_t v = (*grafo).numVertices; v > 0; v--) inicio[v] = inicio[v - 1];
+    inicio[0] = 0;
+
+    (*grafo).inicioArestasEntrada = inicio;
+    (*grafo).origens = origens;
+
+    return 0;
+}
+
+/**
+ * @brief Cria o índice das antenas por frequência do grafo compacto.
+ *
+ * As antenas de cada frequência ficam por ordem crescente de identificador.
+ *
+ * @param grafo Apontador para o grafo compacto.
+ *
+ * @note Tem de ser chamada antes de o grafo ser partilhado entre threads (por exemplo, antes de publicar a versão).
+ *
+ * @return 0 em caso de sucesso (ou se já existir).
+ * @return "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se o grafo for inválido.
+ * @return "GC_ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int GC_criarIndiceFrequencias(GrafoCompacto *grafo)
+{
+    // Verifica se o apontador é válido
+    if (grafo == NULL) return GC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+    if ((*grafo).inicioFrequencias != NULL) return 0;
+
+    uint32_t *inicio = calloc(NUM_FREQUENCIAS + 1, sizeof(uint32_t));
+    uint32_t *vertices = malloc(((*grafo).numVertices > 0 ? (*grafo).numVertices : 1) * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (inicio == NULL || vertices == NULL)
+    {
+        free(inicio);
+        free(vertices);
+        return GC_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    // Conta as antenas de cada frequência e calcula os inícios (soma acumulada)
+    for (uint32_t v = 0; v < (*grafo).numVertices; v++) inicio[(unsigned char)(*grafo).frequencias[v] + 1]++;
+    for (int f = 0; f < NUM_FREQUENCIAS; f++) inicio[f + 1] += inicio[f];
+
+    // Distribui as antenas (percorrer os identificadores por ordem mantém cada grupo ordenado)
+    for (uint32_t v = 0; v < (*grafo).numVertices; v++) vertices[inicio[(unsigned char)(*grafo).frequencias[v]]++] = v;
+
+    // Repõe os inícios (foram avançados durante a distribuição)
+    for (int f = NUM_FREQUENCIAS; f > 0; f--) inicio[f] = inicio[f - 1];
+    inicio[0] = 0;
+
+    (*grafo).inicioFrequencias = inicio;
+    (*grafo).verticesFrequencias = vertices;
+
+    return 0;
+}
+
+/**
+ * @brief Devolve a coordenada x de uma antena do grafo compacto.
+ */
+int GC_coordenadaX(const GrafoCompacto *grafo, uint32_t vertice)
+{
+    return (*grafo).coordenadas16 ? (*grafo).origemX + (*grafo).x16[vertice] : (*grafo).x[vertice];
+}
+
+/**
+ * @brief Devolve a coordenada y de uma antena do grafo compacto.
+ */
+int GC_coordenadaY(const GrafoCompacto *grafo, uint32_t vertice)
+{
+    return (*grafo).coordenadas16 ? (*grafo).origemY + (*grafo).y16[vertice] : (*grafo).y[vertice];
+}
+
+/**
+ * @brief Procura (por procura binária) o identificador da antena em (x, y).
+ *
+ * @param grafo Apontador para o grafo compacto.
+ * @param x Coordenada x da antena.
+ * @param y Coordenada y da antena.
+ *
+ * @return Identificador da antena.
+ * @return "GC_SEM_VERTICE" se não existir antena nessa posição (ou o grafo for inválido).
+ */
+uint32_t GC_procurarAntena(const GrafoCompacto *grafo, int x, int y)
+{
+    // Verifica se o apontador é válido
+    if (grafo == NULL) return GC_SEM_VERTICE;
+
+    uint32_t inicio = 0, fim = (*grafo).numVertices;
+
+    // Os identificadores seguem a ordem (y, x) da lista original
+    while (inicio < fim)
+    {
+        uint32_t meio = inicio + (fim - inicio) / 2;
+        int meioX = GC_coordenadaX(grafo, meio), meioY = GC_coordenadaY(grafo, meio);
+
+        if (meioY < y || (meioY == y && meioX < x)) inicio = meio + 1;
+        else fim = meio;
+    }
+
+    if (inicio < (*grafo).numVertices && GC_coordenadaX(grafo, inicio) == x && GC_coordenadaY(grafo, inicio) == y) return inicio;
+
+    return GC_SEM_VERTICE;
+}
+
+/**
+ * @brief Realiza uma procura em largura (BFS) a partir de uma antena do grafo compacto.
+ *
+ * O estado da procura (antenas visitadas) é alocado por chamada, pelo que várias procuras podem
+ * decorrer em simultâneo sobre o mesmo grafo (que nunca é alterado).
+ *
+ * @param grafo Apontador para o grafo compacto.
+ * @param inicio Identificador da antena de partida.
+ * @param ordem Vetor com "numVertices" posições onde é guardada a ordem de visita (pode ser NULL).
+ *
+ * @return Número de antenas alcançadas (incluindo a de partida).
+ * @return "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se o grafo for inválido.
+ * @return "GC_ERRO_ANTENA_INICIO_INVALIDA" se a antena de partida não existir.
+ * @return "GC_ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int GC_procurarLargura(const GrafoCompacto *grafo, uint32_t inicio, uint32_t *ordem)
+{
+    // Verifica se os parâmetros são válidos
+    if (grafo == NULL) return GC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+    if (inicio >= (*grafo).numVertices) return GC_ERRO_ANTENA_INICIO_INVALIDA;
+
+    bool *visitadas = calloc((*grafo).numVertices, sizeof(bool));
+    uint32_t *lista = malloc((*grafo).numVertices * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (visitadas == NULL || lista == NULL)
+    {
+        free(visitadas);
+        free(lista);
+        return GC_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    uint32_t anterior = 0, atual = 0;
+
+    // Inicializa lista com vértice inicial
+    lista[anterior++] = inicio;
+    visitadas[inicio] = true;
+
+    // Percorre em largura as antenas
+    while (anterior > atual)
+    {
+        uint32_t vertice = lista[atual++];
+
+        for (uint32_t i = (*grafo).inicioArestas[vertice]; i < (*grafo).inicioArestas[vertice + 1]; i++)
+        {
+            uint32_t destino = (*grafo).destinos[i];
+
+            if (!visitadas[destino])
+            {
+                visitadas[destino] = true;
+                lista[anterior++] = destino;
+            }
+        }
+    }
+
+    if (ordem != NULL) memcpy(ordem, lista, anterior * sizeof(uint32_t));
+
+    free(visitadas);
+    free(lista);
+
+    return (int)anterior;
+}
+
+/**
+ * @brief Realiza uma procura em profundidade (DFS) a partir de uma antena do grafo compacto.
+ *
+ * Visita as antenas pela mesma ordem que "procurarProfundidade", mas de forma iterativa (com uma
+ * pilha explícita) e com o estado da procura alocado por chamada.
+ *
+ * @param grafo Apontador para o grafo compacto.
+ * @param inicio Identificador da antena de partida.
+ * @param ordem Vetor com "numVertices" posições onde é guardada a ordem de visita (pode ser NULL).
+ *
+ * @return Número de antenas alcançadas (incluindo a de partida).
+ * @return "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se o grafo for inválido.
+ * @return "GC_ERRO_ANTENA_INICIO_INVALIDA" se a antena de partida não existir.
+ * @return "GC_ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int GC_procurarProfundidade(const GrafoCompacto *grafo, uint32_t inicio, uint32_t *ordem)
+{
+    // Verifica se os parâmetros são válidos
+    if (grafo == NULL) return GC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+    if (inicio >= (*grafo).numVertices) return GC_ERRO_ANTENA_INICIO_INVALIDA;
+
+    bool *visitadas = calloc((*grafo).numVertices, sizeof(bool));
+    uint32_t *pilha = malloc((*grafo).numVertices * sizeof(uint32_t));
+    uint32_t *proximaAresta = malloc((*grafo).numVertices * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (visitadas == NULL || pilha == NULL || proximaAresta == NULL)
+    {
+        free(visitadas);
+        free(pilha);
+        free(proximaAresta);
+        return GC_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    int numVisitadas = 0, topo = 0;
+
+    // Marca a antena de partida
+    visitadas[inicio] = true;
+    if (ordem != NULL) ordem[numVisitadas] = inicio;
+    numVisitadas++;
+    pilha[topo] = inicio;
+    proximaAresta[topo++] = (*grafo).inicioArestas[inicio];
+
+    while (topo > 0)
+    {
+        uint32_t vertice = pilha[topo - 1];
+
+        // Regressa quando todas as arestas do vértice do topo já foram exploradas
+        if (proximaAresta[topo - 1] == (*grafo).inicioArestas[vertice + 1])
+        {
+            topo--;
+            continue;
+        }
+
+        uint32_t destino = (*grafo).destinos[proximaAresta[topo - 1]++];
+
+        if (!visitadas[destino])
+        {
+            visitadas[destino] = true;
+            if (ordem != NULL) ordem[numVisitadas] = destino;
+            numVisitadas++;
+            pilha[topo] = destino;
+            proximaAresta[topo++] = (*grafo).inicioArestas[destino];
+        }
+    }
+
+    free(visitadas);
+    free(pilha);
+    free(proximaAresta);
+
+    return numVisitadas;
+}
+
+/**
+ * @brief Procura todos os caminhos simples entre duas antenas do grafo compacto.
+ *
+ * Implementa o mesmo backtracking que "procurarCaminhos" (e pela mesma ordem), mas de forma
+ * iterativa e com o estado da procura alocado por chamada.
+ *
+ * @param grafo Apontador para o grafo compacto.
+ * @param inicio Identificador da antena de origem.
+ * @param destino Identificador da antena de destino.
+ * @param funcao Função chamada para cada caminho encontrado (pode ser NULL para apenas contar).
+ * @param contexto Apontador passado à função.
+ *
+ * @return Número de caminhos encontrados (ou o valor negativo devolvido por "funcao").
+ * @return "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se o grafo for inválido.
+ * @return "GC_ERRO_ANTENA_INICIO_INVALIDA" / "GC_ERRO_ANTENA_DESTINO_INVALIDA" se alguma das antenas não existir.
+ * @return "GC_ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int GC_procurarCaminhos(const GrafoCompacto *grafo, uint32_t inicio, uint32_t destino, FuncaoCaminho funcao, void *contexto)
+{
+    // Verifica se os parâmetros são válidos
+    if (grafo == NULL) return GC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+    if (inicio >= (*grafo).numVertices) return GC_ERRO_ANTENA_INICIO_INVALIDA;
+    if (destino >= (*grafo).numVertices) return GC_ERRO_ANTENA_DESTINO_INVALIDA;
+
+    bool *visitadas = calloc((*grafo).numVertices, sizeof(bool));
+    uint32_t *caminho = malloc((*grafo).numVertices * sizeof(uint32_t));
+    uint32_t *proximaAresta = malloc((*grafo).numVertices * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (visitadas == NULL || caminho == NULL || proximaAresta == NULL)
+    {
+        free(visitadas);
+        free(caminho);
+        free(proximaAresta);
+        return GC_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    int numCaminhos = 0, tamanho = 0;
+
+    visitadas[inicio] = true;
+    caminho[tamanho] = inicio;
+    proximaAresta[tamanho++] = (*grafo).inicioArestas[inicio];
+
+    while (tamanho > 0)
+    {
+        uint32_t vertice = caminho[tamanho - 1];
+
+        // Chegou ao destino (não continua a partir dele) ou esgotou as arestas: recua
+        if (vertice == destino || proximaAresta[tamanho - 1] == (*grafo).inicioArestas[vertice + 1])
+        {
+            if (vertice == destino && proximaAresta[tamanho - 1] == (*grafo).inicioArestas[vertice])
+            {
+                numCaminhos++;
+                if (funcao != NULL)
+                {
+                    int resultado = funcao(caminho, tamanho, contexto);
+                    if (resultado < 0)
+                    {
+                        numCaminhos = resultado;
+                        break;
+                    }
+                }
+            }
+
+            visitadas[vertice] = false;
+            tamanho--;
+            continue;
+        }
+
+        uint32_t seguinte = (*grafo).destinos[proximaAresta[tamanho - 1]++];
+
+        if (!visitadas[seguinte])
+        {
+            visitadas[seguinte] = true;
+            caminho[tamanho] = seguinte;
+            proximaAresta[tamanho++] = (*grafo).inicioArestas[seguinte];
+        }
+    }
+
+    free(visitadas);
+    free(caminho);
+    free(proximaAresta);
+
+    return numCaminhos;
+}
+
+/**
+ * @brief Procura as interseções (pontos médios distintos) entre as antenas de duas frequências.
+ *
+ * Equivalente a "procurarIntersecoes" sobre o grafo compacto: só são percorridos os grupos das duas
+ * frequências (O(k1 * k2)) e cada ponto médio é entregue uma única vez, com o primeiro par que o origina
+ * (pela ordem dos identificadores). Não altera o grafo, pelo que pode ser usada por vários leitores.
+ *
+ * @param grafo Apontador para o grafo compacto (com o índice de "GC_criarIndiceFrequencias").
+ * @param frequencia1 Primeira frequência.
+ * @param frequencia2 Segunda frequência (se for igual à primeira, cada par não ordenado é considerado uma vez).
+ * @param funcao Função chamada para cada interseção (pode ser NULL para apenas contar).
+ * @param contexto Apontador passado à função.
+ *
+ * @return Número de interseções distintas (limitado a INT_MAX).
+ * @return "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se o grafo for inválido ou não tiver o índice por frequência.
+ * @return "GC_ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ * @return O valor negativo devolvido pela função, se esta interromper a procura.
+ */
+int GC_procurarIntersecoes(const GrafoCompacto *grafo, char frequencia1, char frequencia2, FuncaoIntersecaoCompacta funcao, void *contexto)
+{
+    // Verifica se o apontador é válido
+    if (grafo == NULL || (*grafo).inicioFrequencias == NULL) return GC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+
+    unsigned char indice1 = (unsigned char)frequencia1;
+    unsigned char indice2 = (unsigned char)frequencia2;
+    PontosMedios pontos = { NULL, 0, 0, false };
+    int64_t distintas = 0;
+    int resultado = 0;
+
+    for (uint32_t i = (*grafo).inicioFrequencias[indice1]; i < (*grafo).inicioFrequencias[indice1 + 1] && resultado == 0; i++)
+    {
+        uint32_t antena1 = (*grafo).verticesFrequencias[i];
+        uint32_t inicio2 = (indice1 == indice2) ? i + 1 : (*grafo).inicioFrequencias[indice2];
+
+        for (uint32_t j = inicio2; j < (*grafo).inicioFrequencias[indice2 + 1]; j++)
+        {
+            uint32_t antena2 = (*grafo).verticesFrequencias[j];
+            int x = (GC_coordenadaX(grafo, antena1) + GC_coordenadaX(grafo, antena2)) / 2;
+            int y = (GC_coordenadaY(grafo, antena1) + GC_coordenadaY(grafo, antena2)) / 2;
+
+            resultado = inserirPontoMedio(&pontos, x, y);
+            if (resultado < 0) break;
+            if (resultado == 0) continue;
+
+            distintas++;
+            resultado = (funcao != NULL) ? funcao(antena1, antena2, x, y, contexto) : 0;
+            if (resultado < 0) break;
+            resultado = 0;
+        }
+    }
+
+    free(pontos.chaves);
+
+    if (resultado < 0) return resultado;
+
+    return (distintas > INT_MAX) ? INT_MAX : (int)distintas;
+}
+
+/**
+ * @brief Calcula a memória ocupada por um grafo compacto.
+ *
+ * @param grafo Apontador para o grafo compacto.
+ * @param relatorio Apontador para a estrutura a preencher.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ */
+int GC_calcularMemoria(const GrafoCompacto *grafo, RelatorioMemoria *relatorio)
+{
+    // Verifica se os apontadores são válidos
+    if (grafo == NULL || relatorio == NULL) return GC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+
+    size_t bytesCoordenadas = (*grafo).coordenadas16 ? 2 * sizeof(uint16_t) : 2 * sizeof(int32_t);
+
+    (*relatorio).numVertices = (*grafo).numVertices;
+    (*relatorio).numArestas = (*grafo).numArestas;
+    (*relatorio).bytesVertices = sizeof(GrafoCompacto) + (*grafo).numVertices * (bytesCoordenadas + sizeof(char) + sizeof(uint32_t)) + sizeof(uint32_t);
+    (*relatorio).bytesArestas = (size_t)(*grafo).numArestas * sizeof(uint32_t);
+
+    // Arestas de entrada (se existirem)
+    if ((*grafo).inicioArestasEntrada != NULL)
+    {
+        (*relatorio).bytesVertices += ((size_t)(*grafo).numVertices + 1) * sizeof(uint32_t);
+        (*relatorio).bytesArestas += (size_t)(*grafo).numArestas * sizeof(uint32_t);
+    }
+
+    // Índice por frequência (se existir)
+    if ((*grafo).inicioFrequencias != NULL)
+    {
+        (*relatorio).bytesVertices += (NUM_FREQUENCIAS + 1 + (size_t)(*grafo).numVertices) * sizeof(uint32_t);
+    }
+    (*relatorio).bytesPorVertice = (*grafo).numVertices > 0 ? (double)(*relatorio).bytesVertices / (*grafo).numVertices : 0.0;
+    (*relatorio).bytesPorAresta = (*grafo).numArestas > 0 ? (double)(*relatorio).bytesArestas / (*grafo).numArestas : 0.0;
+
+    return 0;
+}
+
+/**
+ * @brief Calcula a memória ocupada por um "Grafo" (vértices, arestas e tabelas de dispersão de arestas).
+ *
+ * @param cidade Apontador para o grafo.
+ * @param relatorio Apontador para a estrutura a preencher.
+ *
+ * @note As tabelas de dispersão de arestas ("tabelaArestas") são contabilizadas nas arestas.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "GC_ERRO_CIDADE_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ */
+int GC_calcularMemoriaGrafo(Grafo *cidade, RelatorioMemoria *relatorio)
+{
+    // Verifica se os apontadores são válidos
+    if (cidade == NULL || relatorio == NULL) return GC_ERRO_CIDADE_PONTEIRO_INVALIDO;
+
+    size_t numVertices = 0, numArestas = 0, bytesTabelas = 0;
+
+    for (Vertice *antenaAtual = (*cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        numVertices++;
+        numArestas += (size_t)(*antenaAtual).numArestas;
+        bytesTabelas += (size_t)(*antenaAtual).capacidadeTabela * sizeof(Aresta *);
+    }
+
+    (*relatorio).numVertices = numVertices;
+    (*relatorio).numArestas = numArestas;
+    (*relatorio).bytesVertices = sizeof(Grafo) + numVertices * sizeof(Vertice);
+    (*relatorio).bytesArestas = numArestas * sizeof(Aresta) + bytesTabelas;
+    (*relatorio).bytesPorVertice = numVertices > 0 ? (double)(*relatorio).bytesVertices / numVertices : 0.0;
+    (*relatorio).bytesPorAresta = numArestas > 0 ? (double)(*relatorio).bytesArestas / numArestas : 0.0;
+
+    return 0;
+}
+
+/**
+ * @brief Apresenta a memória ocupada pelo "Grafo" e pela sua representação compacta.
+ *
+ * @param cidade Apontador para o grafo.
+ * @param grafo Apontador para o grafo compacto.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "GC_ERRO_CIDADE_PONTEIRO_INVALIDO" ou "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ */
+int GC_apresentarMemoria(Grafo *cidade, const GrafoCompacto *grafo)
+{
+    RelatorioMemoria original, compacto;
+
+    int erro = GC_calcularMemoriaGrafo(cidade, &original);
+    if (erro < 0) return erro;
+
+    erro = GC_calcularMemoria(grafo, &compacto);
+    if (erro < 0) return erro;
+
+    printf("Antenas: %zu | Arestas: %zu | Coordenadas: %s\n\n", compacto.numVertices, compacto.numArestas, (*grafo).coordenadas16 ? "16 bits" : "32 bits");
+    printf("%-12s %16s %16s %14s %14s\n", "Grafo", "Vértices (B)", "Arestas (B)", "B/vértice", "B/aresta");
+    printf("%-12s %14zu %15zu %14.1f %14.1f\n", "Ligado", original.bytesVertices, original.bytesArestas, original.bytesPorVertice, original.bytesPorAresta);
+    printf("%-12s %14zu %15zu %14.1f %14.1f\n", "Compacto", compacto.bytesVertices, compacto.bytesArestas, compacto.bytesPorVertice, compacto.bytesPorAresta);
+    printf("\n(sem contar o overhead do alocador, que acresce a cada vértice e aresta do grafo ligado)\n");
+
+    return 0;
+}
@@ -0,0 +1,419 @@
+/**
+ * @file Indice_Espacial.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação do índice espacial (grelha uniforme) para consultas por raio, retângulo e vizinhos
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Indice_Espacial.h"
+
+/**
+ * @brief Calcula a célula (divisão inteira por defeito) de uma coordenada.
+ */
+static inline int64_t celula(int coordenada, int tamanhoCelula)
+{
+    int64_t valor = coordenada;
+
+    return (valor >= 0) ? valor / tamanhoCelula : -((-valor + tamanhoCelula - 1) / tamanhoCelula);
+}
+
+/**
+ * @brief Calcula o balde de uma célula (cx, cy).
+ */
+static inline int baldeCelula(const IndiceEspacial *indice, int64_t cx, int64_t cy)
+{
+    uint64_t chave = ((uint64_t)(uint32_t)cx << 32) | (uint32_t)cy;
+
+    chave *= 0x9E3779B97F4A7C15ULL;
+
+    return (int)(chave >> 40) & ((*indice).capacidade - 1);
+}
+
+/**
+ * @brief Cria um índice espacial vazio.
+ *
+ * @param tamanhoCelula Lado de cada célula (valores <= 0 usam "TAMANHO_CELULA_PREDEFINIDO").
+ *
+ * @return Apontador para o índice criado.
+ * @return NULL em caso de falha na alocação de memória.
+ */
+IndiceEspacial *criarIndiceEspacial(int tamanhoCelula)
+{
+    // Aloca o espaço na memória para o índice (e inicializa as variáveis)
+    IndiceEspacial *indice = calloc(1, sizeof(IndiceEspacial));
+
+    // Verifica se foi possível alocar a memória
+    if (indice == NULL) return NULL;
+
+    (*indice).tamanhoCelula = (tamanhoCelula > 0) ? tamanhoCelula : TAMANHO_CELULA_PREDEFINIDO;
+    (*indice).capacidade = 64;
+    (*indice).baldes = calloc((*indice).capacidade, sizeof(PontoEspacial *));
+
+    if ((*indice).baldes == NULL)
+    {
+        free(indice);
+        return NULL;
+    }
+
+    return indice;
+}
+
+/**
+ * @brief Liberta o índice e todos os seus pontos (os elementos apontados por "dados" não são libertados).
+ *
+ * @param indice Índice a libertar (pode ser NULL).
+ *
+ * @return Sempre NULL, para facilitar a reatribuição do ponteiro original.
+ */
+IndiceEspacial *libertarIndiceEspacial(IndiceEspacial *indice)
+{
+    if (indice == NULL) return NULL;
+
+    limparIndiceEspacial(indice);
+    free((*indice).baldes);
+    free(indice);
+
+    return NULL;
+}
+
+/**
+ * @brief Remove todos os pontos do índice, mantendo-o pronto a reutilizar.
+ *
+ * @param indice Índice a limpar.
+ *
+ * @return 0 em caso de sucesso
+ * @return "INDICE_ERRO_PONTEIRO_INVALIDO" se o índice for NULL
+ */
+int limparIndiceEspacial(IndiceEspacial *indice)
+{
+    if (indice == NULL) return INDICE_ERRO_PONTEIRO_INVALIDO;
+
+    for (int i = 0; i < (*indice).capacidade; i++)
+    {
+        for (PontoEspacial *pontoAtual = (*indice).baldes[i]; pontoAtual != NULL; )
+        {
+            PontoEspacial *temp = pontoAtual;
+            pontoAtual = (*pontoAtual).prox;
+            free(temp);
+        }
+
+        (*indice).baldes[i] = NULL;
+    }
+
+    (*indice).numPontos = 0;
+
+    return 0;
+}
+
+/**
+ * @brief Duplica o número de baldes e redistribui os pontos.
+ *
+ * @note Se a alocação falhar, mantém-se a tabela anterior (mais carregada, mas correta).
+ */
+static void redimensionarIndice(IndiceEspacial *indice)
+{
+    int capacidadeAnterior = (*indice).capacidade;
+    PontoEspacial **baldesAnteriores = (*indice).baldes;
+    PontoEspacial **baldes = calloc(capacidadeAnterior * 2, sizeof(PontoEspacial *));
+
+    if (baldes == NULL) return;
+
+    (*indice).baldes = baldes;
+    (*indice).capacidade = capacidadeAnterior * 2;
+
+    for (int i = 0; i < capacidadeAnterior; i++)
+    {
+        for (PontoEspacial *pontoAtual = baldesAnteriores[i]; pontoAtual != NULL; )
+        {
+            PontoEspacial *seguinte = (*pontoAtual).prox;
+            int balde = baldeCelula(indice, celula((*pontoAtual).x, (*indice).tamanhoCelula), celula((*pontoAtual).y, (*indice).tamanhoCelula));
+
+            (*pontoAtual).prox = baldes[balde];
+            baldes[balde] = pontoAtual;
+            pontoAtual = seguinte;
+        }
+    }
+
+    free(baldesAnteriores);
+}
+
+/**
+ * @brief Insere um ponto no índice.
+ *
+ * @param indice Índice espacial.
+ * @param x Coordenada x do ponto.
+ * @param y Coordenada y do ponto.
+ * @param dados Elemento associado ao ponto (ex: "Vertice *" ou "Nefasto *").
+ *
+ * @return 0 em caso de sucesso
+ * @return "INDICE_ERRO_PONTEIRO_INVALIDO" se o índice for NULL
+ * @return "INDICE_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+int inserirIndiceEspacial(IndiceEspacial *indice, int x, int y, void *dados)
+{
+    if (indice == NULL) return INDICE_ERRO_PONTEIRO_INVALIDO;
+
+    PontoEspacial *novo = malloc(sizeof(PontoEspacial));
+
+    // Verifica se foi possível alocar a memória
+    if (novo == NULL) return INDICE_ERRO_ALOCACAO_MEMORIA;
+
+    // Mantém em média no máximo 2 pontos por balde
+    if ((*indice).numPontos >= (*indice).capacidade * 2) redimensionarIndice(indice);
+
+    int balde = baldeCelula(indice, celula(x, (*indice).tamanhoCelula), celula(y, (*indice).tamanhoCelula));
+
+    (*novo).x = x;
+    (*novo).y = y;
+    (*novo).dados = dados;
+    (*novo).prox = (*indice).baldes[balde];
+    (*indice).baldes[balde] = novo;
+    (*indice).numPontos++;
+
+    return 0;
+}
+
+/**
+ * @brief Remove o ponto (x, y) associado a "dados" do índice.
+ *
+ * @param indice Índice espacial.
+ * @param x Coordenada x do ponto.
+ * @param y Coordenada y do ponto.
+ * @param dados Elemento associado ao ponto.
+ *
+ * @return 0 em caso de sucesso
+ * @return "INDICE_ERRO_PONTEIRO_INVALIDO" se o índice for NULL
+ * @return "INDICE_ERRO_PONTO_NAO_EXISTE" se o ponto não for encontrado
+ */
+int removerIndiceEspacial(IndiceEspacial *indice, int x, int y, void *dados)
+{
+    if (indice == NULL) return INDICE_ERRO_PONTEIRO_INVALIDO;
+
+    int balde = baldeCelula(indice, celula(x, (*indice).tamanhoCelula), celula(y, (*indice).tamanhoCelula));
+
+    for (PontoEspacial **ligacao = &(*indice).baldes[balde]; *ligacao != NULL; ligacao = &(**ligacao).prox)
+    {
+        if ((**ligacao).dados == dados && (**ligacao).x == x && (**ligacao).y == y)
+        {
+            PontoEspacial *temp = *ligacao;
+            *ligacao = (*temp).prox;
+            free(temp);
+            (*indice).numPontos--;
+
+            return 0;
+        }
+    }
+
+    return INDICE_ERRO_PONTO_NAO_EXISTE;
+}
+
+/**
+ * @brief Consulta comum aos retângulos e círculos.
+ *
+ * Percorre as células que intersetam o retângulo [x1, x2] x [y1, y2]; se forem mais do que os baldes,
+ * percorre antes todos os baldes (cada ponto é visitado uma única vez em ambos os casos).
+ * Com "circulo" a "true", filtra também pela distância ao quadrado "raio2" ao centro (cx, cy).
+ */
+static int consultarRegiao(IndiceEspacial *indice, int x1, int y1, int x2, int y2, bool circulo, int cx, int cy, int64_t raio2, FuncaoPonto funcao, void *contexto)
+{
+    int tamanho = (*indice).tamanhoCelula;
+    int64_t celulaX1 = celula(x1, tamanho), celulaX2 = celula(x2, tamanho);
+    int64_t celulaY1 = celula(y1, tamanho), celulaY2 = celula(y2, tamanho);
+    int encontrados = 0;
+
+    bool percorrerTudo = (celulaX2 - celulaX1 + 1) * (celulaY2 - celulaY1 + 1) > (*indice).capacidade;
+
+    for (int64_t cy1 = celulaY1; cy1 <= celulaY2; cy1++)
+    {
+        for (int64_t cx1 = celulaX1; cx1 <= celulaX2; cx1++)
+        {
+            int primeiro = percorrerTudo ? 0 : baldeCelula(indice, cx1, cy1);
+            int ultimo = percorrerTudo ? (*indice).capacidade - 1 : primeiro;
+
+            for (int balde = primeiro; balde <= ultimo; balde++)
+            {
+                for (PontoEspacial *pontoAtual = (*indice).baldes[balde]; pontoAtual != NULL; pontoAtual = (*pontoAtual).prox)
+                {
+                    int x = (*pontoAtual).x, y = (*pontoAtual).y;
+
+                    // Filtra pontos de outras células que partilham o balde
+                    if (!percorrerTudo && (celula(x, tamanho) != cx1 || celula(y, tamanho) != cy1)) continue;
+
+                    // Filtra pela região
+                    if (x < x1 || x > x2 || y < y1 || y > y2) continue;
+                    if (circulo)
+                    {
+                        int64_t dx = (int64_t)x - cx, dy = (int64_t)y - cy;
+                        if (dx * dx + dy * dy > raio2) continue;
+                    }
+
+                    encontrados++;
+
+                    if (funcao != NULL)
+                    {
+                        int resultado = funcao(x, y, (*pontoAtual).dados, contexto);
+                        if (resultado < 0) return resultado;
+                    }
+                }
+            }
+
+            if (percorrerTudo) return encontrados;
+        }
+    }
+
+    return encontrados;
+}
+
+/**
+ * @brief Consulta os pontos dentro de um retângulo (limites incluídos).
+ *
+ * @param indice Índice espacial.
+ * @param x1 Limite esquerdo.
+ * @param y1 Limite superior.
+ * @param x2 Limite direito.
+ * @param y2 Limite inferior.
+ * @param funcao Função chamada para cada ponto (pode ser NULL para apenas contar).
+ * @param contexto Apontador passado à função.
+ *
+ * @return Número de pontos encontrados
+ * @return "INDICE_ERRO_PONTEIRO_INVALIDO" se o índice for NULL
+ * @return O valor negativo devolvido pela função, se esta interromper a consulta
+ */
+int consultarRetangulo(IndiceEspacial *indice, int x1, int y1, int x2, int y2, FuncaoPonto funcao, void *contexto)
+{
+    if (indice == NULL) return INDICE_ERRO_PONTEIRO_INVALIDO;
+    if (x1 > x2 || y1 > y2) return 0;
+
+    return consultarRegiao(indice, x1, y1, x2, y2, false, 0, 0, 0, funcao, contexto);
+}
+
+/**
+ * @brief Consulta os pontos a uma distância (euclidiana) de (x, y) inferior ou igual a "raio".
+ *
+ * @param indice Índice espacial.
+ * @param x Coordenada x do centro.
+ * @param y Coordenada y do centro.
+ * @param raio Raio da consulta.
+ * @param funcao Função chamada para cada ponto (pode ser NULL para apenas contar).
+ * @param contexto Apontador passado à função.
+ *
+ * @return Número de pontos encontrados
+ * @return "INDICE_ERRO_PONTEIRO_INVALIDO" se o índice for NULL
+ * @return O valor negativo devolvido pela função, se esta interromper a consulta
+ */
+int consultarRaio(IndiceEspacial *indice, int x, int y, int raio, FuncaoPonto funcao, void *contexto)
+{
+    if (indice == NULL) return INDICE_ERRO_PONTEIRO_INVALIDO;
+    if (raio < 0) return 0;
+
+    // Retângulo envolvente (limitado ao intervalo de "int")
+    int64_t x1 = (int64_t)x - raio, x2 = (int64_t)x + raio;
+    int64_t y1 = (int64_t)y - raio, y2 = (int64_t)y + raio;
+    if (x1 < INT32_MIN) x1 = INT32_MIN;
+    if (y1 < INT32_MIN) y1 = INT32_MIN;
+    if (x2 > INT32_MAX) x2 = INT32_MAX;
+    if (y2 > INT32_MAX) y2 = INT32_MAX;
+
+    return consultarRegiao(indice, (int)x1, (int)y1, (int)x2, (int)y2, true, x, y, (int64_t)raio * raio, funcao, contexto);
+}
+
+/**
+ * @brief Considera um ponto candidato para os k vizinhos mais próximos (vetor ordenado por distância).
+ */
+static void considerarVizinho(PontoEspacial *ponto, int64_t distancia2, int k, PontoEspacial **resultados, int64_t *distancias, int *numResultados)
+{
+    if (*numResultados == k && distancia2 >= distancias[k - 1]) return;
+
+    int posicao = (*numResultados < k) ? (*numResultados)++ : k - 1;
+
+    // Inserção ordenada (k é pequeno)
+    while (posicao > 0 && distancias[posicao - 1] > distancia2)
+    {
+        distancias[posicao] = distancias[posicao - 1];
+        resultados[posicao] = resultados[posicao - 1];
+        posicao--;
+    }
+
+    distancias[posicao] = distancia2;
+    resultados[posicao] = ponto;
+}
+
+/**
+ * @brief Procura os k pontos mais próximos de (x, y).
+ *
+ * Percorre anéis de células cada vez mais afastados da célula de (x, y) e termina quando os pontos
+ * por visitar já não podem estar mais próximos do que o k-ésimo encontrado (ou quando todos foram visitados).
+ * Se um anel tiver mais células do que baldes, passa a percorrer todos os baldes.
+ *
+ * @param indice Índice espacial.
+ * @param x Coordenada x do ponto de consulta.
+ * @param y Coordenada y do ponto de consulta.
+ * @param k Número de vizinhos pretendido.
+ * @param resultados Vetor com pelo menos "k" posições, preenchido por ordem crescente de distância.
+ *
+ * @return Número de vizinhos encontrados (no máximo "k")
+ * @return "INDICE_ERRO_PONTEIRO_INVALIDO" se o índice ou o vetor forem NULL
+ * @return "INDICE_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+int consultarVizinhosProximos(IndiceEspacial *indice, int x, int y, int k, PontoEspacial **resultados)
+{
+    if (indice == NULL || resultados == NULL) return INDICE_ERRO_PONTEIRO_INVALIDO;
+    if (k <= 0 || (*indice).numPontos == 0) return 0;
+
+    int64_t *distancias = malloc(k * sizeof(int64_t));
+
+    // Verifica se foi possível alocar a memória
+    if (distancias == NULL) return INDICE_ERRO_ALOCACAO_MEMORIA;
+
+    int tamanho = (*indice).tamanhoCelula;
+    int64_t celulaX = celula(x, tamanho), celulaY = celula(y, tamanho);
+    int numResultados = 0, visitados = 0;
+
+    for (int64_t anel = 0; visitados < (*indice).numPontos; anel++)
+    {
+        // Anel com demasiadas células: percorre todos os baldes de uma vez
+        if (8 * anel > (*indice).capacidade)
+        {
+            numResultados = 0;
+
+            for (int balde = 0; balde < (*indice).capacidade; balde++)
+            {
+                for (PontoEspacial *pontoAtual = (*indice).baldes[balde]; pontoAtual != NULL; pontoAtual = (*pontoAtual).prox)
+                {
+                    int64_t dx = (int64_t)(*pontoAtual).x - x, dy = (int64_t)(*pontoAtual).y - y;
+                    considerarVizinho(pontoAtual, dx * dx + dy * dy, k, resultados, distancias, &numResultados);
+                }
+            }
+            break;
+        }
+
+        // Percorre as células à distância (de Chebyshev) "anel" da célula de consulta
+        for (int64_t cy = celulaY - anel; cy <= celulaY + anel; cy++)
+        {
+            int64_t passo = (cy == celulaY - anel || cy == celulaY + anel) ? 1 : 2 * anel;
+
+            for (int64_t cx = celulaX - anel; cx <= celulaX + anel; cx += passo)
+            {
+                for (PontoEspacial *pontoAtual = (*indice).baldes[baldeCelula(indice, cx, cy)]; pontoAtual != NULL; pontoAtual = (*pontoAtual).prox)
+                {
+                    if (celula((*pontoAtual).x, tamanho) != cx || celula((*pontoAtual).y, tamanho) != cy) continue;
+
+                    int64_t dx = (int64_t)(*pontoAtual).x - x, dy = (int64_t)(*pontoAtual).y - y;
+                    considerarVizinho(pontoAtual, dx * dx + dy * dy, k, resultados, distancias, &numResultados);
+                    visitados++;
+                }
+            }
+        }
+
+        // Os pontos fora dos anéis já visitados estão a pelo menos "anel * tamanho" de distância
+        int64_t limite = anel * tamanho;
+        if (numResultados == k && distancias[k - 1] <= limite * limite) break;
+    }
+
+    free(distancias);
+
+    return numResultados;
+}
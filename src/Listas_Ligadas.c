@@ -11,6 +11,59 @@
 
 #include "../include/Listas_Ligadas.h"
 
+// Funções auxiliares da rede vetorial
+static int LL_procurarPosicaoVetor(const Rede *rede, int x, int y);
+static int LL_reservarAntenasVetor(Rede *rede, int capacidade);
+static int LL_anexarAntenaVetor(Rede *rede, char frequencia, int x, int y);
+static int LL_calcularNefastosVetor(Rede *rede, bool coordenadasNegativas, bool limitarMapa);
+
+// Funções auxiliares do cálculo dos nefastos por grupo de frequência (redes vetorial e partilhada)
+typedef struct LL_GrupoNefastos
+{
+    int *x;
+    int *y;
+    size_t numAntenas;
+    size_t capacidade;
+    bool ordenadoY;
+
+} LL_GrupoNefastos;
+
+static int LL_acrescentarGrupo(LL_GrupoNefastos *grupo, int x, int y);
+static int LL_nefastosGrupo(const LL_GrupoNefastos *grupo, PontosMedios *nefastos, bool coordenadasNegativas, bool limitarMapa, int largura, int altura);
+static int LL_juntarNefastosOrdenados(Rede *rede, const PontosMedios *nefastos);
+
+// Funções auxiliares das operações em lote
+typedef struct LL_ChaveLote
+{
+    int64_t chave;
+    int indice;
+
+} LL_ChaveLote;
+
+static inline int64_t LL_chaveCoordenadas(int x, int y);
+static LL_ChaveLote *LL_ordenarLote(const RegistoAntena *lote, int quantidade);
+
+// Funções auxiliares do índice espacial dos nefastos
+static void LL_indexarNefasto(Rede *rede, Nefasto *nefasto);
+
+// Funções auxiliares do desenho do mapa (percorrem as antenas por ordem (y, x) em qualquer modo da rede)
+typedef struct LL_CursorAntenas
+{
+    const Rede *rede;
+    const Antena *antena;
+    const Vertice *vertice;
+    int indice;
+
+} LL_CursorAntenas;
+
+static LL_CursorAntenas LL_iniciarCursor(const Rede *rede);
+static bool LL_lerCursor(const LL_CursorAntenas *cursor, char *frequencia, int *x, int *y);
+static void LL_avancarCursor(LL_CursorAntenas *cursor);
+
+// Funções auxiliares da rede partilhada
+static int LL_sincronizarPartilhada(Rede *rede, int resultado);
+static int LL_calcularNefastosPartilhada(Rede *rede, bool coordenadasNegativas, bool limitarMapa);
+
 /**
  * @brief Cria e inicializa uma nova rede na memória.
  * 
@@ -25,6 +78,61 @@ Rede *LL_criarRede()
     return calloc(1, sizeof(Rede));
 }
 
+/**
+ * @brief Cria e inicializa uma nova rede com armazenamento vetorial das antenas.
+ * 
+ * As antenas passam a ser guardadas em vetores paralelos (x, y e frequência) ordenados pela
+ * chave (y, x), o que permite procura binária na inserção/remoção ordenada e percursos contíguos
+ * no cálculo dos efeitos nefastos. As restantes funções "LL_" mantêm a mesma assinatura.
+ * 
+ * @note "LL_adicionarAntenaFim" não é suportada neste modo (não existem nós "Antena").
+ * 
+ * @return Apontador para a rede criada.
+ * @return NULL em caso de falha na alocação de memória.
+ */
+Rede *LL_criarRedeVetorial()
+{
+    // Aloca o espaço na memória para a rede (e inicializa as variáveis)
+    Rede *rede = calloc(1, sizeof(Rede));
+
+    if (rede != NULL) (*rede).vetorial = true;
+
+    return rede;
+}
+
+/**
+ * @brief Cria uma rede cujas antenas são os vértices de uma cidade (grafo), sem as copiar.
+ * 
+ * A rede e a cidade partilham o mesmo armazenamento: o mapa é lido uma só vez (por "carregarCidade"
+ * ou "LL_carregarAntenas"), não existem nós "Antena" e qualquer alteração feita por uma das vistas
+ * (ex.: "LL_removerAntena" ou "adicionarAntenaOrdenada") é vista de imediato pela outra. Os efeitos
+ * nefastos continuam a pertencer à rede e são calculados a partir dos grupos por frequência da cidade.
+ * 
+ * @param cidade Apontador para a cidade que guarda as antenas (não é libertada com a rede).
+ * 
+ * @note "LL_adicionarAntenaFim" não é suportada neste modo (não existem nós "Antena").
+ * @note Os nefastos calculados não são atualizados quando a cidade muda (tal como nas outras redes).
+ * 
+ * @return Apontador para a rede criada.
+ * @return NULL se a cidade for inválida ou em caso de falha na alocação de memória.
+ */
+Rede *LL_criarRedePartilhada(Grafo *cidade)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL) return NULL;
+
+    // Aloca o espaço na memória para a rede (e inicializa as variáveis)
+    Rede *rede = calloc(1, sizeof(Rede));
+
+    if (rede != NULL)
+    {
+        (*rede).cidade = cidade;
+        LL_sincronizarPartilhada(rede, 0);
+    }
+
+    return rede;
+}
+
 /**
  * @brief Cria e inicializa uma nova antena na memória.
  * 
@@ -97,9 +205,11 @@ Rede *LL_libertarRede(Rede *rede)
     // Verifica se o apontador é válido
     if (rede == NULL) return NULL;
 
-    // Liberta as antenas e os nefastos
+    // Liberta as antenas (exceto as da cidade partilhada), os nefastos e o índice espacial
+    (*rede).cidade = NULL;
     LL_libertarAntenas(rede);
     LL_libertarNefastos(rede);
+    (*rede).indiceNefastos = libertarIndiceEspacial((*rede).indiceNefastos);
 
     // Liberta a cidade
     free(rede);
@@ -122,6 +232,17 @@ int LL_libertarAntenas(Rede *rede)
     // Verifica se o apontador é válido
     if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
 
+    // Rede partilhada: as antenas são as da cidade
+    if ((*rede).cidade != NULL) return LL_sincronizarPartilhada(rede, libertarAntenas((*rede).cidade));
+
+    // Liberta os vetores das antenas (rede vetorial)
+    free((*rede).antenasX);
+    free((*rede).antenasY);
+    free((*rede).antenasFrequencia);
+    (*rede).antenasX = (*rede).antenasY = NULL;
+    (*rede).antenasFrequencia = NULL;
+    (*rede).capacidadeAntenas = 0;
+
     // Liberta a lista das antenas
     for (Antena *antenaAtual = (*rede).primeiraAntena; antenaAtual != NULL; )
     {
@@ -133,6 +254,8 @@ int LL_libertarAntenas(Rede *rede)
     // Dá reset das variáveis da rede
     (*rede).primeiraAntena = NULL;
     (*rede).numAntenas = 0;
+    (*rede).largura = 0;
+    (*rede).altura = 0;
 
     return 0;
 }
@@ -163,6 +286,7 @@ int LL_libertarNefastos(Rede *rede)
     // Dá reset das variáveis da rede
     (*rede).primeiroNefasto = NULL;
     (*rede).numNefastos = 0;
+    if ((*rede).indiceNefastos != NULL) limparIndiceEspacial((*rede).indiceNefastos);
 
     return 0;
 }
@@ -189,6 +313,37 @@ int LL_adicionarAntenaOrdenada(Rede *rede, char *frequencia, int x, int y)
     // Verifica se o apontador é válido
     if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
 
+    // Rede partilhada: a antena é inserida na cidade
+    if ((*rede).cidade != NULL) return LL_sincronizarPartilhada(rede, adicionarAntenaOrdenada((*rede).cidade, frequencia, x, y));
+
+    // Rede vetorial: procura binária da posição e deslocamento contíguo dos vetores
+    if ((*rede).vetorial)
+    {
+        int posicao = LL_procurarPosicaoVetor(rede, x, y);
+
+        // Verifica se a antena é repetida
+        if (posicao < (*rede).numAntenas && (*rede).antenasX[posicao] == x && (*rede).antenasY[posicao] == y)
+        {
+            *frequencia = (*rede).antenasFrequencia[posicao]; /* Guarda a frequência da antena ocupada */
+            return LL_ERRO_ANTENA_JA_EXISTE;
+        }
+
+        // Garante espaço nos vetores
+        if (LL_reservarAntenasVetor(rede, (*rede).numAntenas + 1) < 0) return LL_ERRO_ALOCACAO_MEMORIA;
+
+        int mover = (*rede).numAntenas - posicao;
+        memmove(&(*rede).antenasX[posicao + 1], &(*rede).antenasX[posicao], mover * sizeof(int));
+        memmove(&(*rede).antenasY[posicao + 1], &(*rede).antenasY[posicao], mover * sizeof(int));
+        memmove(&(*rede).antenasFrequencia[posicao + 1], &(*rede).antenasFrequencia[posicao], mover * sizeof(char));
+
+        (*rede).antenasX[posicao] = x;
+        (*rede).antenasY[posicao] = y;
+        (*rede).antenasFrequencia[posicao] = *frequencia;
+        (*rede).numAntenas++;
+
+        return 0;
+    }
+
     // Cria o 1.º apontador para navegar a lista ligada
     Antena *antenaAtual = (*rede).primeiraAntena;
 
@@ -260,6 +415,7 @@ int LL_adicionarAntenaOrdenada(Rede *rede, char *frequencia, int x, int y)
  * 
  * @return 0 em caso de sucesso
  * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se o ponteiro da rede for inválido
+ * @return "LL_ERRO_OPERACAO_NAO_SUPORTADA" se a rede for vetorial (sem nós "Antena")
  * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
  * @return Ponteiro para a nova antena criada.
  * @return NULL em caso de erro
@@ -273,6 +429,13 @@ Antena *LL_adicionarAntenaFim(Rede *rede, Antena *ultimaAntena, char frequencia,
         return NULL;
     }
 
+    // Verifica se a rede usa listas ligadas
+    if ((*rede).vetorial || (*rede).cidade != NULL)
+    {
+        *erro = LL_ERRO_OPERACAO_NAO_SUPORTADA;
+        return NULL;
+    }
+
     // Cria o espaço na memória para a nova antena
     Antena *nova = LL_criarAntena(frequencia, x, y);
 
@@ -301,6 +464,156 @@ Antena *LL_adicionarAntenaFim(Rede *rede, Antena *ultimaAntena, char frequencia,
     return nova;
 }
 
+/**
+ * @brief Adiciona um lote de antenas à rede com uma única passagem de junção.
+ * 
+ * O lote é ordenado pela chave (y, x) e junto à lista (ou aos vetores) de antenas numa única passagem linear,
+ * em vez de uma inserção ordenada O(n) por antena. Antenas repetidas dentro do lote ou já existentes
+ * na rede não são inseridas e ficam assinaladas em "resultados".
+ * 
+ * @param rede Ponteiro para a estrutura da rede
+ * @param lote Vetor de registos (frequência, x, y) a inserir
+ * @param quantidade Número de registos do lote
+ * @param resultados Vetor opcional (pode ser NULL) com "quantidade" posições, preenchido pela ordem do lote com:
+ *        0 se a antena foi inserida,
+ *        "LL_ERRO_ANTENA_JA_EXISTE" se já existia na rede,
+ *        "LL_ERRO_ANTENA_REPETIDA_LOTE" se um registo anterior do lote tem as mesmas coordenadas,
+ *        "LL_ERRO_ALOCACAO_MEMORIA" se não chegou a ser inserida por falta de memória
+ * 
+ * @return Número de antenas inseridas
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se o ponteiro da rede for inválido
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória (as antenas já inseridas mantêm-se)
+ */
+int LL_adicionarAntenasLote(Rede *rede, const RegistoAntena *lote, int quantidade, int *resultados)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+    if (lote == NULL || quantidade <= 0) return 0;
+
+    // Rede partilhada: o lote é inserido na cidade
+    if ((*rede).cidade != NULL) return LL_sincronizarPartilhada(rede, adicionarAntenasLote((*rede).cidade, lote, quantidade, resultados));
+
+    // Ordena o lote por (y, x), mantendo a ordem original em caso de empate
+    LL_ChaveLote *ordem = LL_ordenarLote(lote, quantidade);
+
+    // Verifica se foi possível alocar a memória
+    if (ordem == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    // Assinala os repetidos dentro do lote (o primeiro registo de cada posição prevalece)
+    for (int i = 0; i < quantidade; i++)
+    {
+        if (resultados != NULL) resultados[ordem[i].indice] = LL_ERRO_ALOCACAO_MEMORIA;
+        if (i > 0 && ordem[i].chave == ordem[i - 1].chave)
+        {
+            if (resultados != NULL) resultados[ordem[i].indice] = LL_ERRO_ANTENA_REPETIDA_LOTE;
+            ordem[i].indice = -1;
+        }
+    }
+
+    int inseridas = 0;
+    int resultado = 0;
+
+    if ((*rede).vetorial)
+    {
+        // 1.ª passagem: classifica os registos contra as antenas existentes
+        int numNovas = 0;
+
+        for (int i = 0, j = 0; i < quantidade; i++)
+        {
+            if (ordem[i].indice < 0) continue;
+
+            while (j < (*rede).numAntenas && LL_chaveCoordenadas((*rede).antenasX[j], (*rede).antenasY[j]) < ordem[i].chave) j++;
+
+            if (j < (*rede).numAntenas && LL_chaveCoordenadas((*rede).antenasX[j], (*rede).antenasY[j]) == ordem[i].chave)
+            {
+                if (resultados != NULL) resultados[ordem[i].indice] = LL_ERRO_ANTENA_JA_EXISTE;
+                ordem[i].indice = -1;
+            }
+            else numNovas++;
+        }
+
+        // 2.ª passagem: junção de trás para a frente nos vetores já com o espaço reservado
+        if (LL_reservarAntenasVetor(rede, (*rede).numAntenas + numNovas) < 0)
+        {
+            free(ordem);
+            return LL_ERRO_ALOCACAO_MEMORIA;
+        }
+
+        int destino = (*rede).numAntenas + numNovas - 1;
+        int j = (*rede).numAntenas - 1;
+
+        for (int i = quantidade - 1; i >= 0; i--)
+        {
+            if (ordem[i].indice < 0) continue;
+
+            // Desloca as antenas existentes com chave superior
+            while (j >= 0 && LL_chaveCoordenadas((*rede).antenasX[j], (*rede).antenasY[j]) > ordem[i].chave)
+            {
+                (*rede).antenasX[destino] = (*rede).antenasX[j];
+                (*rede).antenasY[destino] = (*rede).antenasY[j];
+                (*rede).antenasFrequencia[destino] = (*rede).antenasFrequencia[j];
+                destino--;
+                j--;
+            }
+
+            const RegistoAntena *registo = &lote[ordem[i].indice];
+            (*rede).antenasX[destino] = (*registo).x;
+            (*rede).antenasY[destino] = (*registo).y;
+            (*rede).antenasFrequencia[destino] = (*registo).frequencia;
+            destino--;
+
+            if (resultados != NULL) resultados[ordem[i].indice] = 0;
+        }
+
+        (*rede).numAntenas += numNovas;
+        inseridas = numNovas;
+    }
+    else
+    {
+        // Junção com a lista ligada numa única passagem
+        Antena **ligacao = &(*rede).primeiraAntena;
+
+        for (int i = 0; i < quantidade; i++)
+        {
+            if (ordem[i].indice < 0) continue;
+
+            // Avança na lista até à posição do registo
+            while (*ligacao != NULL && LL_chaveCoordenadas((**ligacao).x, (**ligacao).y) < ordem[i].chave) ligacao = &(**ligacao).prox;
+
+            // Verifica se a antena já existe
+            if (*ligacao != NULL && LL_chaveCoordenadas((**ligacao).x, (**ligacao).y) == ordem[i].chave)
+            {
+                if (resultados != NULL) resultados[ordem[i].indice] = LL_ERRO_ANTENA_JA_EXISTE;
+                continue;
+            }
+
+            const RegistoAntena *registo = &lote[ordem[i].indice];
+            Antena *nova = LL_criarAntena((*registo).frequencia, (*registo).x, (*registo).y);
+
+            // Verifica se foi possível alocar a memória
+            if (nova == NULL)
+            {
+                resultado = LL_ERRO_ALOCACAO_MEMORIA;
+                break;
+            }
+
+            // Insere a antena na posição correspondente da lista
+            (*nova).prox = *ligacao;
+            *ligacao = nova;
+            ligacao = &(*nova).prox;
+
+            if (resultados != NULL) resultados[ordem[i].indice] = 0;
+            inseridas++;
+        }
+
+        (*rede).numAntenas += inseridas;
+    }
+
+    free(ordem);
+
+    return resultado < 0 ? resultado : inseridas;
+}
+
 /**
  * @brief Adiciona um nefasto à rede de forma ordenada
  * 
@@ -340,6 +653,7 @@ int LL_adicionarNefastoOrdenado(Rede *rede, int x, int y)
         // Insere o nefasto na posição correspondente da lista
         (*novo).prox = (*rede).primeiroNefasto;
         (*rede).primeiroNefasto = novo;
+        LL_indexarNefasto(rede, novo);
     }
     // Insere no meio e fim da lista
     else
@@ -364,6 +678,7 @@ int LL_adicionarNefastoOrdenado(Rede *rede, int x, int y)
         // Insere a antena na posição correspondente da lista
         (*nefastoAnterior).prox = novo;
         (*novo).prox = nefastoAtual;
+        LL_indexarNefasto(rede, novo);
     }
 
     // Incrementa o número de nefastos
@@ -417,6 +732,7 @@ Nefasto *LL_adicionarNefastoFim(Rede *rede, Nefasto *ultimoNefasto, int x, int y
         (*ultimoNefasto).prox = novo;
         ultimoNefasto = novo;
     }
+    LL_indexarNefasto(rede, novo);
 
     // Incrementa o número de nefastos
     (*rede).numNefastos++;
@@ -445,6 +761,27 @@ int LL_removerAntena(Rede *rede, char *frequencia, int x, int y)
     // Verifica se o apontador é válido
     if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
 
+    // Rede partilhada: a antena (e as suas arestas) é removida da cidade
+    if ((*rede).cidade != NULL) return LL_sincronizarPartilhada(rede, removerAntena((*rede).cidade, frequencia, x, y));
+
+    // Rede vetorial: procura binária e deslocamento contíguo dos vetores
+    if ((*rede).vetorial)
+    {
+        int posicao = LL_procurarPosicaoVetor(rede, x, y);
+
+        if (posicao >= (*rede).numAntenas || (*rede).antenasX[posicao] != x || (*rede).antenasY[posicao] != y) return LL_ERRO_ANTENA_NAO_EXISTE;
+
+        *frequencia = (*rede).antenasFrequencia[posicao]; /* Guarda a frequência da antena removida */
+
+        int mover = (*rede).numAntenas - posicao - 1;
+        memmove(&(*rede).antenasX[posicao], &(*rede).antenasX[posicao + 1], mover * sizeof(int));
+        memmove(&(*rede).antenasY[posicao], &(*rede).antenasY[posicao + 1], mover * sizeof(int));
+        memmove(&(*rede).antenasFrequencia[posicao], &(*rede).antenasFrequencia[posicao + 1], mover * sizeof(char));
+        (*rede).numAntenas--;
+
+        return 0;
+    }
+
     Antena *antenaAnterior = NULL;
     Antena *antenaAtual = (*rede).primeiraAntena;
 
@@ -499,6 +836,12 @@ int LL_calcularNefastos(Rede *rede, bool coordenadasNegativas)
     // Verifica se o apontador é válido
     if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
 
+    // Rede partilhada: pares dentro de cada grupo de frequência da cidade
+    if ((*rede).cidade != NULL) return LL_calcularNefastosPartilhada(rede, coordenadasNegativas, false);
+
+    // Rede vetorial: percursos contíguos e junção ordenada dos nefastos
+    if ((*rede).vetorial) return LL_calcularNefastosVetor(rede, coordenadasNegativas, false);
+
     // Percorre todas as combinações de antenas
     for (Antena *antenaAtual = (*rede).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
     {
@@ -533,12 +876,85 @@ int LL_calcularNefastos(Rede *rede, bool coordenadasNegativas)
     return 0;
 }
 
+/**
+ * @brief Calcula e adiciona os efeitos nefastos entre antenas, limitados à grelha do mapa carregado.
+ * 
+ * Igual a "LL_calcularNefastos(rede, false)", mas rejeita também os candidatos além da margem
+ * direita ou inferior do mapa ("largura" x "altura"), antes de qualquer alocação ou inserção ordenada.
+ * Como as antenas estão ordenadas por y, assim que ambos os candidatos de um par saem da grelha
+ * pelo eixo y, todos os pares seguintes da mesma antena também saem, e o ciclo interior termina.
+ * 
+ * @param rede Ponteiro para a estrutura da rede
+ * 
+ * @note Se não houver um mapa carregado ("largura" ou "altura" a 0), apenas as coordenadas negativas são rejeitadas.
+ * 
+ * @return Código de erro:
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se rede for NULL
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+int LL_calcularNefastosMapa(Rede *rede)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    // Sem mapa carregado não há limites superiores
+    LL_sincronizarPartilhada(rede, 0);
+    if ((*rede).largura <= 0 || (*rede).altura <= 0) return LL_calcularNefastos(rede, false);
+
+    // Rede partilhada: pares dentro de cada grupo de frequência da cidade
+    if ((*rede).cidade != NULL) return LL_calcularNefastosPartilhada(rede, false, true);
+
+    // Rede vetorial: percursos contíguos e junção ordenada dos nefastos
+    if ((*rede).vetorial) return LL_calcularNefastosVetor(rede, false, true);
+
+    int largura = (*rede).largura;
+    int altura = (*rede).altura;
+
+    // Percorre todas as combinações de antenas
+    for (Antena *antenaAtual = (*rede).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+    {
+        for (Antena *comparar = (*antenaAtual).prox; comparar != NULL; comparar = (*comparar).prox)
+        {
+            int distanciaY = (*comparar).y - (*antenaAtual).y;
+
+            // Ambos os candidatos fora da grelha em y (e os pares seguintes também, pela ordenação)
+            if ((*antenaAtual).y - distanciaY < 0 && (*comparar).y + distanciaY >= altura) break;
+
+            // Verifica se são antenas diferentes com mesma frequência
+            if ((*antenaAtual).frequencia != (*comparar).frequencia) continue;
+
+            int distanciaX = (*comparar).x - (*antenaAtual).x;
+
+            // Calcula efeitos nefastos estendendo a linha em ambas as direções
+            int nefasto1X = (*antenaAtual).x - distanciaX;
+            int nefasto1Y = (*antenaAtual).y - distanciaY;
+            int nefasto2X = (*comparar).x + distanciaX;
+            int nefasto2Y = (*comparar).y + distanciaY;
+
+            // Adiciona apenas os efeitos nefastos dentro da grelha
+            if (nefasto1X >= 0 && nefasto1Y >= 0 && nefasto1X < largura && nefasto1Y < altura)
+            {
+                if (LL_adicionarNefastoOrdenado(rede, nefasto1X, nefasto1Y) == LL_ERRO_ALOCACAO_MEMORIA) return LL_ERRO_ALOCACAO_MEMORIA;
+            }
+            if (nefasto2X >= 0 && nefasto2Y >= 0 && nefasto2X < largura && nefasto2Y < altura)
+            {
+                if (LL_adicionarNefastoOrdenado(rede, nefasto2X, nefasto2Y) == LL_ERRO_ALOCACAO_MEMORIA) return LL_ERRO_ALOCACAO_MEMORIA;
+            }
+        }
+    }
+
+    return 0;
+}
+
 /**
  * @brief Carrega as antenas a partir de um ficheiro.
  * 
  * Esta função lê um ficheiro de texto contendo informações sobre as antenas e adiciona-as à rede,
  * uma por uma, com base nas coordenadas (x, y) e na frequência (representada por um caractere).
  * Cada letra (maiúscula ou minúscula) no ficheiro é interpretada como uma antena.
+ * As dimensões da grelha (maior largura de linha e número de linhas) ficam registadas em "largura" e "altura".
+ * Numa rede partilhada, o mapa é carregado na cidade (com "carregarCidade"), sem uma segunda leitura.
  * 
  * @param rede Ponteiro para a estrutura da rede onde serão adicionadas as antenas
  * @param localizacaoFicheiro Caminho para o ficheiro que contém as informações das antenas
@@ -553,6 +969,9 @@ int LL_carregarAntenas(Rede *rede, const char *localizacaoFicheiro)
     // Verifica se o apontador é válido
     if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
 
+    // Rede partilhada: uma só leitura, para a cidade
+    if ((*rede).cidade != NULL) return LL_sincronizarPartilhada(rede, carregarCidade((*rede).cidade, localizacaoFicheiro));
+
     // Abre o ficheiro para leitura
     FILE *ficheiro = fopen(localizacaoFicheiro, "r");
 
@@ -568,14 +987,37 @@ int LL_carregarAntenas(Rede *rede, const char *localizacaoFicheiro)
     size_t tamanho = 0;
     ssize_t lidos;
 
+    // Dimensões da grelha
+    (*rede).largura = 0;
+    (*rede).altura = 0;
+
     // Percorre o ficheiro e verifica a existência de antenas
     for (int y = 0; (lidos = getline(&linha, &tamanho, ficheiro)) != -1; y++)
     {
+        // Regista a largura (sem a mudança de linha) e a altura da grelha
+        int larguraLinha = (int)lidos;
+        while (larguraLinha > 0 && (linha[larguraLinha - 1] == '\n' || linha[larguraLinha - 1] == '\r')) larguraLinha--;
+        if (larguraLinha > (*rede).largura) (*rede).largura = larguraLinha;
+        (*rede).altura = y + 1;
+
         for (int x = 0; x < lidos; x++)
         {
             // Verifica se o caracter é uma letra (com early exit)
             if (linha[x] >= 'A' && (linha[x] <= 'Z' || (linha[x] >= 'a' && linha[x] <= 'z')))
             {
+                // Rede vetorial: o ficheiro já está ordenado por (y, x), basta anexar
+                if ((*rede).vetorial)
+                {
+                    erro = LL_anexarAntenaVetor(rede, linha[x], x, y);
+                    if (erro < 0)
+                    {
+                        free(linha);
+                        fclose(ficheiro);
+                        return erro;
+                    }
+                    continue;
+                }
+
                 // Adiciona a nova antena
                 ultimaAntena = LL_adicionarAntenaFim(rede, ultimaAntena, linha[x], x, y, &erro);
 
@@ -659,92 +1101,1028 @@ int LL_carregarNefastos(Rede *rede, const char *localizacaoFicheiro)
 }
 
 /**
- * @brief Apresenta uma tabela com informações das antenas.
+ * @brief Desenha o mapa das antenas com os efeitos nefastos sobrepostos ('#'), no formato dos ficheiros de entrada.
  * 
- * Esta função apresenta uma tabela com as antenas e as suas localizações (x, y).
- * As tabelas são formatadas e apresentadas no terminal.
+ * As antenas e os nefastos estão ordenados por (y, x), pelo que são percorridos juntos numa única
+ * passagem: cada linha do mapa é preenchida num só buffer (com "largura" posições), escrita e
+ * reposta a '.' apenas nas posições alteradas. O mapa completo nunca está em memória, pelo que
+ * mapas de 50000 x 50000 ocupam apenas uma linha.
  * 
- * @param rede Ponteiro para a estrutura que contem a primeira antena da lista e o número de antenas.
+ * @param rede Ponteiro para a rede (antenas e nefastos já calculados).
+ * @param ficheiro Ficheiro (aberto para escrita) onde é desenhado o mapa.
  * 
- * @return bool "true" caso tenha imprimido antenas.
- * @return bool "false" caso tenha imprimido uma tabela vazia.
+ * @note Uma antena sobrepõe-se a um nefasto na mesma posição.
+ * @note O mapa tem as dimensões do último mapa carregado ("largura" x "altura"); sem mapa carregado,
+ *       vai de (0, 0) até à maior coordenada das antenas e nefastos. As posições fora do mapa são ignoradas.
+ * 
+ * @return Número de linhas desenhadas.
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ * @return "LL_ERRO_ESCRITA_FICHEIRO" se ocorrer um erro de escrita.
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação da linha.
  */
-bool LL_apresentarAntenas(Rede *rede)
+int LL_desenharMapa(Rede *rede, FILE *ficheiro)
 {
-    // Verifica se o apontador é válido
-    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+    // Verifica se os apontadores são válidos
+    if (rede == NULL || ficheiro == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
 
-    // Imprime a tabela das antenas
-    printf("----------------------------------------");
-    printf("\n| 📶         | X          | Y          |");
-    printf("\n----------------------------------------");
+    LL_sincronizarPartilhada(rede, 0);
 
-    if ((*rede).numAntenas > 0)
+    int largura = (*rede).largura;
+    int altura = (*rede).altura;
+    char frequencia;
+    int x, y;
+
+    // Sem mapa carregado, as dimensões vêm das maiores coordenadas
+    if (largura <= 0 || altura <= 0)
     {
-        Antena *antenaAtual = (*rede).primeiraAntena;
+        largura = altura = 0;
 
-        while (antenaAtual != NULL)
+        for (LL_CursorAntenas cursor = LL_iniciarCursor(rede); LL_lerCursor(&cursor, &frequencia, &x, &y); LL_avancarCursor(&cursor))
         {
-            printf("\n| %-11c| %-11d| %-11d|",
-                (*antenaAtual).frequencia,
-                (*antenaAtual).x,
-                (*antenaAtual).y);
-            antenaAtual = (*antenaAtual).prox;
+            if (x >= largura) largura = x + 1;
+            if (y >= altura) altura = y + 1;
+        }
+        for (Nefasto *nefastoAtual = (*rede).primeiroNefasto; nefastoAtual != NULL; nefastoAtual = (*nefastoAtual).prox)
+        {
+            if ((*nefastoAtual).x >= largura) largura = (*nefastoAtual).x + 1;
+            if ((*nefastoAtual).y >= altura) altura = (*nefastoAtual).y + 1;
         }
-        printf("\n----------------------------------------");
-
-        return true;
     }
-    else
+
+    // Buffer de uma linha (posições + mudança de linha)
+    char *linha = malloc((size_t)largura + 1);
+
+    // Verifica se foi possível alocar a memória
+    if (linha == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    memset(linha, '.', (size_t)largura);
+    linha[largura] = '\n';
+
+    LL_CursorAntenas cursor = LL_iniciarCursor(rede);
+    Nefasto *nefastoAtual = (*rede).primeiroNefasto;
+    int resultado = 0;
+
+    for (int linhaAtual = 0; linhaAtual < altura; linhaAtual++)
     {
-        printf("\n|            |            |            |");
-        printf("\n----------------------------------------");
+        // Ignora as posições acima da linha atual (coordenadas negativas)
+        while (nefastoAtual != NULL && (*nefastoAtual).y < linhaAtual) nefastoAtual = (*nefastoAtual).prox;
+        while (LL_lerCursor(&cursor, &frequencia, &x, &y) && y < linhaAtual) LL_avancarCursor(&cursor);
+
+        // Preenche a linha: primeiro os nefastos, depois as antenas (que se sobrepõem)
+        Nefasto *inicioNefastos = nefastoAtual;
+        LL_CursorAntenas inicioAntenas = cursor;
+
+        for (; nefastoAtual != NULL && (*nefastoAtual).y == linhaAtual; nefastoAtual = (*nefastoAtual).prox)
+        {
+            if ((*nefastoAtual).x >= 0 && (*nefastoAtual).x < largura) linha[(*nefastoAtual).x] = '#';
+        }
+        for (; LL_lerCursor(&cursor, &frequencia, &x, &y) && y == linhaAtual; LL_avancarCursor(&cursor))
+        {
+            if (x >= 0 && x < largura) linha[x] = frequencia;
+        }
 
-        return false;
+        if (fwrite(linha, 1, (size_t)largura + 1, ficheiro) != (size_t)largura + 1)
+        {
+            resultado = LL_ERRO_ESCRITA_FICHEIRO;
+            break;
+        }
+
+        // Repõe apenas as posições alteradas
+        for (; inicioNefastos != nefastoAtual; inicioNefastos = (*inicioNefastos).prox)
+        {
+            if ((*inicioNefastos).x >= 0 && (*inicioNefastos).x < largura) linha[(*inicioNefastos).x] = '.';
+        }
+        for (; LL_lerCursor(&inicioAntenas, &frequencia, &x, &y) && y == linhaAtual; LL_avancarCursor(&inicioAntenas))
+        {
+            if (x >= 0 && x < largura) linha[x] = '.';
+        }
     }
+
+    free(linha);
+
+    if (resultado == 0 && fflush(ficheiro) != 0) resultado = LL_ERRO_ESCRITA_FICHEIRO;
+
+    return (resultado < 0) ? resultado : altura;
 }
 
 /**
- * @brief Apresenta uma tabela com informações dos efeitos nefastos.
+ * @brief Guarda o mapa das antenas com os efeitos nefastos sobrepostos num ficheiro (ver "LL_desenharMapa").
  * 
- * Esta função apresenta uma tabela com os efeitos nefastos e as suas localizações (x, y).
- * As tabelas são formatadas e apresentadas no terminal.
+ * @param rede Ponteiro para a rede (antenas e nefastos já calculados).
+ * @param localizacaoFicheiro Caminho do ficheiro a criar (ou substituir).
  * 
- * @param rede Ponteiro para a estrutura que contem o primeiro nefasto da lista e o número de nefastos.
+ * @return Número de linhas guardadas.
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se o ponteiro para a rede for inválido.
+ * @return "LL_ERRO_ABRIR_FICHEIRO" se não for possível criar o ficheiro.
+ * @return "LL_ERRO_ESCRITA_FICHEIRO" se ocorrer um erro de escrita.
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação da linha.
+ */
+int LL_guardarMapa(Rede *rede, const char *localizacaoFicheiro)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    // Abre o ficheiro para escrita
+    FILE *ficheiro = fopen(localizacaoFicheiro, "w");
+
+    // Verifica se foi possível abrir o ficheiro
+    if (ficheiro == NULL) return LL_ERRO_ABRIR_FICHEIRO;
+
+    int resultado = LL_desenharMapa(rede, ficheiro);
+
+    if (fclose(ficheiro) != 0 && resultado >= 0) resultado = LL_ERRO_ESCRITA_FICHEIRO;
+
+    return resultado;
+}
+
+/**
+ * @brief Apresenta uma tabela com informações das antenas.
+ * 
+ * Esta função apresenta uma tabela com as antenas e as suas localizações (x, y).
+ * As tabelas são formatadas num buffer e apresentadas no terminal (ver "LL_apresentarAntenasTabela").
+ * 
+ * @param rede Ponteiro para a estrutura que contem a primeira antena da lista e o número de antenas.
+ * @param saida Destino das antenas (uma por resultado); se for NULL, é apresentada a tabela no terminal.
  * 
  * @return bool "true" caso tenha imprimido antenas.
  * @return bool "false" caso tenha imprimido uma tabela vazia.
  */
-bool LL_apresentarNefastos(Rede *rede)
+bool LL_apresentarAntenas(Rede *rede, Saida *saida)
 {
     // Verifica se o apontador é válido
     if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
 
-    // Imprime a tabela das localizações nefastas
-    printf("---------------------------");
-    printf("\n| X          | Y          |");
-    printf("\n---------------------------");
-
-    if ((*rede).numNefastos > 0)
+    // Envia as antenas para a saída indicada
+    LL_sincronizarPartilhada(rede, 0);
+    if (saida != NULL)
     {
-        Nefasto *nefastoAtual = (*rede).primeiroNefasto;
-
-        while (nefastoAtual != NULL)
+        if ((*rede).cidade != NULL)
         {
-            printf("\n| %-11d| %-11d|",
-                (*nefastoAtual).x,
-                (*nefastoAtual).y);
-            nefastoAtual = (*nefastoAtual).prox;
+            for (Vertice *antenaAtual = (*(*rede).cidade).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+            {
+                if (escreverAntena(saida, (*antenaAtual).frequencia, (*antenaAtual).x, (*antenaAtual).y) < 0) break;
+            }
         }
-        printf("\n---------------------------");
-
-        return true;
-    }
-    else
-    {
-        printf("\n|            |            |");
-        printf("\n---------------------------");
-
-        return false;
-    }    
-}
\ No newline at end of file
+        else if ((*rede).vetorial)
+        {
+            for (int i = 0; i < (*rede).numAntenas; i++)
+            {
+                if (escreverAntena(saida, (*rede).antenasFrequencia[i], (*rede).antenasX[i], (*rede).antenasY[i]) < 0) break;
+            }
+        }
+        else
+        {
+            for (Antena *antenaAtual = (*rede).primeiraAntena; antenaAtual != NULL; antenaAtual = (*antenaAtual).prox)
+            {
+                if (escreverAntena(saida, (*antenaAtual).frequencia, (*antenaAtual).x, (*antenaAtual).y) < 0) break;
+            }
+        }
+
+        return (*rede).numAntenas > 0;
+    }
+
+    // Imprime a tabela das antenas
+    Tabela *tabela = TB_criarTabela(STDOUT_FILENO, 0);
+
+    // Verifica se foi possível alocar a memória
+    if (tabela == NULL) return false;
+
+    int linhas = LL_apresentarAntenasTabela(rede, tabela);
+    TB_libertarTabela(tabela);
+
+    return linhas > 0;
+}
+
+/**
+ * @brief Apresenta a tabela das antenas numa tabela com buffer (ver "Tabelas.h").
+ * 
+ * Respeita o intervalo de linhas e a paginação definidos na tabela; as antenas anteriores ao
+ * intervalo são saltadas sem serem formatadas (diretamente, na rede vetorial).
+ * 
+ * @param rede Ponteiro para a estrutura que contem a primeira antena da lista e o número de antenas.
+ * @param tabela Tabela onde é apresentada a lista.
+ * 
+ * @return Número de antenas apresentadas.
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se rede for NULL.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" ou "TB_ERRO_ESCRITA" em caso de erro na tabela.
+ */
+int LL_apresentarAntenasTabela(Rede *rede, Tabela *tabela)
+{
+    // Verifica se os apontadores são válidos
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+    if (tabela == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    int resultado = TB_iniciarTabela(tabela, "| 📶         | X          | Y          |", 3);
+    if (resultado < 0) return resultado;
+
+    int saltar = TB_saltarLinhas(tabela);
+
+    if ((*rede).cidade != NULL)
+    {
+        Vertice *antenaAtual = (*(*rede).cidade).primeiraAntena;
+
+        while (antenaAtual != NULL && saltar-- > 0) antenaAtual = (*antenaAtual).prox;
+
+        for (; antenaAtual != NULL && TB_iniciarLinha(tabela); antenaAtual = (*antenaAtual).prox)
+        {
+            TB_colunaCaracter(tabela, (*antenaAtual).frequencia);
+            TB_colunaInteiro(tabela, (*antenaAtual).x);
+            TB_colunaInteiro(tabela, (*antenaAtual).y);
+        }
+    }
+    else if ((*rede).vetorial)
+    {
+        for (int i = saltar; i < (*rede).numAntenas && TB_iniciarLinha(tabela); i++)
+        {
+            TB_colunaCaracter(tabela, (*rede).antenasFrequencia[i]);
+            TB_colunaInteiro(tabela, (*rede).antenasX[i]);
+            TB_colunaInteiro(tabela, (*rede).antenasY[i]);
+        }
+    }
+    else
+    {
+        Antena *antenaAtual = (*rede).primeiraAntena;
+
+        while (antenaAtual != NULL && saltar-- > 0) antenaAtual = (*antenaAtual).prox;
+
+        for (; antenaAtual != NULL && TB_iniciarLinha(tabela); antenaAtual = (*antenaAtual).prox)
+        {
+            TB_colunaCaracter(tabela, (*antenaAtual).frequencia);
+            TB_colunaInteiro(tabela, (*antenaAtual).x);
+            TB_colunaInteiro(tabela, (*antenaAtual).y);
+        }
+    }
+
+    return TB_terminarTabela(tabela);
+}
+
+/**
+ * @brief Apresenta uma tabela com informações dos efeitos nefastos.
+ * 
+ * Esta função apresenta uma tabela com os efeitos nefastos e as suas localizações (x, y).
+ * As tabelas são formatadas num buffer e apresentadas no terminal (ver "LL_apresentarNefastosTabela").
+ * 
+ * @param rede Ponteiro para a estrutura que contem o primeiro nefasto da lista e o número de nefastos.
+ * @param saida Destino dos nefastos (um por resultado); se for NULL, é apresentada a tabela no terminal.
+ * 
+ * @return bool "true" caso tenha imprimido antenas.
+ * @return bool "false" caso tenha imprimido uma tabela vazia.
+ */
+bool LL_apresentarNefastos(Rede *rede, Saida *saida)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    // Envia os nefastos para a saída indicada
+    if (saida != NULL)
+    {
+        for (Nefasto *nefastoAtual = (*rede).primeiroNefasto; nefastoAtual != NULL; nefastoAtual = (*nefastoAtual).prox)
+        {
+            if (escreverNefasto(saida, (*nefastoAtual).x, (*nefastoAtual).y) < 0) break;
+        }
+
+        return (*rede).numNefastos > 0;
+    }
+
+    // Imprime a tabela das localizações nefastas
+    Tabela *tabela = TB_criarTabela(STDOUT_FILENO, 0);
+
+    // Verifica se foi possível alocar a memória
+    if (tabela == NULL) return false;
+
+    int linhas = LL_apresentarNefastosTabela(rede, tabela);
+    TB_libertarTabela(tabela);
+
+    return linhas > 0;
+}
+
+/**
+ * @brief Apresenta a tabela dos efeitos nefastos numa tabela com buffer (ver "Tabelas.h").
+ * 
+ * @param rede Ponteiro para a estrutura que contem o primeiro nefasto da lista e o número de nefastos.
+ * @param tabela Tabela onde é apresentada a lista.
+ * 
+ * @return Número de nefastos apresentados.
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se rede for NULL.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" ou "TB_ERRO_ESCRITA" em caso de erro na tabela.
+ */
+int LL_apresentarNefastosTabela(Rede *rede, Tabela *tabela)
+{
+    // Verifica se os apontadores são válidos
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+    if (tabela == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    int resultado = TB_iniciarTabela(tabela, "| X          | Y          |", 2);
+    if (resultado < 0) return resultado;
+
+    int saltar = TB_saltarLinhas(tabela);
+    Nefasto *nefastoAtual = (*rede).primeiroNefasto;
+
+    while (nefastoAtual != NULL && saltar-- > 0) nefastoAtual = (*nefastoAtual).prox;
+
+    for (; nefastoAtual != NULL && TB_iniciarLinha(tabela); nefastoAtual = (*nefastoAtual).prox)
+    {
+        TB_colunaInteiro(tabela, (*nefastoAtual).x);
+        TB_colunaInteiro(tabela, (*nefastoAtual).y);
+    }
+
+    return TB_terminarTabela(tabela);
+}
+
+/*---- Rede vetorial ---------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Calcula a chave de ordenação (y, x) de umas coordenadas.
+ * 
+ * A chave agrupa y nos 32 bits superiores e x (deslocado para não negativo) nos 32 inferiores,
+ * pelo que a ordem das chaves coincide com a ordem (y crescente, x crescente) das listas.
+ * 
+ * @param x Coordenada x.
+ * @param y Coordenada y.
+ * 
+ * @return Chave de 64 bits.
+ */
+static inline int64_t LL_chaveCoordenadas(int x, int y)
+{
+    return (int64_t)y * 4294967296LL + ((int64_t)x - INT32_MIN);
+}
+
+/**
+ * @brief Compara duas chaves (y, x) para o "qsort".
+ */
+static int LL_compararChaves(const void *a, const void *b)
+{
+    int64_t chaveA = *(const int64_t *)a;
+    int64_t chaveB = *(const int64_t *)b;
+
+    return (chaveA > chaveB) - (chaveA < chaveB);
+}
+
+/**
+ * @brief Procura binária da posição de (x, y) nos vetores da rede.
+ * 
+ * @param rede Rede vetorial.
+ * @param x Coordenada x.
+ * @param y Coordenada y.
+ * 
+ * @return Índice da primeira antena com chave maior ou igual a (y, x) (pode ser "numAntenas").
+ */
+static int LL_procurarPosicaoVetor(const Rede *rede, int x, int y)
+{
+    int64_t chave = LL_chaveCoordenadas(x, y);
+    int inicio = 0, fim = (*rede).numAntenas;
+
+    while (inicio < fim)
+    {
+        int meio = inicio + (fim - inicio) / 2;
+
+        if (LL_chaveCoordenadas((*rede).antenasX[meio], (*rede).antenasY[meio]) < chave) inicio = meio + 1;
+        else fim = meio;
+    }
+
+    return inicio;
+}
+
+/**
+ * @brief Garante que os vetores da rede têm pelo menos "capacidade" posições.
+ * 
+ * @param rede Rede vetorial.
+ * @param capacidade Número mínimo de antenas a suportar.
+ * 
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória (os vetores anteriores mantêm-se válidos)
+ */
+static int LL_reservarAntenasVetor(Rede *rede, int capacidade)
+{
+    if (capacidade <= (*rede).capacidadeAntenas) return 0;
+
+    // Crescimento geométrico
+    int novaCapacidade = (*rede).capacidadeAntenas > 0 ? (*rede).capacidadeAntenas : 16;
+    while (novaCapacidade < capacidade) novaCapacidade *= 2;
+
+    int *x = realloc((*rede).antenasX, novaCapacidade * sizeof(int));
+    if (x == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+    (*rede).antenasX = x;
+
+    int *y = realloc((*rede).antenasY, novaCapacidade * sizeof(int));
+    if (y == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+    (*rede).antenasY = y;
+
+    char *frequencia = realloc((*rede).antenasFrequencia, novaCapacidade * sizeof(char));
+    if (frequencia == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+    (*rede).antenasFrequencia = frequencia;
+
+    (*rede).capacidadeAntenas = novaCapacidade;
+
+    return 0;
+}
+
+/**
+ * @brief Anexa uma antena ao fim dos vetores da rede (o chamador garante a ordenação).
+ * 
+ * @param rede Rede vetorial.
+ * @param frequencia Frequência da antena.
+ * @param x Coordenada x.
+ * @param y Coordenada y.
+ * 
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+static int LL_anexarAntenaVetor(Rede *rede, char frequencia, int x, int y)
+{
+    if (LL_reservarAntenasVetor(rede, (*rede).numAntenas + 1) < 0) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    (*rede).antenasX[(*rede).numAntenas] = x;
+    (*rede).antenasY[(*rede).numAntenas] = y;
+    (*rede).antenasFrequencia[(*rede).numAntenas] = frequencia;
+    (*rede).numAntenas++;
+
+    return 0;
+}
+
+/**
+ * @brief Calcula os efeitos nefastos de uma rede vetorial.
+ * 
+ * Os índices das antenas são agrupados por frequência (ordenação por contagem, estável, pelo que cada
+ * grupo mantém a ordem (y, x) dos vetores) e só são comparados os pares dentro de cada grupo. Os nefastos
+ * distintos são acumulados num conjunto e juntos à lista numa única passagem ordenada.
+ * 
+ * @param rede Rede vetorial.
+ * @param coordenadasNegativas Indica se devem ser consideradas coordenadas negativas
+ * @param limitarMapa Se "true", rejeita também os candidatos fora da grelha "largura" x "altura"
+ * 
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+static int LL_calcularNefastosVetor(Rede *rede, bool coordenadasNegativas, bool limitarMapa)
+{
+    size_t numAntenas = ((*rede).numAntenas > 0) ? (size_t)(*rede).numAntenas : 0;
+
+    // Verifica se o tamanho do vetor de índices é representável
+    if (numAntenas > SIZE_MAX / sizeof(size_t)) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    size_t *ordem = malloc((numAntenas > 0 ? numAntenas : 1) * sizeof(size_t));
+
+    // Verifica se foi possível alocar a memória
+    if (ordem == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    // Agrupa os índices por frequência
+    size_t inicio[NUM_FREQUENCIAS + 1] = { 0 };
+    size_t posicao[NUM_FREQUENCIAS];
+
+    for (size_t i = 0; i < numAntenas; i++) inicio[(unsigned char)(*rede).antenasFrequencia[i] + 1]++;
+    for (int f = 0; f < NUM_FREQUENCIAS; f++)
+    {
+        inicio[f + 1] += inicio[f];
+        posicao[f] = inicio[f];
+    }
+    for (size_t i = 0; i < numAntenas; i++) ordem[posicao[(unsigned char)(*rede).antenasFrequencia[i]]++] = i;
+
+    PontosMedios nefastos = { NULL, 0, 0, false };
+    LL_GrupoNefastos grupo = { NULL, NULL, 0, 0, true };
+    int resultado = 0;
+
+    for (int f = 0; f < NUM_FREQUENCIAS && resultado == 0; f++)
+    {
+        grupo.numAntenas = 0;
+        grupo.ordenadoY = true;
+
+        for (size_t k = inicio[f]; k < inicio[f + 1] && resultado == 0; k++) resultado = LL_acrescentarGrupo(&grupo, (*rede).antenasX[ordem[k]], (*rede).antenasY[ordem[k]]);
+        if (resultado == 0) resultado = LL_nefastosGrupo(&grupo, &nefastos, coordenadasNegativas, limitarMapa, (*rede).largura, (*rede).altura);
+    }
+
+    if (resultado == 0) resultado = LL_juntarNefastosOrdenados(rede, &nefastos);
+
+    free(grupo.x);
+    free(grupo.y);
+    free(nefastos.chaves);
+    free(ordem);
+
+    return resultado;
+}
+
+/**
+ * @brief Acrescenta uma antena ao grupo de frequência em cálculo (aumentando os vetores se necessário).
+ * 
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+static int LL_acrescentarGrupo(LL_GrupoNefastos *grupo, int x, int y)
+{
+    if ((*grupo).numAntenas == (*grupo).capacidade)
+    {
+        // Verifica se a nova capacidade é representável antes de realocar
+        if ((*grupo).capacidade > SIZE_MAX / 2 / sizeof(int)) return LL_ERRO_ALOCACAO_MEMORIA;
+
+        size_t capacidade = ((*grupo).capacidade > 0) ? (*grupo).capacidade * 2 : 64;
+        int *novoX = realloc((*grupo).x, capacidade * sizeof(int));
+        if (novoX != NULL) (*grupo).x = novoX;
+        int *novoY = (novoX != NULL) ? realloc((*grupo).y, capacidade * sizeof(int)) : NULL;
+
+        // Verifica se foi possível alocar a memória
+        if (novoY == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+
+        (*grupo).y = novoY;
+        (*grupo).capacidade = capacidade;
+    }
+
+    if ((*grupo).numAntenas > 0 && y < (*grupo).y[(*grupo).numAntenas - 1]) (*grupo).ordenadoY = false;
+
+    (*grupo).x[(*grupo).numAntenas] = x;
+    (*grupo).y[(*grupo).numAntenas] = y;
+    (*grupo).numAntenas++;
+
+    return 0;
+}
+
+/**
+ * @brief Calcula os efeitos nefastos de um grupo de antenas com a mesma frequência.
+ * 
+ * Cada nefasto é inserido no conjunto "nefastos" assim que é calculado (os repetidos são ignorados),
+ * pelo que a memória depende do número de nefastos distintos e não do número de pares.
+ * Se o grupo estiver ordenado por y, assim que ambos os candidatos de um par saem da grelha pelo eixo y,
+ * todos os pares seguintes da mesma antena também saem, e o ciclo interior termina.
+ * 
+ * @param grupo Coordenadas das antenas do grupo.
+ * @param nefastos Conjunto dos nefastos já encontrados.
+ * @param coordenadasNegativas Indica se devem ser consideradas coordenadas negativas
+ * @param limitarMapa Se "true", rejeita também os candidatos fora da grelha "largura" x "altura"
+ * @param largura Largura da grelha.
+ * @param altura Altura da grelha.
+ * 
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+static int LL_nefastosGrupo(const LL_GrupoNefastos *grupo, PontosMedios *nefastos, bool coordenadasNegativas, bool limitarMapa, int largura, int altura)
+{
+    const int *antenasX = (*grupo).x;
+    const int *antenasY = (*grupo).y;
+
+    for (size_t i = 0; i < (*grupo).numAntenas; i++)
+    {
+        for (size_t j = i + 1; j < (*grupo).numAntenas; j++)
+        {
+            int distanciaY = antenasY[j] - antenasY[i];
+
+            // Ambos os candidatos fora da grelha em y (e os pares seguintes também, pela ordenação)
+            if (limitarMapa && (*grupo).ordenadoY && antenasY[i] - distanciaY < 0 && antenasY[j] + distanciaY >= altura) break;
+
+            // Calcula as distâncias entre as antenas
+            int distanciaX = antenasX[j] - antenasX[i];
+
+            // Calcula efeitos nefastos estendendo a linha em ambas as direções
+            int nefastoX[2] = { antenasX[i] - distanciaX, antenasX[j] + distanciaX };
+            int nefastoY[2] = { antenasY[i] - distanciaY, antenasY[j] + distanciaY };
+
+            for (int k = 0; k < 2; k++)
+            {
+                if (!coordenadasNegativas && (nefastoX[k] < 0 || nefastoY[k] < 0)) continue;
+                if (limitarMapa && (nefastoX[k] >= largura || nefastoY[k] >= altura)) continue;
+
+                if (inserirPontoMedio(nefastos, nefastoX[k], nefastoY[k]) < 0) return LL_ERRO_ALOCACAO_MEMORIA;
+            }
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Junta um conjunto de nefastos distintos à lista ordenada de nefastos numa única passagem.
+ * 
+ * As chaves (y, x) do conjunto são copiadas para um vetor e ordenadas; os nefastos já existentes na lista são ignorados.
+ * 
+ * @param rede Rede com a lista de nefastos ordenada.
+ * @param nefastos Conjunto de nefastos distintos (ver "inserirPontoMedio").
+ * 
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+static int LL_juntarNefastosOrdenados(Rede *rede, const PontosMedios *nefastos)
+{
+    size_t numChaves = (*nefastos).numChaves + ((*nefastos).temVazio ? 1 : 0);
+    if (numChaves == 0) return 0;
+
+    // Verifica se o tamanho do vetor é representável
+    if (numChaves > SIZE_MAX / sizeof(int64_t)) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    int64_t *chaves = malloc(numChaves * sizeof(int64_t));
+
+    // Verifica se foi possível alocar a memória
+    if (chaves == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    size_t n = 0;
+    if ((*nefastos).temVazio) chaves[n++] = PONTO_MEDIO_VAZIO;
+    for (size_t i = 0; i < (*nefastos).capacidade; i++)
+    {
+        if ((*nefastos).chaves[i] != PONTO_MEDIO_VAZIO) chaves[n++] = (*nefastos).chaves[i];
+    }
+
+    qsort(chaves, numChaves, sizeof(int64_t), LL_compararChaves);
+
+    Nefasto **ligacao = &(*rede).primeiroNefasto;
+    int resultado = 0;
+
+    for (size_t i = 0; i < numChaves; i++)
+    {
+        // Avança na lista até à posição da chave
+        while (*ligacao != NULL && LL_chaveCoordenadas((**ligacao).x, (**ligacao).y) < chaves[i]) ligacao = &(**ligacao).prox;
+
+        // Ignora nefastos já existentes
+        if (*ligacao != NULL && LL_chaveCoordenadas((**ligacao).x, (**ligacao).y) == chaves[i]) continue;
+
+        // Descodifica a chave
+        int64_t deslocamento = chaves[i] & 0xFFFFFFFFLL;
+        int x = (int)(deslocamento + INT32_MIN);
+        int y = (int)((chaves[i] - deslocamento) / 4294967296LL);
+
+        Nefasto *novo = LL_criarNefasto(x, y);
+
+        // Verifica se foi possível alocar a memória
+        if (novo == NULL)
+        {
+            resultado = LL_ERRO_ALOCACAO_MEMORIA;
+            break;
+        }
+
+        // Insere o nefasto na posição correspondente da lista
+        (*novo).prox = *ligacao;
+        *ligacao = novo;
+        ligacao = &(*novo).prox;
+        LL_indexarNefasto(rede, novo);
+
+        (*rede).numNefastos++;
+    }
+
+    free(chaves);
+
+    return resultado;
+}
+
+/*---- Operações em lote -----------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Compara duas chaves de lote para o "qsort" (por chave e, em empate, pela posição original).
+ */
+static int LL_compararChavesLote(const void *a, const void *b)
+{
+    const LL_ChaveLote *chaveA = a;
+    const LL_ChaveLote *chaveB = b;
+
+    if ((*chaveA).chave != (*chaveB).chave) return ((*chaveA).chave > (*chaveB).chave) - ((*chaveA).chave < (*chaveB).chave);
+
+    return (*chaveA).indice - (*chaveB).indice;
+}
+
+/**
+ * @brief Cria o vetor (chave, índice) de um lote, ordenado por (y, x) e, em empate, pela posição no lote.
+ * 
+ * @param lote Vetor de registos.
+ * @param quantidade Número de registos.
+ * 
+ * @return Vetor alocado (libertar com "free").
+ * @return NULL em caso de falha na alocação de memória.
+ */
+static LL_ChaveLote *LL_ordenarLote(const RegistoAntena *lote, int quantidade)
+{
+    LL_ChaveLote *ordem = malloc(quantidade * sizeof(LL_ChaveLote));
+
+    // Verifica se foi possível alocar a memória
+    if (ordem == NULL) return NULL;
+
+    for (int i = 0; i < quantidade; i++)
+    {
+        ordem[i].chave = LL_chaveCoordenadas(lote[i].x, lote[i].y);
+        ordem[i].indice = i;
+    }
+
+    qsort(ordem, quantidade, sizeof(LL_ChaveLote), LL_compararChavesLote);
+
+    return ordem;
+}
+
+/*---- Índice espacial dos nefastos ------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Acrescenta um nefasto recém-inserido ao índice espacial da rede (se existir).
+ * 
+ * @note Se o índice não conseguir alocar memória, é descartado (as consultas passam a percorrer a lista).
+ */
+static void LL_indexarNefasto(Rede *rede, Nefasto *nefasto)
+{
+    if ((*rede).indiceNefastos != NULL && inserirIndiceEspacial((*rede).indiceNefastos, (*nefasto).x, (*nefasto).y, nefasto) < 0)
+    {
+        (*rede).indiceNefastos = libertarIndiceEspacial((*rede).indiceNefastos);
+    }
+}
+
+/**
+ * @brief Cria (ou recria) o índice espacial dos nefastos da rede.
+ * 
+ * A partir deste momento o índice é mantido em cada inserção de nefastos e é usado pelas
+ * consultas "LL_procurarNefastosRaio", "LL_procurarNefastosRetangulo" e "LL_procurarNefastosProximos".
+ * 
+ * @param rede Apontador para a rede.
+ * @param tamanhoCelula Lado de cada célula da grelha (<= 0 usa "TAMANHO_CELULA_PREDEFINIDO").
+ * 
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se rede for NULL
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória (a rede fica sem índice)
+ */
+int LL_criarIndiceNefastos(Rede *rede, int tamanhoCelula)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    // Substitui o índice anterior
+    (*rede).indiceNefastos = libertarIndiceEspacial((*rede).indiceNefastos);
+
+    IndiceEspacial *indice = criarIndiceEspacial(tamanhoCelula);
+
+    // Verifica se foi possível alocar a memória
+    if (indice == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    for (Nefasto *nefastoAtual = (*rede).primeiroNefasto; nefastoAtual != NULL; nefastoAtual = (*nefastoAtual).prox)
+    {
+        if (inserirIndiceEspacial(indice, (*nefastoAtual).x, (*nefastoAtual).y, nefastoAtual) < 0)
+        {
+            libertarIndiceEspacial(indice);
+            return LL_ERRO_ALOCACAO_MEMORIA;
+        }
+    }
+
+    (*rede).indiceNefastos = indice;
+
+    return 0;
+}
+
+/**
+ * @brief Contexto usado para recolher os resultados das consultas espaciais num vetor.
+ */
+typedef struct LL_RecolhaNefastos
+{
+    Nefasto **resultados;
+    int capacidade;
+    int total;
+
+} LL_RecolhaNefastos;
+
+/**
+ * @brief Guarda um nefasto encontrado no vetor de resultados (se ainda houver espaço).
+ */
+static int LL_recolherNefasto(int x, int y, void *dados, void *contexto)
+{
+    (void)x;
+    (void)y;
+    LL_RecolhaNefastos *recolha = contexto;
+
+    if ((*recolha).resultados != NULL && (*recolha).total < (*recolha).capacidade) (*recolha).resultados[(*recolha).total] = dados;
+    (*recolha).total++;
+
+    return 0;
+}
+
+/**
+ * @brief Procura os nefastos a uma distância (euclidiana) de (x, y) inferior ou igual a "raio".
+ * 
+ * @param rede Apontador para a rede.
+ * @param x Coordenada x do centro.
+ * @param y Coordenada y do centro.
+ * @param raio Raio da procura.
+ * @param resultados Vetor onde são guardados os nefastos encontrados (pode ser NULL para apenas contar).
+ * @param capacidade Número de posições de "resultados".
+ * 
+ * @return Número total de nefastos encontrados (só os primeiros "capacidade" são guardados).
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se rede for NULL
+ */
+int LL_procurarNefastosRaio(Rede *rede, int x, int y, int raio, Nefasto **resultados, int capacidade)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    LL_RecolhaNefastos recolha = { resultados, capacidade, 0 };
+
+    if ((*rede).indiceNefastos != NULL)
+    {
+        consultarRaio((*rede).indiceNefastos, x, y, raio, LL_recolherNefasto, &recolha);
+        return recolha.total;
+    }
+
+    // Sem índice: percorre a lista (ordenada por y) até ao fim da faixa [y - raio, y + raio]
+    int64_t raio2 = (int64_t)raio * raio;
+
+    for (Nefasto *nefastoAtual = (*rede).primeiroNefasto; nefastoAtual != NULL && (int64_t)(*nefastoAtual).y <= (int64_t)y + raio; nefastoAtual = (*nefastoAtual).prox)
+    {
+        int64_t dx = (int64_t)(*nefastoAtual).x - x, dy = (int64_t)(*nefastoAtual).y - y;
+        if (dx * dx + dy * dy <= raio2) LL_recolherNefasto((*nefastoAtual).x, (*nefastoAtual).y, nefastoAtual, &recolha);
+    }
+
+    return recolha.total;
+}
+
+/**
+ * @brief Procura os nefastos dentro do retângulo [x1, x2] x [y1, y2] (limites incluídos).
+ * 
+ * @param rede Apontador para a rede.
+ * @param x1 Limite esquerdo.
+ * @param y1 Limite superior.
+ * @param x2 Limite direito.
+ * @param y2 Limite inferior.
+ * @param resultados Vetor onde são guardados os nefastos encontrados (pode ser NULL para apenas contar).
+ * @param capacidade Número de posições de "resultados".
+ * 
+ * @return Número total de nefastos encontrados (só os primeiros "capacidade" são guardados).
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se rede for NULL
+ */
+int LL_procurarNefastosRetangulo(Rede *rede, int x1, int y1, int x2, int y2, Nefasto **resultados, int capacidade)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+
+    LL_RecolhaNefastos recolha = { resultados, capacidade, 0 };
+
+    if ((*rede).indiceNefastos != NULL)
+    {
+        consultarRetangulo((*rede).indiceNefastos, x1, y1, x2, y2, LL_recolherNefasto, &recolha);
+        return recolha.total;
+    }
+
+    // Sem índice: percorre a lista (ordenada por y) até ao limite inferior
+    for (Nefasto *nefastoAtual = (*rede).primeiroNefasto; nefastoAtual != NULL && (*nefastoAtual).y <= y2; nefastoAtual = (*nefastoAtual).prox)
+    {
+        if ((*nefastoAtual).y >= y1 && (*nefastoAtual).x >= x1 && (*nefastoAtual).x <= x2) LL_recolherNefasto((*nefastoAtual).x, (*nefastoAtual).y, nefastoAtual, &recolha);
+    }
+
+    return recolha.total;
+}
+
+/**
+ * @brief Procura os k nefastos mais próximos de (x, y).
+ * 
+ * @param rede Apontador para a rede.
+ * @param x Coordenada x do ponto de consulta.
+ * @param y Coordenada y do ponto de consulta.
+ * @param k Número de nefastos pretendido.
+ * @param resultados Vetor com pelo menos "k" posições, preenchido por ordem crescente de distância.
+ * 
+ * @note Sem índice espacial é criado um índice temporário para a consulta.
+ * 
+ * @return Número de nefastos encontrados (no máximo "k").
+ * @return "LL_ERRO_REDE_PONTEIRO_INVALIDO" se rede for NULL
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+int LL_procurarNefastosProximos(Rede *rede, int x, int y, int k, Nefasto **resultados)
+{
+    // Verifica se o apontador é válido
+    if (rede == NULL) return LL_ERRO_REDE_PONTEIRO_INVALIDO;
+    if (resultados == NULL || k <= 0) return 0;
+
+    PontoEspacial **pontos = malloc(k * sizeof(PontoEspacial *));
+
+    // Verifica se foi possível alocar a memória
+    if (pontos == NULL) return LL_ERRO_ALOCACAO_MEMORIA;
+
+    // Usa o índice da rede ou um índice temporário
+    IndiceEspacial *indice = (*rede).indiceNefastos;
+    bool temporario = (indice == NULL);
+
+    if (temporario)
+    {
+        indice = criarIndiceEspacial(TAMANHO_CELULA_PREDEFINIDO);
+        for (Nefasto *nefastoAtual = (*rede).primeiroNefasto; indice != NULL && nefastoAtual != NULL; nefastoAtual = (*nefastoAtual).prox)
+        {
+            if (inserirIndiceEspacial(indice, (*nefastoAtual).x, (*nefastoAtual).y, nefastoAtual) < 0) indice = libertarIndiceEspacial(indice);
+        }
+    }
+
+    int encontrados = (indice != NULL) ? consultarVizinhosProximos(indice, x, y, k, pontos) : LL_ERRO_ALOCACAO_MEMORIA;
+
+    for (int i = 0; i < encontrados; i++) resultados[i] = (*pontos[i]).dados;
+
+    if (temporario) libertarIndiceEspacial(indice);
+    free(pontos);
+
+    return (encontrados < 0) ? LL_ERRO_ALOCACAO_MEMORIA : encontrados;
+}
+
+/*---- Desenho do mapa -------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Cria um cursor na primeira antena da rede (lista, vetores ou cidade partilhada).
+ */
+static LL_CursorAntenas LL_iniciarCursor(const Rede *rede)
+{
+    LL_CursorAntenas cursor = { rede, NULL, NULL, 0 };
+
+    if ((*rede).cidade != NULL) cursor.vertice = (*(*rede).cidade).primeiraAntena;
+    else if (!(*rede).vetorial) cursor.antena = (*rede).primeiraAntena;
+
+    return cursor;
+}
+
+/**
+ * @brief Lê a antena atual do cursor.
+ * 
+ * @return "false" se o cursor já passou a última antena.
+ */
+static bool LL_lerCursor(const LL_CursorAntenas *cursor, char *frequencia, int *x, int *y)
+{
+    const Rede *rede = (*cursor).rede;
+
+    if ((*rede).cidade != NULL)
+    {
+        if ((*cursor).vertice == NULL) return false;
+        *frequencia = (*(*cursor).vertice).frequencia;
+        *x = (*(*cursor).vertice).x;
+        *y = (*(*cursor).vertice).y;
+    }
+    else if ((*rede).vetorial)
+    {
+        if ((*cursor).indice >= (*rede).numAntenas) return false;
+        *frequencia = (*rede).antenasFrequencia[(*cursor).indice];
+        *x = (*rede).antenasX[(*cursor).indice];
+        *y = (*rede).antenasY[(*cursor).indice];
+    }
+    else
+    {
+        if ((*cursor).antena == NULL) return false;
+        *frequencia = (*(*cursor).antena).frequencia;
+        *x = (*(*cursor).antena).x;
+        *y = (*(*cursor).antena).y;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Avança o cursor para a antena seguinte.
+ */
+static void LL_avancarCursor(LL_CursorAntenas *cursor)
+{
+    if ((*cursor).vertice != NULL) (*cursor).vertice = (*(*cursor).vertice).prox;
+    else if ((*cursor).antena != NULL) (*cursor).antena = (*(*cursor).antena).prox;
+    else (*cursor).indice++;
+}
+
+/*---- Rede partilhada -------------------------------------------------------------------------------------------------------*/
+
+/**
+ * @brief Copia da cidade partilhada o número de antenas e as dimensões do mapa.
+ * 
+ * @param rede Ponteiro para a rede (sem efeito se não for partilhada).
+ * @param resultado Resultado da operação sobre a cidade, devolvido sem alterações.
+ * 
+ * @return "resultado".
+ */
+static int LL_sincronizarPartilhada(Rede *rede, int resultado)
+{
+    if ((*rede).cidade == NULL) return resultado;
+
+    (*rede).numAntenas = (*(*rede).cidade).numAntenas;
+    (*rede).largura = (*(*rede).cidade).largura;
+    (*rede).altura = (*(*rede).cidade).altura;
+
+    return resultado;
+}
+
+/**
+ * @brief Calcula os efeitos nefastos de uma rede partilhada, par a par dentro de cada grupo de frequência.
+ * 
+ * Só são comparadas antenas da mesma frequência (listas "primeiraAntenaFrequencia" da cidade), em vez
+ * de todos os pares de antenas, com o mesmo cálculo por grupo da rede vetorial ("LL_nefastosGrupo").
+ * 
+ * @param rede Ponteiro para a rede partilhada
+ * @param coordenadasNegativas Indica se devem ser consideradas coordenadas negativas
+ * @param limitarMapa Rejeita também os candidatos fora da grelha ("largura" x "altura")
+ * 
+ * @return 0 em caso de sucesso
+ * @return "LL_ERRO_ALOCACAO_MEMORIA" se falhar a alocação de memória
+ */
+static int LL_calcularNefastosPartilhada(Rede *rede, bool coordenadasNegativas, bool limitarMapa)
+{
+    Grafo *cidade = (*rede).cidade;
+
+    PontosMedios nefastos = { NULL, 0, 0, false };
+    LL_GrupoNefastos grupo = { NULL, NULL, 0, 0, true };
+    int resultado = 0;
+
+    for (int frequencia = 0; frequencia < NUM_FREQUENCIAS && resultado == 0; frequencia++)
+    {
+        grupo.numAntenas = 0;
+        grupo.ordenadoY = true;
+
+        for (Vertice *antena = (*cidade).primeiraAntenaFrequencia[frequencia]; antena != NULL && resultado == 0; antena = (*antena).proxFrequencia)
+        {
+            resultado = LL_acrescentarGrupo(&grupo, (*antena).x, (*antena).y);
+        }
+        if (resultado == 0) resultado = LL_nefastosGrupo(&grupo, &nefastos, coordenadasNegativas, limitarMapa, (*cidade).largura, (*cidade).altura);
+    }
+
+    if (resultado == 0) resultado = LL_juntarNefastosOrdenados(rede, &nefastos);
+
+    free(grupo.x);
+    free(grupo.y);
+    free(nefastos.chaves);
+
+    return resultado;
+}
@@ -192,6 +192,25 @@ bool requesitarResposta(const char *questao)
     return (buffer[0] != 'n');
 }
 
+bool continuarPagina(int pagina, void *contexto)
+{
+    (void)contexto;
+
+    // Aguarda o utilizador ("q" termina a tabela)
+    char buffer[4];
+
+    printf("\n\nPágina %d. Pressione \"Enter\" para continuar (\"q\" para terminar)...", pagina);
+    if (!fgets(buffer, sizeof(buffer), stdin)) return false; // Erro ou EOF
+
+    if (strchr(buffer, '\n') == NULL)
+    {
+        int resultado;
+        while ((resultado = getchar()) != '\n' && resultado != EOF); // Limpeza rápida
+    }
+
+    return tolower((unsigned char)buffer[0]) != 'q';
+}
+
 int imprimirErros(Dados *dados, int resultado)
 {
     if (resultado >= 0) return resultado;
@@ -205,10 +224,18 @@ int imprimirErros(Dados *dados, int resultado)
     else if (resultado == ERRO_ANTENA_NAO_EXISTE) /* LL_ERRO_ANTENA_NAO_EXISTE */ printf("❌ Não existe a antena (%d, %d).\n", (*dados).x[0], (*dados).y[0]);
     else if (resultado == LL_ERRO_NEFASTO_JA_EXISTE) printf("❌ Já existe o nefasto (%d, %d).\n", (*dados).x[0], (*dados).y[0]);
     else if (resultado == LL_ERRO_NEFASTO_NAO_EXISTE) printf("❌ Não existe o nefasto (%d, %d).\n", (*dados).x[0], (*dados).y[0]);
+    else if (resultado == ERRO_ANTENA_REPETIDA_LOTE) /* LL_ERRO_ANTENA_REPETIDA_LOTE */ printf("❌ Antena repetida no lote.\n");
+    else if (resultado == LL_ERRO_OPERACAO_NAO_SUPORTADA) printf("❌ Operação não suportada por esta rede.\n");
     else if (resultado == ERRO_ARESTA_JA_EXISTE) printf("❌ Já existe a aresta (%d, %d) -> (%d, %d).\n", (*dados).x[0], (*dados).y[0], (*dados).x[1], (*dados).y[1]);
     else if (resultado == ERRO_ARESTA_NAO_EXISTE) printf("❌ Não existe a aresta (%d, %d) -> (%d, %d).\n", (*dados).x[0], (*dados).y[0], (*dados).x[1], (*dados).y[1]);
 
     else if (resultado == ERRO_OVERFLOW_LISTA) printf("❌ Ocorreu overflow da lista.\n");
+    else if (resultado == ERRO_CIDADE_NAO_VAZIA) printf("❌ A cidade já tem antenas.\n");
+    else if (resultado == FT_ERRO_LIMITE_ANTENAS) printf("❌ A cidade excede o limite de antenas do fecho transitivo (%d).\n", FT_LIMITE_PREDEFINIDO);
+    else if (resultado == GC_ERRO_LIMITE_IDENTIFICADORES) printf("❌ A cidade excede o limite de identificadores de 32 bits.\n");
+    else if (resultado == NE_ERRO_FICHEIRO_TEMPORARIO) printf("❌ Não foi possível usar os ficheiros temporários.\n");
+    else if (resultado == FM_ERRO_FORMATO_INVALIDO) printf("❌ O ficheiro não é um mapa RLE válido.\n");
+    else if (resultado == LL_ERRO_ESCRITA_FICHEIRO) printf("❌ Não foi possível escrever o ficheiro.\n");
     else if (resultado == ERRO_ABRIR_FICHEIRO) /* == LL_ERRO_ABRIR_FICHEIRO */ printf("❌ Não foi possível abrir o ficheiro.\n");
     else if (resultado == ERRO_ALOCACAO_MEMORIA) /* == LL_ERRO_ALOCACAO_MEMORIA */ printf("❌ Não foi possível alocar memória!\n");
 
@@ -229,7 +256,11 @@ void menuPrincipal()
     {
         "./data/antenas.txt", /* Ficheiro com o mapa das antenas */
         "./data/nefastos.txt", /* Ficheiro com o mapa dos nefastos */
-        "./data/cidade.txt" /* Ficheiro com o mapa dos vértices */
+        "./data/cidade.txt", /* Ficheiro com o mapa dos vértices */
+        "./data/mapa.txt", /* Ficheiro onde é guardado o mapa das antenas e dos nefastos */
+        "./data/nefastos.csv", /* Ficheiro onde são guardados os nefastos calculados em disco */
+        "./data/antenas.rle", /* Ficheiro com o mapa das antenas no formato RLE */
+        "./data/antenas.csv" /* Ficheiro com a lista de coordenadas das antenas */
     };
 
   /*---- Antenas/Nefastos ----------------------------------------------------------------------------------------------------*/
@@ -239,6 +270,7 @@ void menuPrincipal()
  /*---- Grafos ---------------------------------------------------------------------------------------------------------------*/
 
     Grafo *cidade = criarCidade();
+    FechoTransitivo *fecho = NULL; /* Criado na primeira verificação de alcançabilidade */
 
  /*---- Menu -----------------------------------------------------------------------------------------------------------------*/
 
@@ -279,6 +311,15 @@ void menuPrincipal()
             puts("| 13. Procurar pontos de interseção entre antenas com frequências distintas.                                   |");
             puts("| 14. Listar antenas da cidade.                                                                                |");
             puts("| 15. Listar arestas de uma antena da cidade.                                                                  |");
+            puts("| 16. Listar arestas de entrada (predecessores) de uma antena da cidade.                                       |");
+            puts("| 17. Procurar pontos de interseção entre todos os pares de frequências da cidade.                             |");
+            puts("| 18. Comparar a memória ocupada pela cidade e pela sua representação compacta.                                |");
+            puts("| 19. Verificar se uma antena alcança outra (fecho transitivo).                                                |");
+            puts("| 20. Identificar as componentes conexas da cidade e as suas frequências.                                      |");
+            puts("| 21. Guardar o mapa das antenas com os efeitos nefastos sobrepostos (\"./data/mapa.txt\").                      |");
+            puts("| 22. Calcular os efeitos nefastos do ficheiro das antenas em disco, sem o carregar (\"./data/nefastos.csv\").   |");
+            puts("| 23. Converter o mapa das antenas para o formato RLE (\"./data/antenas.rle\").                                  |");
+            puts("| 24. Converter o mapa das antenas para uma lista de coordenadas (\"./data/antenas.csv\").                       |");
             puts("|--------------------------------------------------------------------------------------------------------------|");
             puts("| 0. Encerrar o programa.                                                                                      |");
             puts("|--------------------------------------------------------------------------------------------------------------|");
@@ -350,14 +391,32 @@ void menuPrincipal()
                     if (nefastosAtualizados == false)
                     {
                         LL_libertarNefastos(rede);
-                        LL_calcularNefastos(rede, false); /* Calcula os efeitos nefastos para apresentar */
+                        LL_calcularNefastosMapa(rede); /* Calcula os efeitos nefastos (dentro do mapa) para apresentar */
                         nefastosAtualizados = true;
                     }
+                    // Listas grandes são apresentadas por páginas (com o mesmo buffer para as duas tabelas)
+                    Tabela *tabela = TB_criarTabela(STDOUT_FILENO, 0);
+                    if (tabela == NULL)
+                    {
+                        resultado[0] = imprimirErros(dados, ERRO_ALOCACAO_MEMORIA);
+                        break;
+                    }
+                    if ((*rede).numAntenas + (*rede).numNefastos > TB_LINHAS_PAGINA && requesitarResposta(QUESTAO_PAGINAR_LISTAS))
+                    {
+                        TB_definirPaginacao(tabela, TB_LINHAS_PAGINA, continuarPagina, NULL);
+                    }
+
                     printf("Lista de Antenas (%d):\n\n", (*rede).numAntenas);
-                    LL_apresentarAntenas(rede);
-                    puts("\n");
-                    printf("Lista de Nefastos (%d):\n\n", (*rede).numNefastos);
-                    LL_apresentarNefastos(rede);
+                    LL_apresentarAntenasTabela(rede, tabela);
+
+                    // Terminar uma página das antenas termina a listagem (os nefastos também não são apresentados)
+                    if (!(*tabela).interrompida)
+                    {
+                        puts("\n");
+                        printf("Lista de Nefastos (%d):\n\n", (*rede).numNefastos);
+                        LL_apresentarNefastosTabela(rede, tabela);
+                    }
+                    tabela = TB_libertarTabela(tabela);
                 }
             break;
 
@@ -372,8 +431,16 @@ void menuPrincipal()
 
                     if (requesitarResposta(QUESTAO_INTERLIGAR_ANTENAS))
                     {
-                        resultado[1] = interligarAntenas(cidade, true, false, false);
-                        if (imprimirErros(dados, resultado[1]) >= 0) printf("✅ Antenas com frequências iguais interligadas com sucesso.\n");
+                        if (requesitarResposta(QUESTAO_INTERLIGAR_PENDENTE))
+                        {
+                            resultado[1] = interligarAntenasPendente(cidade);
+                            if (imprimirErros(dados, resultado[1]) >= 0) printf("✅ Antenas com frequências iguais serão interligadas ao serem percorridas.\n");
+                        }
+                        else
+                        {
+                            resultado[1] = interligarAntenas(cidade, true, false, false);
+                            if (imprimirErros(dados, resultado[1]) >= 0) printf("✅ Antenas com frequências iguais interligadas com sucesso.\n");
+                        }
                     }
                 }
             break;
@@ -420,7 +487,7 @@ void menuPrincipal()
                 {
                     if (requesitarDados(cidade, dados, 0, 1, true) == false) break;
                     printf("Procura em profundidade da antena '%c'(%d, %d):\n\n", (*(*dados).antena[0]).frequencia, (*dados).x[0], (*dados).y[0]);
-                    resultado[0] = procurarProfundidade((*dados).antena[0]);
+                    resultado[0] = procurarProfundidade((*dados).antena[0], NULL);
                     imprimirErros(dados, resultado[0]);
                     resetVisitados(cidade);
                 }
@@ -432,7 +499,7 @@ void menuPrincipal()
                 {
                     if (requesitarDados(cidade, dados, 0, 1, true) == false) break;
                     printf("Procura em largura da antena '%c'(%d, %d):\n\n", (*(*dados).antena[0]).frequencia, (*dados).x[0], (*dados).y[0]);
-                    resultado[0] = procurarLargura((*dados).antena[0], (*cidade).numAntenas);
+                    resultado[0] = procurarLargura((*dados).antena[0], (*cidade).numAntenas, NULL);
                     imprimirErros(dados, resultado[0]);
                     resetVisitados(cidade);
                 }
@@ -444,7 +511,7 @@ void menuPrincipal()
                 {
                     if (requesitarDados(cidade, dados, 0, 2, true) == false) break;
                     printf("Caminhos possíveis de '%c'(%d, %d) a '%c'(%d, %d):\n\n", (*(*dados).antena[0]).frequencia, (*dados).x[0], (*dados).y[0], (*(*dados).antena[1]).frequencia, (*dados).x[1], (*dados).y[1]);
-                    resultado[0] = procurarCaminhos((*dados).antena[0], (*dados).antena[1], (*cidade).numAntenas);
+                    resultado[0] = procurarCaminhosPodados(cidade, (*dados).antena[0], (*dados).antena[1], NULL, NULL);
                     if (resultado[0] == 0) printf("❌ Não existem caminhos.\n");
                     else imprimirErros(dados, resultado[0]);
                     resetVisitados(cidade);
@@ -457,7 +524,7 @@ void menuPrincipal()
                 {
                     requesitarDados(cidade, dados, 2, 0, false);
                     if (cidade != NULL && (*dados).frequencia[0] != (*dados).frequencia[1]) printf("Pontos de interseção entre as antenas com frequencias '%c' e '%c':\n\n", (*dados).frequencia[0], (*dados).frequencia[1]);
-                    resultado[0] = listarIntersecoes(cidade, (*dados).frequencia[0], (*dados).frequencia[1]);
+                    resultado[0] = listarIntersecoes(cidade, (*dados).frequencia[0], (*dados).frequencia[1], NULL);
                     if (resultado[0] == 0) printf("❌ Não existem pontos de interseção.\n");
                     else imprimirErros(dados, resultado[0]);
                 }
@@ -467,7 +534,7 @@ void menuPrincipal()
                 if (cidade != NULL && (*cidade).numAntenas > 0)
                 {
                     printf("Lista de Antenas da cidade (%d):\n\n", (*cidade).numAntenas);
-                    listarAntenas(cidade);
+                    listarAntenas(cidade, NULL);
                 }
                 else printf("❌ Não existem antenas na cidade.\n");
             break;
@@ -477,14 +544,130 @@ void menuPrincipal()
                 {
                     if (requesitarDados(cidade, dados, 0, 1, true) == false) break;
                     printf("Lista de Arestas da antena '%c'(%d, %d):\n\n", (*(*dados).antena[0]).frequencia, (*dados).x[0], (*dados).y[0]);
-                    resultado[0] = listarArestasAntena((*dados).antena[0]);
+                    resultado[0] = listarArestasAntena((*dados).antena[0], NULL);
                     if (resultado[0] == 0) printf("❌ A antena não tem arestas.\n");
                     else imprimirErros(dados, resultado[0]);
                 }
                 else printf("❌ Não existem antenas na cidade.\n");
             break;
 
+            case 16:
+                if (cidade != NULL && (*cidade).numAntenas > 0)
+                {
+                    if (requesitarDados(cidade, dados, 0, 1, true) == false) break;
+                    printf("Lista de Arestas de entrada da antena '%c'(%d, %d):\n\n", (*(*dados).antena[0]).frequencia, (*dados).x[0], (*dados).y[0]);
+                    resultado[0] = listarArestasEntradaAntena((*dados).antena[0], NULL);
+                    if (resultado[0] == 0) printf("❌ A antena não tem arestas de entrada.\n");
+                    else imprimirErros(dados, resultado[0]);
+                }
+                else printf("❌ Não existem antenas na cidade.\n");
+            break;
+
+            case 17:
+                if (cidade != NULL && (*cidade).numAntenas < 2) printf("❌ Não existem antenas suficientes para haver interseções.\n");
+                else
+                {
+                    printf("Pontos de interseção entre todos os pares de frequências:\n\n");
+                    resultado[0] = listarTodasIntersecoes(cidade, NULL);
+                    if (resultado[0] == 0) printf("❌ Não existem pontos de interseção.\n");
+                    else imprimirErros(dados, resultado[0]);
+                }
+            break;
+
+            case 18:
+                if (cidade != NULL && (*cidade).numAntenas > 0)
+                {
+                    GrafoCompacto *compacto = GC_criarGrafoCompacto(cidade, true, &resultado[0]);
+                    if (imprimirErros(dados, resultado[0]) >= 0)
+                    {
+                        printf("Memória ocupada pela cidade:\n\n");
+                        resultado[0] = GC_apresentarMemoria(cidade, compacto);
+                        imprimirErros(dados, resultado[0]);
+                    }
+                    compacto = GC_libertarGrafoCompacto(compacto);
+                }
+                else printf("❌ Não existem antenas na cidade.\n");
+            break;
+
+            case 19:
+                if (cidade != NULL && (*cidade).numAntenas < 2) printf("❌ Não existem antenas suficientes para haver caminhos.\n");
+                else
+                {
+                    if (requesitarDados(cidade, dados, 0, 2, true) == false) break;
+                    if (fecho == NULL) fecho = FT_criarFechoTransitivo(cidade, FT_LIMITE_PREDEFINIDO, &resultado[0]);
+                    if (imprimirErros(dados, resultado[0]) < 0) break;
+
+                    resultado[0] = FT_alcancavel(fecho, (*dados).antena[0], (*dados).antena[1]);
+                    if (resultado[0] == 1) printf("✅ A antena '%c'(%d, %d) alcança a antena '%c'(%d, %d).\n", (*(*dados).antena[0]).frequencia, (*dados).x[0], (*dados).y[0], (*(*dados).antena[1]).frequencia, (*dados).x[1], (*dados).y[1]);
+                    else if (resultado[0] == 0) printf("❌ A antena '%c'(%d, %d) não alcança a antena '%c'(%d, %d).\n", (*(*dados).antena[0]).frequencia, (*dados).x[0], (*dados).y[0], (*(*dados).antena[1]).frequencia, (*dados).x[1], (*dados).y[1]);
+                    else imprimirErros(dados, resultado[0]);
+
+                    resultado[1] = FT_contarAlcancaveis(fecho, (*dados).antena[0]);
+                    if (imprimirErros(dados, resultado[1]) >= 0) printf("\nA antena '%c'(%d, %d) alcança %d antena(s) da cidade.\n", (*(*dados).antena[0]).frequencia, (*dados).x[0], (*dados).y[0], resultado[1]);
+                }
+            break;
+
+            case 20:
+                if (cidade != NULL && (*cidade).numAntenas > 0)
+                {
+                    GrafoCompacto *compacto = GC_criarGrafoCompacto(cidade, false, &resultado[0]);
+                    if (imprimirErros(dados, resultado[0]) >= 0)
+                    {
+                        Componentes *componentes = CC_calcularComponentes(compacto, &resultado[0]);
+                        if (imprimirErros(dados, resultado[0]) >= 0)
+                        {
+                            resultado[0] = CC_apresentarComponentes(compacto, componentes, CC_NUM_COMPONENTES_APRESENTAR);
+                            imprimirErros(dados, resultado[0]);
+                        }
+                        componentes = CC_libertarComponentes(componentes);
+                    }
+                    compacto = GC_libertarGrafoCompacto(compacto);
+                }
+                else printf("❌ Não existem antenas na cidade.\n");
+            break;
+
+            case 21:
+                if ((*rede).numAntenas == 0) printf("❌ Não existem antenas.\n");
+                else
+                {
+                    if (nefastosAtualizados == false)
+                    {
+                        LL_libertarNefastos(rede);
+                        resultado[0] = LL_calcularNefastosMapa(rede); /* Calcula os efeitos nefastos (dentro do mapa) para desenhar */
+                        nefastosAtualizados = (resultado[0] >= 0);
+                    }
+                    if (imprimirErros(dados, resultado[0]) < 0) break;
+
+                    resultado[0] = LL_guardarMapa(rede, localizacaoFicheiro[3]);
+                    if (imprimirErros(dados, resultado[0]) >= 0) printf("✅ Mapa (%d linhas) guardado em \"%s\".\n", resultado[0], localizacaoFicheiro[3]);
+                }
+            break;
+
+            case 22:
+            {
+                EstatisticasExternas estatisticas;
+                resultado[0] = NE_calcularNefastosFicheiro(localizacaoFicheiro[0], localizacaoFicheiro[4], true, &estatisticas);
+                if (imprimirErros(dados, resultado[0]) >= 0)
+                {
+                    printf("✅ %d nefastos guardados em \"%s\".\n\n", resultado[0], localizacaoFicheiro[4]);
+                    printf("Antenas: %d em %d frequências (maior frequência: %d antenas)\n", estatisticas.numAntenas, estatisticas.numFrequencias, estatisticas.maiorFrequencia);
+                    printf("Candidatos: %lld (%d blocos ordenados em disco)\n", (long long)estatisticas.numCandidatos, estatisticas.numBlocos);
+                }
+            }
+            break;
+
+            case 23:
+                resultado[0] = FM_converterTextoRLE(localizacaoFicheiro[0], localizacaoFicheiro[5]);
+                if (imprimirErros(dados, resultado[0]) >= 0) printf("✅ Mapa (%d posições ocupadas) guardado em \"%s\".\n", resultado[0], localizacaoFicheiro[5]);
+            break;
+
+            case 24:
+                resultado[0] = FM_converterTextoCoordenadas(localizacaoFicheiro[0], localizacaoFicheiro[6]);
+                if (imprimirErros(dados, resultado[0]) >= 0) printf("✅ Lista de coordenadas (%d antenas) guardada em \"%s\".\n", resultado[0], localizacaoFicheiro[6]);
+            break;
+
             case 0:
+                fecho = FT_libertarFechoTransitivo(fecho);
                 rede = LL_libertarRede(rede);
                 cidade = libertarCidade(cidade);
                 printf("Encerrando o programa...\n");
@@ -503,6 +686,7 @@ void menuPrincipal()
         {
             printf("\nPressione \"Enter\" para sair...");
             getchar(); /* Aguarda o utilizador pressionar "Enter" */
+            fecho = FT_libertarFechoTransitivo(fecho);
             rede = LL_libertarRede(rede);
             cidade = libertarCidade(cidade);
 
@@ -523,9 +707,22 @@ void menuPrincipal()
  * @return Retorna int 0
  * 
  * @note Inicia o programa ao fazer a chamanda do menu principal
+ * @note Com "--servidor [caminho do socket] [número de trabalhadores]" carrega a cidade e a rede
+ *       e atende pedidos num socket UNIX (ver "Servidor.h") em vez de abrir o menu.
  */
-int main()
+int main(int argc, char *argv[])
 {
+    if (argc > 1 && strcmp(argv[1], "--servidor") == 0)
+    {
+        Dados dados = { 0 };
+        int resultado = iniciarServidor(argc > 2 ? argv[2] : NULL, "./data/cidade.txt", "./data/antenas.txt", argc > 3 ? atoi(argv[3]) : 0);
+        if (resultado == SERVIDOR_ERRO_SOCKET) printf("❌ Não foi possível abrir o socket.\n");
+        else if (resultado == SERVIDOR_ERRO_TRABALHADORES) printf("❌ Não foi possível arrancar os trabalhadores.\n");
+        else imprimirErros(&dados, resultado);
+
+        return (resultado < 0) ? 1 : 0;
+    }
+
     menuPrincipal();
 
     return 0;
@@ -0,0 +1,462 @@
+/**
+ * @file Nefastos_Externos.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação do cálculo dos efeitos nefastos em disco (fora da memória)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Nefastos_Externos.h"
+
+#define NE_NUM_FREQUENCIAS 256
+
+/**
+ * @struct NE_Posicao
+ * @brief Registo de uma antena numa partição (a frequência é a da partição).
+ */
+typedef struct NE_Posicao
+{
+    int32_t x;
+    int32_t y;
+
+} NE_Posicao;
+
+/**
+ * @struct NE_Bloco
+ * @brief Bloco ordenado de chaves guardado no ficheiro temporário dos blocos, lido aos poucos durante a junção.
+ */
+typedef struct NE_Bloco
+{
+    off_t inicio;
+    int64_t restantes;
+    int64_t *chaves;
+    int posicao;
+    int quantidade;
+
+} NE_Bloco;
+
+/**
+ * @brief Calcula a chave de ordenação (y, x) de umas coordenadas (a mesma ordem das listas de nefastos).
+ */
+static inline int64_t NE_chaveCoordenadas(int x, int y)
+{
+    return (int64_t)y * 4294967296LL + ((int64_t)x - INT32_MIN);
+}
+
+/**
+ * @brief Descodifica uma chave nas coordenadas (x, y).
+ */
+static inline void NE_coordenadasChave(int64_t chave, int *x, int *y)
+{
+    int64_t deslocamento = chave & 0xFFFFFFFFLL;
+
+    *x = (int)(deslocamento + INT32_MIN);
+    *y = (int)((chave - deslocamento) / 4294967296LL);
+}
+
+static int NE_compararChaves(const void *a, const void *b)
+{
+    int64_t chaveA = *(const int64_t *)a;
+    int64_t chaveB = *(const int64_t *)b;
+
+    return (chaveA > chaveB) - (chaveA < chaveB);
+}
+
+/**
+ * @brief Ordena um bloco de chaves e remove as repetidas.
+ *
+ * @return Número de chaves distintas (no início do bloco).
+ */
+static int NE_ordenarBloco(int64_t *chaves, int quantidade)
+{
+    if (quantidade == 0) return 0;
+
+    qsort(chaves, quantidade, sizeof(int64_t), NE_compararChaves);
+
+    int distintas = 1;
+    for (int i = 1; i < quantidade; i++)
+    {
+        if (chaves[i] != chaves[distintas - 1]) chaves[distintas++] = chaves[i];
+    }
+
+    return distintas;
+}
+
+/**
+ * @brief Escreve um nefasto na saída ("x,y"), se for diferente do último escrito.
+ */
+static int NE_escreverNefasto(FILE *saida, int64_t chave, int64_t *ultima, int *numNefastos)
+{
+    if (*numNefastos > 0 && chave == *ultima) return 0;
+
+    int x, y;
+    NE_coordenadasChave(chave, &x, &y);
+
+    if (fprintf(saida, "%d,%d\n", x, y) < 0) return NE_ERRO_ESCRITA;
+
+    *ultima = chave;
+    (*numNefastos)++;
+
+    return 0;
+}
+
+/**
+ * @brief Lê o próximo troço de um bloco ordenado (com "pread", sem alterar a posição do ficheiro).
+ *
+ * @return "false" se o bloco terminou ou ocorreu um erro de leitura.
+ */
+static bool NE_lerBloco(int descritor, NE_Bloco *bloco)
+{
+    if ((*bloco).restantes == 0) return false;
+
+    int64_t ler = ((*bloco).restantes < NE_CHAVES_LEITURA) ? (*bloco).restantes : NE_CHAVES_LEITURA;
+    ssize_t lidos = pread(descritor, (*bloco).chaves, (size_t)ler * sizeof(int64_t), (*bloco).inicio);
+
+    if (lidos != (ssize_t)(ler * (int64_t)sizeof(int64_t))) return false;
+
+    (*bloco).inicio += (off_t)lidos;
+    (*bloco).restantes -= ler;
+    (*bloco).posicao = 0;
+    (*bloco).quantidade = (int)ler;
+
+    return true;
+}
+
+/**
+ * @brief Repõe a propriedade do heap mínimo (pela chave atual de cada bloco) a partir da posição indicada.
+ */
+static void NE_descerHeap(NE_Bloco *blocos, int *heap, int tamanho, int posicao)
+{
+    while (true)
+    {
+        int menor = posicao;
+        int esquerda = 2 * posicao + 1;
+        int direita = esquerda + 1;
+
+        if (esquerda < tamanho && blocos[heap[esquerda]].chaves[blocos[heap[esquerda]].posicao] < blocos[heap[menor]].chaves[blocos[heap[menor]].posicao]) menor = esquerda;
+        if (direita < tamanho && blocos[heap[direita]].chaves[blocos[heap[direita]].posicao] < blocos[heap[menor]].chaves[blocos[heap[menor]].posicao]) menor = direita;
+        if (menor == posicao) return;
+
+        int temp = heap[posicao];
+        heap[posicao] = heap[menor];
+        heap[menor] = temp;
+        posicao = menor;
+    }
+}
+
+/**
+ * @brief Junta os blocos ordenados (junção de k vias com um heap mínimo) e escreve os nefastos distintos.
+ *
+ * @return Número de nefastos escritos.
+ * @return "NE_ERRO_ALOCACAO_MEMORIA", "NE_ERRO_FICHEIRO_TEMPORARIO" ou "NE_ERRO_ESCRITA" em caso de erro.
+ */
+static int NE_juntarBlocos(FILE *ficheiroBlocos, NE_Bloco *blocos, int numBlocos, FILE *saida)
+{
+    if (fflush(ficheiroBlocos) != 0) return NE_ERRO_FICHEIRO_TEMPORARIO;
+
+    int descritor = fileno(ficheiroBlocos);
+    int *heap = malloc(numBlocos * sizeof(int));
+    int64_t *leitura = malloc((size_t)numBlocos * NE_CHAVES_LEITURA * sizeof(int64_t));
+
+    // Verifica se foi possível alocar a memória
+    if (heap == NULL || leitura == NULL)
+    {
+        free(heap);
+        free(leitura);
+        return NE_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    // Lê o primeiro troço de cada bloco
+    int tamanho = 0;
+    for (int b = 0; b < numBlocos; b++)
+    {
+        blocos[b].chaves = leitura + (size_t)b * NE_CHAVES_LEITURA;
+        if (NE_lerBloco(descritor, &blocos[b])) heap[tamanho++] = b;
+    }
+    for (int i = tamanho / 2 - 1; i >= 0; i--) NE_descerHeap(blocos, heap, tamanho, i);
+
+    int64_t ultima = 0;
+    int numNefastos = 0;
+    int resultado = 0;
+
+    while (tamanho > 0 && resultado == 0)
+    {
+        NE_Bloco *bloco = &blocos[heap[0]];
+
+        resultado = NE_escreverNefasto(saida, (*bloco).chaves[(*bloco).posicao], &ultima, &numNefastos);
+
+        // Avança no bloco (e retira-o do heap quando termina)
+        if (++(*bloco).posicao == (*bloco).quantidade && !NE_lerBloco(descritor, bloco))
+        {
+            if ((*bloco).restantes != 0) resultado = NE_ERRO_FICHEIRO_TEMPORARIO;
+            heap[0] = heap[--tamanho];
+        }
+        NE_descerHeap(blocos, heap, tamanho, 0);
+    }
+
+    free(heap);
+    free(leitura);
+
+    return (resultado < 0) ? resultado : numNefastos;
+}
+
+/**
+ * @brief Lê o mapa uma vez e reparte as antenas por ficheiros temporários, um por frequência.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "NE_ERRO_ABRIR_FICHEIRO" ou "NE_ERRO_FICHEIRO_TEMPORARIO" em caso de erro.
+ */
+static int NE_repartirMapa(const char *localizacaoMapa, FILE **particoes, int *numAntenasFrequencia, EstatisticasExternas *estatisticas)
+{
+    // Abre o ficheiro para leitura
+    FILE *ficheiro = fopen(localizacaoMapa, "r");
+
+    // Verifica se foi possível abrir o ficheiro
+    if (ficheiro == NULL) return NE_ERRO_ABRIR_FICHEIRO;
+
+    // Variáveis necessárias para leitura (com getline)
+    char *linha = NULL;
+    size_t tamanho = 0;
+    ssize_t lidos;
+    int resultado = 0;
+
+    for (int y = 0; resultado == 0 && (lidos = getline(&linha, &tamanho, ficheiro)) != -1; y++)
+    {
+        // Regista a largura (sem a mudança de linha) e a altura da grelha
+        int larguraLinha = (int)lidos;
+        while (larguraLinha > 0 && (linha[larguraLinha - 1] == '\n' || linha[larguraLinha - 1] == '\r')) larguraLinha--;
+        if (larguraLinha > (*estatisticas).largura) (*estatisticas).largura = larguraLinha;
+        (*estatisticas).altura = y + 1;
+
+        for (int x = 0; x < lidos; x++)
+        {
+            // Verifica se o caracter é uma letra (com early exit)
+            if (linha[x] >= 'A' && (linha[x] <= 'Z' || (linha[x] >= 'a' && linha[x] <= 'z')))
+            {
+                unsigned char frequencia = (unsigned char)linha[x];
+
+                // Cria a partição da frequência na primeira antena
+                if (particoes[frequencia] == NULL)
+                {
+                    particoes[frequencia] = tmpfile();
+                    if (particoes[frequencia] == NULL)
+                    {
+                        resultado = NE_ERRO_FICHEIRO_TEMPORARIO;
+                        break;
+                    }
+                    (*estatisticas).numFrequencias++;
+                }
+
+                NE_Posicao posicao = { x, y };
+                if (fwrite(&posicao, sizeof(NE_Posicao), 1, particoes[frequencia]) != 1)
+                {
+                    resultado = NE_ERRO_FICHEIRO_TEMPORARIO;
+                    break;
+                }
+
+                numAntenasFrequencia[frequencia]++;
+                (*estatisticas).numAntenas++;
+            }
+        }
+    }
+
+    free(linha);
+    fclose(ficheiro);
+
+    return resultado;
+}
+
+/**
+ * @brief Calcula os efeitos nefastos de um mapa sem o carregar para memória e guarda-os ordenados num ficheiro.
+ *
+ * 1. O mapa é lido uma única vez e as antenas são repartidas por ficheiros temporários, um por frequência.
+ * 2. Cada partição é carregada sozinha e os nefastos candidatos dos seus pares são acumulados em blocos
+ *    de "NE_CHAVES_BLOCO" chaves; cada bloco cheio é ordenado e guardado num ficheiro temporário.
+ * 3. Os blocos ordenados são juntos (junção de k vias) e os nefastos distintos são escritos em
+ *    "localizacaoSaida", um por linha ("x,y"), pela ordem (y, x) das listas de nefastos.
+ *
+ * A memória usada é limitada pela maior frequência (e não pelo mapa completo), mais um bloco de chaves
+ * e um troço de leitura por bloco durante a junção.
+ *
+ * @param localizacaoMapa Caminho do mapa (mesmo formato de "LL_carregarAntenas").
+ * @param localizacaoSaida Caminho do ficheiro a criar com os nefastos.
+ * @param limitarMapa Rejeita os nefastos fora da grelha do mapa (como "LL_calcularNefastosMapa");
+ *        caso contrário, só são rejeitadas as coordenadas negativas (como "LL_calcularNefastos(rede, false)").
+ * @param estatisticas Apontador opcional (pode ser NULL) que recebe o resumo do cálculo.
+ *
+ * @return Número de nefastos escritos.
+ * @return "NE_ERRO_ABRIR_FICHEIRO" se não for possível abrir o mapa ou criar a saída.
+ * @return "NE_ERRO_FICHEIRO_TEMPORARIO" se ocorrer um erro nos ficheiros temporários.
+ * @return "NE_ERRO_ESCRITA" se ocorrer um erro de escrita na saída.
+ * @return "NE_ERRO_ALOCACAO_MEMORIA" se ocorrer um erro de alocação de memória.
+ */
+int NE_calcularNefastosFicheiro(const char *localizacaoMapa, const char *localizacaoSaida, bool limitarMapa, EstatisticasExternas *estatisticas)
+{
+    EstatisticasExternas resumo = { 0 };
+    FILE *particoes[NE_NUM_FREQUENCIAS] = { NULL };
+    int numAntenasFrequencia[NE_NUM_FREQUENCIAS] = { 0 };
+
+    // 1. Reparte as antenas por frequência
+    int resultado = NE_repartirMapa(localizacaoMapa, particoes, numAntenasFrequencia, &resumo);
+
+    for (int f = 0; f < NE_NUM_FREQUENCIAS; f++)
+    {
+        if (numAntenasFrequencia[f] > resumo.maiorFrequencia) resumo.maiorFrequencia = numAntenasFrequencia[f];
+    }
+
+    // Memória da maior partição, do bloco de chaves e da tabela de blocos
+    NE_Posicao *posicoes = NULL;
+    int64_t *chaves = NULL;
+    NE_Bloco *blocos = NULL;
+    int capacidadeBlocos = 0;
+    FILE *ficheiroBlocos = NULL;
+    FILE *saida = NULL;
+
+    if (resultado == 0)
+    {
+        posicoes = malloc(((resumo.maiorFrequencia > 0) ? resumo.maiorFrequencia : 1) * sizeof(NE_Posicao));
+        chaves = malloc(NE_CHAVES_BLOCO * sizeof(int64_t));
+
+        // Verifica se foi possível alocar a memória
+        if (posicoes == NULL || chaves == NULL) resultado = NE_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    // 2. Gera os candidatos de cada partição, em blocos ordenados
+    int numChaves = 0;
+    int64_t largura = limitarMapa ? resumo.largura : INT32_MAX;
+    int64_t altura = limitarMapa ? resumo.altura : INT32_MAX;
+
+    for (int f = 0; f < NE_NUM_FREQUENCIAS && resultado == 0; f++)
+    {
+        int n = numAntenasFrequencia[f];
+        if (n < 2) continue;
+
+        rewind(particoes[f]);
+        if (fread(posicoes, sizeof(NE_Posicao), (size_t)n, particoes[f]) != (size_t)n)
+        {
+            resultado = NE_ERRO_FICHEIRO_TEMPORARIO;
+            break;
+        }
+
+        for (int i = 0; i < n && resultado == 0; i++)
+        {
+            for (int j = i + 1; j < n; j++)
+            {
+                // Calcula efeitos nefastos estendendo a linha em ambas as direções
+                int64_t nefastoX[2] = { 2 * (int64_t)posicoes[i].x - posicoes[j].x, 2 * (int64_t)posicoes[j].x - posicoes[i].x };
+                int64_t nefastoY[2] = { 2 * (int64_t)posicoes[i].y - posicoes[j].y, 2 * (int64_t)posicoes[j].y - posicoes[i].y };
+
+                for (int k = 0; k < 2; k++)
+                {
+                    if (nefastoX[k] < 0 || nefastoY[k] < 0 || nefastoX[k] >= largura || nefastoY[k] >= altura) continue;
+
+                    chaves[numChaves++] = NE_chaveCoordenadas((int)nefastoX[k], (int)nefastoY[k]);
+                    resumo.numCandidatos++;
+                }
+
+                if (numChaves < NE_CHAVES_BLOCO - 1) continue;
+
+                // Bloco cheio: ordena e guarda no ficheiro temporário dos blocos
+                numChaves = NE_ordenarBloco(chaves, numChaves);
+
+                if (ficheiroBlocos == NULL && (ficheiroBlocos = tmpfile()) == NULL)
+                {
+                    resultado = NE_ERRO_FICHEIRO_TEMPORARIO;
+                    break;
+                }
+                if (resumo.numBlocos == capacidadeBlocos)
+                {
+                    capacidadeBlocos = (capacidadeBlocos > 0) ? capacidadeBlocos * 2 : 16;
+                    NE_Bloco *temp = realloc(blocos, capacidadeBlocos * sizeof(NE_Bloco));
+                    if (temp == NULL)
+                    {
+                        resultado = NE_ERRO_ALOCACAO_MEMORIA;
+                        break;
+                    }
+                    blocos = temp;
+                }
+
+                blocos[resumo.numBlocos].inicio = (resumo.numBlocos > 0) ? blocos[resumo.numBlocos - 1].inicio + (off_t)(blocos[resumo.numBlocos - 1].restantes * (int64_t)sizeof(int64_t)) : 0;
+                blocos[resumo.numBlocos].restantes = numChaves;
+                resumo.numBlocos++;
+
+                if (fwrite(chaves, sizeof(int64_t), (size_t)numChaves, ficheiroBlocos) != (size_t)numChaves)
+                {
+                    resultado = NE_ERRO_FICHEIRO_TEMPORARIO;
+                    break;
+                }
+                numChaves = 0;
+            }
+        }
+    }
+
+    // 3. Escreve os nefastos ordenados (diretamente, se couberam num só bloco)
+    if (resultado == 0)
+    {
+        saida = fopen(localizacaoSaida, "w");
+        if (saida == NULL) resultado = NE_ERRO_ABRIR_FICHEIRO;
+    }
+
+    if (resultado == 0)
+    {
+        numChaves = NE_ordenarBloco(chaves, numChaves);
+
+        if (resumo.numBlocos == 0)
+        {
+            int64_t ultima = 0;
+            for (int i = 0; i < numChaves && resultado == 0; i++) resultado = NE_escreverNefasto(saida, chaves[i], &ultima, &resumo.numNefastos);
+        }
+        else
+        {
+            // O último bloco fica também no ficheiro, para uma junção uniforme
+            if (numChaves > 0)
+            {
+                if (resumo.numBlocos == capacidadeBlocos)
+                {
+                    NE_Bloco *temp = realloc(blocos, (capacidadeBlocos + 1) * sizeof(NE_Bloco));
+                    if (temp == NULL) resultado = NE_ERRO_ALOCACAO_MEMORIA;
+                    else blocos = temp;
+                }
+                if (resultado == 0)
+                {
+                    blocos[resumo.numBlocos].inicio = blocos[resumo.numBlocos - 1].inicio + (off_t)(blocos[resumo.numBlocos - 1].restantes * (int64_t)sizeof(int64_t));
+                    blocos[resumo.numBlocos].restantes = numChaves;
+                    resumo.numBlocos++;
+
+                    if (fwrite(chaves, sizeof(int64_t), (size_t)numChaves, ficheiroBlocos) != (size_t)numChaves) resultado = NE_ERRO_FICHEIRO_TEMPORARIO;
+                }
+            }
+
+            // O bloco de chaves já não é necessário durante a junção
+            free(chaves);
+            chaves = NULL;
+
+            if (resultado == 0)
+            {
+                resultado = NE_juntarBlocos(ficheiroBlocos, blocos, resumo.numBlocos, saida);
+                if (resultado >= 0)
+                {
+                    resumo.numNefastos = resultado;
+                    resultado = 0;
+                }
+            }
+        }
+    }
+
+    // Liberta a memória e fecha os ficheiros (os temporários são apagados ao fechar)
+    if (saida != NULL && fclose(saida) != 0 && resultado == 0) resultado = NE_ERRO_ESCRITA;
+    if (ficheiroBlocos != NULL) fclose(ficheiroBlocos);
+    for (int f = 0; f < NE_NUM_FREQUENCIAS; f++)
+    {
+        if (particoes[f] != NULL) fclose(particoes[f]);
+    }
+    free(posicoes);
+    free(chaves);
+    free(blocos);
+
+    if (estatisticas != NULL) *estatisticas = resumo;
+
+    return (resultado < 0) ? resultado : resumo.numNefastos;
+}
@@ -0,0 +1,454 @@
+/**
+ * @file Procura_Paralela.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação da procura em largura paralela (por níveis, com otimização de direção)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Procura_Paralela.h"
+
+#include <string.h>
+#include <unistd.h>
+
+// Número de antenas descobertas que cada thread acumula antes de as copiar para a próxima fronteira
+#define PP_TAMANHO_LOCAL 1024
+
+/**
+ * @brief Estado partilhado por todas as threads de uma procura.
+ *
+ * Na expansão descendente a fronteira é um vetor ("fronteira", "numFronteira") e cada thread percorre
+ * as arestas de saída de blocos da fronteira. Na expansão ascendente a fronteira é um mapa de bits
+ * ("fronteiraBits") e cada thread percorre as arestas de entrada de blocos de antenas ainda não visitadas.
+ */
+typedef struct ContextoLargura
+{
+    const GrafoCompacto *grafo;
+    int32_t *distancias;
+    pthread_barrier_t barreira;
+
+    _Atomic uint64_t *visitadas;
+    _Atomic uint64_t *fronteiraBits;
+    _Atomic uint64_t *proximaBits;
+    size_t numPalavras;
+
+    uint32_t *fronteira;
+    uint32_t numFronteira;
+    uint32_t *proxima;
+    atomic_uint numProxima;
+
+    atomic_uint proximoBloco;
+    atomic_uint contagemProxima;
+    atomic_ullong arestasProxima;
+
+    bool ascendente;
+    bool terminado;
+    int32_t nivel;
+    uint64_t arestasPorVisitar;
+    EstatisticasLargura estatisticas;
+
+    // Arranque das threads
+    pthread_mutex_t trincoArranque;
+    pthread_cond_t condicaoArranque;
+    bool pronto;
+
+} ContextoLargura;
+
+/**
+ * @brief Devolve o número de processadores disponíveis (pelo menos 1).
+ */
+int PP_numeroProcessadores()
+{
+    long numero = sysconf(_SC_NPROCESSORS_ONLN);
+
+    return (numero > 0) ? (int)numero : 1;
+}
+
+/**
+ * @brief Grau de saída de uma antena.
+ */
+static inline uint32_t grauSaida(const GrafoCompacto *grafo, uint32_t vertice)
+{
+    return (*grafo).inicioArestas[vertice + 1] - (*grafo).inicioArestas[vertice];
+}
+
+/**
+ * @brief Copia as antenas descobertas por uma thread para a próxima fronteira (reserva um intervalo).
+ */
+static void copiarDescobertas(ContextoLargura *contexto, const uint32_t *descobertas, uint32_t numDescobertas)
+{
+    if (numDescobertas == 0) return;
+
+    uint32_t posicao = atomic_fetch_add_explicit(&(*contexto).numProxima, numDescobertas, memory_order_relaxed);
+    memcpy(&(*contexto).proxima[posicao], descobertas, numDescobertas * sizeof(uint32_t));
+}
+
+/**
+ * @brief Expansão descendente: cada antena da fronteira tenta reclamar os seus vizinhos não visitados.
+ */
+static void expandirDescendente(ContextoLargura *contexto)
+{
+    const GrafoCompacto *grafo = (*contexto).grafo;
+    uint32_t descobertas[PP_TAMANHO_LOCAL];
+    uint32_t numDescobertas = 0;
+    uint64_t arestas = 0;
+
+    while (true)
+    {
+        uint32_t inicio = atomic_fetch_add_explicit(&(*contexto).proximoBloco, PP_BLOCO, memory_order_relaxed);
+        if (inicio >= (*contexto).numFronteira) break;
+        uint32_t fim = (inicio + PP_BLOCO < (*contexto).numFronteira) ? inicio + PP_BLOCO : (*contexto).numFronteira;
+
+        for (uint32_t i = inicio; i < fim; i++)
+        {
+            uint32_t vertice = (*contexto).fronteira[i];
+
+            for (uint32_t a = (*grafo).inicioArestas[vertice]; a < (*grafo).inicioArestas[vertice + 1]; a++)
+            {
+                uint32_t destino = (*grafo).destinos[a];
+                uint64_t mascara = 1ULL << (destino & 63);
+                _Atomic uint64_t *palavra = &(*contexto).visitadas[destino >> 6];
+
+                // Leitura barata primeiro; só a thread que muda o bit fica com a antena
+                if (atomic_load_explicit(palavra, memory_order_relaxed) & mascara) continue;
+                if (atomic_fetch_or_explicit(palavra, mascara, memory_order_relaxed) & mascara) continue;
+
+                (*contexto).distancias[destino] = (*contexto).nivel + 1;
+                arestas += grauSaida(grafo, destino);
+                descobertas[numDescobertas++] = destino;
+
+                if (numDescobertas == PP_TAMANHO_LOCAL)
+                {
+                    copiarDescobertas(contexto, descobertas, numDescobertas);
+                    numDescobertas = 0;
+                }
+            }
+        }
+    }
+
+    copiarDescobertas(contexto, descobertas, numDescobertas);
+    atomic_fetch_add_explicit(&(*contexto).arestasProxima, arestas, memory_order_relaxed);
+}
+
+/**
+ * @brief Expansão ascendente: cada antena não visitada procura um predecessor na fronteira.
+ */
+static void expandirAscendente(ContextoLargura *contexto)
+{
+    const GrafoCompacto *grafo = (*contexto).grafo;
+    uint32_t contagem = 0;
+    uint64_t arestas = 0;
+
+    while (true)
+    {
+        uint32_t inicio = atomic_fetch_add_explicit(&(*contexto).proximoBloco, PP_BLOCO, memory_order_relaxed);
+        if (inicio >= (*grafo).numVertices) break;
+        uint32_t fim = (inicio + PP_BLOCO < (*grafo).numVertices) ? inicio + PP_BLOCO : (*grafo).numVertices;
+
+        for (uint32_t vertice = inicio; vertice < fim; vertice++)
+        {
+            uint64_t mascara = 1ULL << (vertice & 63);
+
+            // Cada antena só é tratada por uma thread (a dona do bloco)
+            if (atomic_load_explicit(&(*contexto).visitadas[vertice >> 6], memory_order_relaxed) & mascara) continue;
+
+            for (uint32_t a = (*grafo).inicioArestasEntrada[vertice]; a < (*grafo).inicioArestasEntrada[vertice + 1]; a++)
+            {
+                uint32_t origem = (*grafo).origens[a];
+
+                if (atomic_load_explicit(&(*contexto).fronteiraBits[origem >> 6], memory_order_relaxed) & (1ULL << (origem & 63)))
+                {
+                    (*contexto).distancias[vertice] = (*contexto).nivel + 1;
+                    atomic_fetch_or_explicit(&(*contexto).visitadas[vertice >> 6], mascara, memory_order_relaxed);
+                    atomic_fetch_or_explicit(&(*contexto).proximaBits[vertice >> 6], mascara, memory_order_relaxed);
+                    arestas += grauSaida(grafo, vertice);
+                    contagem++;
+                    break;
+                }
+            }
+        }
+    }
+
+    atomic_fetch_add_explicit(&(*contexto).contagemProxima, contagem, memory_order_relaxed);
+    atomic_fetch_add_explicit(&(*contexto).arestasProxima, arestas, memory_order_relaxed);
+}
+
+/**
+ * @brief Passo sequencial entre níveis: troca as fronteiras e escolhe a direção do próximo nível.
+ */
+static void avancarNivel(ContextoLargura *contexto)
+{
+    const GrafoCompacto *grafo = (*contexto).grafo;
+    uint32_t numProxima;
+
+    if (!(*contexto).ascendente)
+    {
+        numProxima = atomic_load(&(*contexto).numProxima);
+        uint32_t *temp = (*contexto).fronteira;
+        (*contexto).fronteira = (*contexto).proxima;
+        (*contexto).proxima = temp;
+        (*contexto).numFronteira = numProxima;
+        atomic_store(&(*contexto).numProxima, 0);
+    }
+    else
+    {
+        numProxima = atomic_load(&(*contexto).contagemProxima);
+        _Atomic uint64_t *temp = (*contexto).fronteiraBits;
+        (*contexto).fronteiraBits = (*contexto).proximaBits;
+        (*contexto).proximaBits = temp;
+        memset((void *)(*contexto).proximaBits, 0, (*contexto).numPalavras * sizeof(uint64_t));
+        atomic_store(&(*contexto).contagemProxima, 0);
+    }
+
+    uint64_t arestasFronteira = atomic_exchange(&(*contexto).arestasProxima, 0);
+    (*contexto).arestasPorVisitar -= arestasFronteira;
+    (*contexto).estatisticas.numAlcancadas += numProxima;
+    (*contexto).nivel++;
+    atomic_store(&(*contexto).proximoBloco, 0);
+
+    if (numProxima == 0)
+    {
+        (*contexto).terminado = true;
+        return;
+    }
+
+    (*contexto).estatisticas.numNiveis++;
+
+    // Descendente -> ascendente: a fronteira tem muitas arestas face às que faltam visitar
+    if (!(*contexto).ascendente && (*grafo).inicioArestasEntrada != NULL && arestasFronteira > (*contexto).arestasPorVisitar / PP_ALFA)
+    {
+        memset((void *)(*contexto).fronteiraBits, 0, (*contexto).numPalavras * sizeof(uint64_t));
+        for (uint32_t i = 0; i < (*contexto).numFronteira; i++)
+        {
+            uint32_t vertice = (*contexto).fronteira[i];
+            atomic_fetch_or_explicit(&(*contexto).fronteiraBits[vertice >> 6], 1ULL << (vertice & 63), memory_order_relaxed);
+        }
+        (*contexto).ascendente = true;
+    }
+    // Ascendente -> descendente: a fronteira voltou a ser pequena
+    else if ((*contexto).ascendente && numProxima < (*grafo).numVertices / PP_BETA)
+    {
+        (*contexto).numFronteira = 0;
+        for (size_t p = 0; p < (*contexto).numPalavras; p++)
+        {
+            uint64_t palavra = atomic_load_explicit(&(*contexto).fronteiraBits[p], memory_order_relaxed);
+            for (; palavra != 0; palavra &= palavra - 1)
+            {
+                (*contexto).fronteira[(*contexto).numFronteira++] = (uint32_t)(p * 64 + __builtin_ctzll(palavra));
+            }
+        }
+        (*contexto).ascendente = false;
+    }
+
+    if ((*contexto).ascendente) (*contexto).estatisticas.niveisAscendentes++;
+}
+
+/**
+ * @brief Ciclo de cada thread: expande um nível, espera pelas restantes, e a thread 0 avança o nível.
+ */
+static void *trabalhadorLargura(void *argumento)
+{
+    ContextoLargura *contexto = argumento;
+
+    // Espera que todas as threads tenham sido criadas (a barreira depende do número final)
+    pthread_mutex_lock(&(*contexto).trincoArranque);
+    while (!(*contexto).pronto) pthread_cond_wait(&(*contexto).condicaoArranque, &(*contexto).trincoArranque);
+    pthread_mutex_unlock(&(*contexto).trincoArranque);
+
+    while (true)
+    {
+        pthread_barrier_wait(&(*contexto).barreira);
+        if ((*contexto).terminado) break;
+
+        if ((*contexto).ascendente) expandirAscendente(contexto);
+        else expandirDescendente(contexto);
+
+        // A thread que chamou "PP_procurarLarguraParalela" faz o passo sequencial; as outras esperam por ele na barreira seguinte
+        pthread_barrier_wait(&(*contexto).barreira);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Cria as threads auxiliares, expande os níveis com todas elas e espera que terminem.
+ *
+ * A thread atual é a n.º 0 e faz o passo sequencial entre níveis.
+ */
+static void executarThreads(ContextoLargura *contexto, pthread_t *threads, int numThreads)
+{
+    pthread_mutex_init(&(*contexto).trincoArranque, NULL);
+    pthread_cond_init(&(*contexto).condicaoArranque, NULL);
+
+    int numAuxiliares = 0;
+    while (numAuxiliares < numThreads - 1 && pthread_create(&threads[numAuxiliares], NULL, trabalhadorLargura, contexto) == 0) numAuxiliares++;
+
+    (*contexto).estatisticas.numThreads = numAuxiliares + 1;
+    pthread_barrier_init(&(*contexto).barreira, NULL, numAuxiliares + 1);
+
+    pthread_mutex_lock(&(*contexto).trincoArranque);
+    (*contexto).pronto = true;
+    pthread_cond_broadcast(&(*contexto).condicaoArranque);
+    pthread_mutex_unlock(&(*contexto).trincoArranque);
+
+    // Ciclo da thread 0 (igual ao de "trabalhadorLargura", mais o passo sequencial)
+    while (true)
+    {
+        pthread_barrier_wait(&(*contexto).barreira);
+        if ((*contexto).terminado) break;
+
+        if ((*contexto).ascendente) expandirAscendente(contexto);
+        else expandirDescendente(contexto);
+
+        pthread_barrier_wait(&(*contexto).barreira);
+        avancarNivel(contexto);
+    }
+
+    for (int i = 0; i < numAuxiliares; i++) pthread_join(threads[i], NULL);
+
+    pthread_barrier_destroy(&(*contexto).barreira);
+    pthread_mutex_destroy(&(*contexto).trincoArranque);
+    pthread_cond_destroy(&(*contexto).condicaoArranque);
+}
+
+/**
+ * @brief Procura em largura sequencial, com uma fila simples (usada nos grafos com poucas arestas).
+ *
+ * As distâncias já atribuídas marcam as antenas visitadas, pelo que só é preciso alocar a fila.
+ */
+static int procurarLarguraSequencial(const GrafoCompacto *grafo, uint32_t inicio, int32_t *distancias, EstatisticasLargura *estatisticas)
+{
+    uint32_t *fila = malloc((*grafo).numVertices * sizeof(uint32_t));
+
+    // Verifica se foi possível alocar a memória
+    if (fila == NULL) return GC_ERRO_ALOCACAO_MEMORIA;
+
+    for (uint32_t v = 0; v < (*grafo).numVertices; v++) distancias[v] = -1;
+    distancias[inicio] = 0;
+    fila[0] = inicio;
+    uint32_t numFila = 1;
+
+    for (uint32_t i = 0; i < numFila; i++)
+    {
+        uint32_t vertice = fila[i];
+
+        for (uint32_t a = (*grafo).inicioArestas[vertice]; a < (*grafo).inicioArestas[vertice + 1]; a++)
+        {
+            uint32_t destino = (*grafo).destinos[a];
+            if (distancias[destino] >= 0) continue;
+
+            distancias[destino] = distancias[vertice] + 1;
+            fila[numFila++] = destino;
+        }
+    }
+
+    if (estatisticas != NULL) *estatisticas = (EstatisticasLargura){ (int)numFila, distancias[fila[numFila - 1]] + 1, 0, 1 };
+    free(fila);
+
+    return (int)numFila;
+}
+
+/**
+ * @brief Procura em largura paralela, por níveis, a partir de uma antena do grafo compacto.
+ *
+ * Cada nível é expandido por todas as threads. A expansão é descendente (cada antena da fronteira
+ * reclama os vizinhos com um "fetch_or" atómico no mapa de bits das visitadas) enquanto a fronteira é
+ * pequena, e ascendente (cada antena não visitada procura um predecessor na fronteira, parando no
+ * primeiro) quando as arestas da fronteira dominam, como nos cliques de frequência criados por
+ * "interligarAntenas".
+ *
+ * Os grafos com menos de PP_LIMIAR_SEQUENCIAL arestas são percorridos com uma fila simples, e o número de
+ * threads é limitado ao número de processadores e a uma thread por PP_ARESTAS_POR_THREAD arestas: criar
+ * as threads e sincronizar cada nível custa mais do que a procura num grafo pequeno. Com uma só thread a
+ * procura por níveis é feita na thread atual, sem barreira.
+ *
+ * @param grafo Apontador para o grafo compacto (a expansão ascendente só é usada se existirem as
+ *              arestas de entrada, ver "GC_criarArestasEntrada").
+ * @param inicio Identificador da antena de partida.
+ * @param distancias Vetor com "numVertices" posições que recebe a distância (em arestas) de cada antena, ou -1.
+ * @param numThreads Número máximo de threads (<= 0 usa o número de processadores).
+ * @param estatisticas Apontador para o resumo da procura (pode ser NULL).
+ *
+ * @return Número de antenas alcançadas (incluindo a de partida).
+ * @return "GC_ERRO_GRAFO_PONTEIRO_INVALIDO" se o grafo ou o vetor forem inválidos.
+ * @return "GC_ERRO_ANTENA_INICIO_INVALIDA" se a antena de partida não existir.
+ * @return "GC_ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int PP_procurarLarguraParalela(const GrafoCompacto *grafo, uint32_t inicio, int32_t *distancias, int numThreads, EstatisticasLargura *estatisticas)
+{
+    // Verifica se os parâmetros são válidos
+    if (grafo == NULL || distancias == NULL) return GC_ERRO_GRAFO_PONTEIRO_INVALIDO;
+    if (inicio >= (*grafo).numVertices) return GC_ERRO_ANTENA_INICIO_INVALIDA;
+    if ((*grafo).numArestas < PP_LIMIAR_SEQUENCIAL) return procurarLarguraSequencial(grafo, inicio, distancias, estatisticas);
+
+    int maximoThreads = PP_numeroProcessadores();
+    uint32_t threadsArestas = (*grafo).numArestas / PP_ARESTAS_POR_THREAD;
+    if (numThreads <= 0 || numThreads > maximoThreads) numThreads = maximoThreads;
+    if ((uint32_t)numThreads > threadsArestas) numThreads = (threadsArestas > 0) ? (int)threadsArestas : 1;
+
+    ContextoLargura contexto;
+    memset(&contexto, 0, sizeof(contexto));
+
+    contexto.grafo = grafo;
+    contexto.distancias = distancias;
+    contexto.numPalavras = ((size_t)(*grafo).numVertices + 63) / 64;
+    contexto.visitadas = calloc(contexto.numPalavras, sizeof(uint64_t));
+    contexto.fronteiraBits = calloc(contexto.numPalavras, sizeof(uint64_t));
+    contexto.proximaBits = calloc(contexto.numPalavras, sizeof(uint64_t));
+    contexto.fronteira = malloc((*grafo).numVertices * sizeof(uint32_t));
+    contexto.proxima = malloc((*grafo).numVertices * sizeof(uint32_t));
+    pthread_t *threads = malloc(numThreads * sizeof(pthread_t));
+
+    // Verifica se foi possível alocar a memória
+    if (contexto.visitadas == NULL || contexto.fronteiraBits == NULL || contexto.proximaBits == NULL
+      || contexto.fronteira == NULL || contexto.proxima == NULL || threads == NULL)
+    {
+        free((void *)contexto.visitadas);
+        free((void *)contexto.fronteiraBits);
+        free((void *)contexto.proximaBits);
+        free(contexto.fronteira);
+        free(contexto.proxima);
+        free(threads);
+        return GC_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    // Nível 0: apenas a antena de partida
+    for (uint32_t v = 0; v < (*grafo).numVertices; v++) distancias[v] = -1;
+    distancias[inicio] = 0;
+    contexto.visitadas[inicio >> 6] = 1ULL << (inicio & 63);
+    contexto.fronteira[0] = inicio;
+    contexto.numFronteira = 1;
+    contexto.arestasPorVisitar = (*grafo).numArestas - grauSaida(grafo, inicio);
+    contexto.estatisticas.numAlcancadas = 1;
+    contexto.estatisticas.numNiveis = 1;
+    contexto.estatisticas.numThreads = 1;
+
+    // Uma só thread: os níveis são expandidos na thread atual, sem barreira
+    if (numThreads == 1)
+    {
+        while (!contexto.terminado)
+        {
+            if (contexto.ascendente) expandirAscendente(&contexto);
+            else expandirDescendente(&contexto);
+
+            avancarNivel(&contexto);
+        }
+    }
+    else
+    {
+        executarThreads(&contexto, threads, numThreads);
+    }
+
+    if (estatisticas != NULL) *estatisticas = contexto.estatisticas;
+
+    free((void *)contexto.visitadas);
+    free((void *)contexto.fronteiraBits);
+    free((void *)contexto.proximaBits);
+    free(contexto.fronteira);
+    free(contexto.proxima);
+    free(threads);
+
+    return contexto.estatisticas.numAlcancadas;
+}
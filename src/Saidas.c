@@ -0,0 +1,393 @@
+/**
+ * @file Saidas.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação dos destinos (saídas) dos resultados das consultas
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Saidas.h"
+
+/**
+ * @def TAMANHO_BUFFER_TERMINAL
+ * @brief Tamanho do buffer das saídas para o terminal (despejado no fim de cada resultado).
+ */
+#define TAMANHO_BUFFER_TERMINAL 256
+
+/**
+ * @brief Aloca uma saída do tipo indicado (e inicializa as variáveis).
+ */
+static Saida *criarSaida(TipoSaida tipo)
+{
+    Saida *saida = calloc(1, sizeof(Saida));
+
+    // Verifica se foi possível alocar a memória
+    if (saida == NULL) return NULL;
+
+    (*saida).tipo = tipo;
+
+    return saida;
+}
+
+/**
+ * @brief Cria uma saída para o terminal ("stdout").
+ *
+ * @return Apontador para a saída criada.
+ * @return NULL se a alocação falhar.
+ */
+Saida *criarSaidaTerminal()
+{
+    Saida *saida = criarSaida(SAIDA_TERMINAL);
+
+    // Verifica se foi possível alocar a memória
+    if (saida == NULL) return NULL;
+
+    (*saida).ficheiro = stdout;
+    (*saida).tamanhoBuffer = TAMANHO_BUFFER_TERMINAL;
+    (*saida).buffer = malloc(TAMANHO_BUFFER_TERMINAL);
+
+    if ((*saida).buffer == NULL)
+    {
+        free(saida);
+        return NULL;
+    }
+
+    return saida;
+}
+
+/**
+ * @brief Cria uma saída que chama uma função para cada resultado.
+ *
+ * @param funcao Função chamada para cada resultado.
+ * @param contexto Apontador passado à função.
+ *
+ * @return Apontador para a saída criada.
+ * @return NULL se a função for inválida ou a alocação falhar.
+ */
+Saida *criarSaidaFuncao(FuncaoResultado funcao, void *contexto)
+{
+    // Verifica se o apontador é válido
+    if (funcao == NULL) return NULL;
+
+    Saida *saida = criarSaida(SAIDA_FUNCAO);
+
+    // Verifica se foi possível alocar a memória
+    if (saida == NULL) return NULL;
+
+    (*saida).funcao = funcao;
+    (*saida).contexto = contexto;
+
+    return saida;
+}
+
+/**
+ * @brief Cria uma saída que guarda os resultados num vetor ("resultados", com "numResultados" elementos).
+ *
+ * @return Apontador para a saída criada.
+ * @return NULL se a alocação falhar.
+ */
+Saida *criarSaidaVetor()
+{
+    return criarSaida(SAIDA_VETOR);
+}
+
+/**
+ * @brief Cria uma saída de texto para um ficheiro, com um buffer próprio.
+ *
+ * @param ficheiro Ficheiro aberto para escrita (não é fechado por "libertarSaida").
+ * @param tamanhoBuffer Tamanho do buffer (0 usa "TAMANHO_BUFFER_SAIDA").
+ *
+ * @return Apontador para a saída criada.
+ * @return NULL se o ficheiro for inválido ou a alocação falhar.
+ */
+Saida *criarSaidaFicheiro(FILE *ficheiro, size_t tamanhoBuffer)
+{
+    // Verifica se o apontador é válido
+    if (ficheiro == NULL) return NULL;
+
+    Saida *saida = criarSaida(SAIDA_FICHEIRO);
+
+    // Verifica se foi possível alocar a memória
+    if (saida == NULL) return NULL;
+
+    (*saida).ficheiro = ficheiro;
+    (*saida).tamanhoBuffer = (tamanhoBuffer > 0) ? tamanhoBuffer : TAMANHO_BUFFER_SAIDA;
+    (*saida).buffer = malloc((*saida).tamanhoBuffer);
+
+    if ((*saida).buffer == NULL)
+    {
+        free(saida);
+        return NULL;
+    }
+
+    return saida;
+}
+
+/**
+ * @brief Despeja o buffer da saída (se tiver) e liberta-a.
+ *
+ * @param saida Apontador para a saída (pode ser NULL).
+ *
+ * @return NULL para indicar que a saída foi libertada com sucesso.
+ */
+Saida *libertarSaida(Saida *saida)
+{
+    // Verifica se o apontador é válido
+    if (saida == NULL) return NULL;
+
+    despejarSaida(saida);
+
+    free((*saida).resultados);
+    free((*saida).antenasCaminhos);
+    free((*saida).buffer);
+    free(saida);
+
+    return NULL;
+}
+
+/**
+ * @brief Escreve o conteúdo do buffer no ficheiro da saída.
+ *
+ * @param saida Apontador para a saída.
+ *
+ * @return 0 em caso de sucesso (ou se a saída não tiver buffer).
+ * @return "SAIDA_ERRO_PONTEIRO_INVALIDO" se a saída for inválida.
+ * @return "SAIDA_ERRO_ESCRITA" se não for possível escrever no ficheiro.
+ */
+int despejarSaida(Saida *saida)
+{
+    // Verifica se o apontador é válido
+    if (saida == NULL) return SAIDA_ERRO_PONTEIRO_INVALIDO;
+
+    if ((*saida).usado == 0) return 0;
+
+    size_t usado = (*saida).usado;
+    size_t escritos = fwrite((*saida).buffer, 1, usado, (*saida).ficheiro);
+    (*saida).usado = 0;
+
+    return (escritos == usado) ? 0 : SAIDA_ERRO_ESCRITA;
+}
+
+/**
+ * @brief Acrescenta texto ao buffer da saída, despejando-o quando enche.
+ */
+static int acrescentarTexto(Saida *saida, const char *texto, size_t tamanho)
+{
+    while (tamanho > 0)
+    {
+        if ((*saida).usado == (*saida).tamanhoBuffer)
+        {
+            int erro = despejarSaida(saida);
+            if (erro < 0) return erro;
+        }
+
+        size_t parte = (*saida).tamanhoBuffer - (*saida).usado;
+        if (parte > tamanho) parte = tamanho;
+
+        memcpy((*saida).buffer + (*saida).usado, texto, parte);
+        (*saida).usado += parte;
+        texto += parte;
+        tamanho -= parte;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Acrescenta uma antena ("'A'(x, y)") seguida de "separador" ao buffer da saída.
+ */
+static int acrescentarAntena(Saida *saida, const RegistoAntena *antena, const char *separador)
+{
+    char texto[64];
+    int tamanho = snprintf(texto, sizeof(texto), "'%c'(%d, %d)%s", (*antena).frequencia, (*antena).x, (*antena).y, separador);
+
+    return acrescentarTexto(saida, texto, (size_t)tamanho);
+}
+
+/**
+ * @brief Formata um resultado como texto (o mesmo formato que as consultas usavam no terminal).
+ */
+static int formatarResultado(Saida *saida, const Resultado *resultado)
+{
+    char texto[64];
+    int tamanho, erro = 0;
+
+    switch ((*resultado).tipo)
+    {
+        case RESULTADO_ANTENA:
+            return acrescentarAntena(saida, &(*resultado).antena, "\n");
+
+        case RESULTADO_ARESTA:
+            erro = acrescentarAntena(saida, &(*resultado).antena, " -> ");
+            return (erro < 0) ? erro : acrescentarAntena(saida, &(*resultado).outra, "\n");
+
+        case RESULTADO_CAMINHO:
+            for (int i = 0; i < (*resultado).tamanho && erro == 0; i++)
+            {
+                erro = acrescentarAntena(saida, &(*resultado).caminho[i], (i == (*resultado).tamanho - 1) ? "\n" : " -> ");
+            }
+            return erro;
+
+        case RESULTADO_INTERSECAO:
+            erro = acrescentarAntena(saida, &(*resultado).antena, " -x- ");
+            if (erro == 0) erro = acrescentarAntena(saida, &(*resultado).outra, "");
+            if (erro < 0) return erro;
+            tamanho = snprintf(texto, sizeof(texto), " > (%d, %d)\n", (*resultado).x, (*resultado).y);
+            return acrescentarTexto(saida, texto, (size_t)tamanho);
+
+        case RESULTADO_NEFASTO:
+            tamanho = snprintf(texto, sizeof(texto), "(%d, %d)\n", (*resultado).x, (*resultado).y);
+            return acrescentarTexto(saida, texto, (size_t)tamanho);
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Guarda uma cópia do resultado no vetor da saída (e do caminho, se for o caso).
+ */
+static int guardarResultado(Saida *saida, const Resultado *resultado)
+{
+    if ((*saida).numResultados == (*saida).capacidadeResultados)
+    {
+        int capacidade = ((*saida).capacidadeResultados > 0) ? (*saida).capacidadeResultados * 2 : 64;
+        Resultado *novos = realloc((*saida).resultados, (size_t)capacidade * sizeof(Resultado));
+
+        // Verifica se foi possível alocar a memória
+        if (novos == NULL) return SAIDA_ERRO_ALOCACAO_MEMORIA;
+
+        (*saida).resultados = novos;
+        (*saida).capacidadeResultados = capacidade;
+    }
+
+    Resultado *copia = &(*saida).resultados[(*saida).numResultados];
+    *copia = *resultado;
+
+    if ((*resultado).tipo == RESULTADO_CAMINHO)
+    {
+        if ((*saida).numAntenasCaminhos + (*resultado).tamanho > (*saida).capacidadeCaminhos)
+        {
+            int capacidade = ((*saida).capacidadeCaminhos > 0) ? (*saida).capacidadeCaminhos : 256;
+            while (capacidade < (*saida).numAntenasCaminhos + (*resultado).tamanho) capacidade *= 2;
+
+            RegistoAntena *novas = realloc((*saida).antenasCaminhos, (size_t)capacidade * sizeof(RegistoAntena));
+
+            // Verifica se foi possível alocar a memória
+            if (novas == NULL) return SAIDA_ERRO_ALOCACAO_MEMORIA;
+
+            (*saida).antenasCaminhos = novas;
+            (*saida).capacidadeCaminhos = capacidade;
+        }
+
+        // Guarda a posição da cópia (os caminhos já guardados não dependem da localização do vetor)
+        memcpy(&(*saida).antenasCaminhos[(*saida).numAntenasCaminhos], (*resultado).caminho, (size_t)(*resultado).tamanho * sizeof(RegistoAntena));
+        (*copia).caminho = NULL;
+        (*copia).inicioCaminho = (*saida).numAntenasCaminhos;
+        (*saida).numAntenasCaminhos += (*resultado).tamanho;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Envia um resultado para a saída.
+ *
+ * @param saida Apontador para a saída (NULL escreve no terminal).
+ * @param resultado Apontador para o resultado.
+ *
+ * @return 0 em caso de sucesso.
+ * @return Valor negativo devolvido pela função de uma saída "SAIDA_FUNCAO" (a consulta deve parar).
+ * @return "SAIDA_ERRO_PONTEIRO_INVALIDO" se o resultado for inválido.
+ * @return "SAIDA_ERRO_ESCRITA" ou "SAIDA_ERRO_ALOCACAO_MEMORIA" em caso de erro.
+ */
+int escreverResultado(Saida *saida, const Resultado *resultado)
+{
+    // Verifica se o apontador é válido
+    if (resultado == NULL) return SAIDA_ERRO_PONTEIRO_INVALIDO;
+
+    // Sem saída, usa uma saída para o terminal temporária
+    char bufferTerminal[TAMANHO_BUFFER_TERMINAL];
+    Saida terminal = { .tipo = SAIDA_TERMINAL, .ficheiro = stdout, .buffer = bufferTerminal, .tamanhoBuffer = sizeof(bufferTerminal) };
+
+    if (saida == NULL) saida = &terminal;
+
+    int erro = 0;
+
+    switch ((*saida).tipo)
+    {
+        case SAIDA_FUNCAO:
+            erro = (*saida).funcao(resultado, (*saida).contexto);
+            break;
+
+        case SAIDA_VETOR:
+            erro = guardarResultado(saida, resultado);
+            break;
+
+        case SAIDA_TERMINAL:
+            erro = formatarResultado(saida, resultado);
+            if (erro == 0) erro = despejarSaida(saida);
+            break;
+
+        case SAIDA_FICHEIRO:
+            erro = formatarResultado(saida, resultado);
+            break;
+    }
+
+    if (erro == 0) (*saida).numResultados++;
+
+    return erro;
+}
+
+/**
+ * @brief Lê um resultado guardado numa saída para vetor.
+ *
+ * @param saida Apontador para a saída (do tipo "SAIDA_VETOR").
+ * @param indice Posição do resultado (0 a "numResultados" - 1).
+ * @param resultado Recebe o resultado; nos caminhos, "caminho" aponta para a cópia guardada na saída
+ *        (válido até ao próximo resultado escrito ou até a saída ser libertada).
+ *
+ * @return 0 em caso de sucesso.
+ * @return "SAIDA_ERRO_PONTEIRO_INVALIDO" se a saída, o índice ou o resultado forem inválidos.
+ */
+int lerResultado(const Saida *saida, int indice, Resultado *resultado)
+{
+    // Verifica se os apontadores são válidos
+    if (saida == NULL || resultado == NULL || (*saida).tipo != SAIDA_VETOR || indice < 0 || indice >= (*saida).numResultados) return SAIDA_ERRO_PONTEIRO_INVALIDO;
+
+    *resultado = (*saida).resultados[indice];
+    if ((*resultado).tipo == RESULTADO_CAMINHO) (*resultado).caminho = &(*saida).antenasCaminhos[(*resultado).inicioCaminho];
+
+    return 0;
+}
+
+/**
+ * @brief Envia uma antena para a saída (ver "escreverResultado").
+ */
+int escreverAntena(Saida *saida, char frequencia, int x, int y)
+{
+    Resultado resultado = { .tipo = RESULTADO_ANTENA, .antena = { frequencia, x, y } };
+
+    return escreverResultado(saida, &resultado);
+}
+
+/**
+ * @brief Envia uma aresta para a saída (ver "escreverResultado").
+ */
+int escreverAresta(Saida *saida, char frequencia1, int x1, int y1, char frequencia2, int x2, int y2)
+{
+    Resultado resultado = { .tipo = RESULTADO_ARESTA, .antena = { frequencia1, x1, y1 }, .outra = { frequencia2, x2, y2 } };
+
+    return escreverResultado(saida, &resultado);
+}
+
+/**
+ * @brief Envia um efeito nefasto para a saída (ver "escreverResultado").
+ */
+int escreverNefasto(Saida *saida, int x, int y)
+{
+    Resultado resultado = { .tipo = RESULTADO_NEFASTO, .x = x, .y = y };
+
+    return escreverResultado(saida, &resultado);
+}
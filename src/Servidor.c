@@ -0,0 +1,995 @@
+/**
+ * @file Servidor.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação do servidor de consultas sobre a cidade e a rede (socket UNIX e trabalhadores)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Servidor.h"
+
+#include <errno.h>
+#include <signal.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+
+// Valor devolvido por "escreverCaminho" para interromper a procura (distinto dos códigos de erro)
+#define LIMITE_CAMINHOS_ATINGIDO -1000
+
+// Servidor a terminar quando for recebido SIGINT/SIGTERM (ver "iniciarServidor")
+static Servidor *servidorSinais = NULL;
+
+/**
+ * @brief Devolve a mensagem associada a um código de erro, para as respostas "ERRO".
+ */
+static const char *mensagemErro(int erro)
+{
+    switch (erro)
+    {
+        case ERRO_CIDADE_PONTEIRO_INVALIDO: return "Cidade inválida";
+        case ERRO_ANTENA_INICIO_INVALIDA: return "Antena origem inválida";
+        case ERRO_ANTENA_DESTINO_INVALIDA: return "Antena destino inválida";
+        case ERRO_ANTENA_JA_EXISTE: return "Já existe a antena"; /* LL_ERRO_ANTENA_JA_EXISTE */
+        case ERRO_ANTENA_NAO_EXISTE: return "Não existe a antena"; /* LL_ERRO_ANTENA_NAO_EXISTE */
+        case SERVIDOR_ERRO_PEDIDO_INVALIDO: return "Pedido inválido";
+        case ERRO_ALOCACAO_MEMORIA: return "Não foi possível alocar memória"; /* SERVIDOR_ERRO_ALOCACAO_MEMORIA */
+        default: return "Erro desconhecido";
+    }
+}
+
+/**
+ * @brief Escreve uma antena da versão ("f x y").
+ */
+static void escreverAntenaVersao(FILE *saida, const GrafoCompacto *grafo, uint32_t vertice)
+{
+    fprintf(saida, "%c %d %d\n", (*grafo).frequencias[vertice], GC_coordenadaX(grafo, vertice), GC_coordenadaY(grafo, vertice));
+}
+
+/**
+ * @brief Contexto de escrita dos caminhos ("CAMINHOS").
+ */
+typedef struct EscritaCaminhos
+{
+    FILE *saida;
+    const GrafoCompacto *grafo;
+    int restantes;
+
+} EscritaCaminhos;
+
+/**
+ * @brief Escreve um caminho ("x,y x,y ...") e interrompe a procura ao atingir o limite.
+ */
+static int escreverCaminho(const uint32_t *caminho, int tamanho, void *contexto)
+{
+    EscritaCaminhos *escrita = contexto;
+
+    for (int i = 0; i < tamanho; i++)
+    {
+        fprintf((*escrita).saida, "%d,%d%c", GC_coordenadaX((*escrita).grafo, caminho[i]), GC_coordenadaY((*escrita).grafo, caminho[i]), (i == tamanho - 1) ? '\n' : ' ');
+    }
+
+    return (--(*escrita).restantes > 0) ? 0 : LIMITE_CAMINHOS_ATINGIDO;
+}
+
+/**
+ * @brief Escreve um ponto de interseção da versão ("x y").
+ */
+static int escreverIntersecao(uint32_t antena1, uint32_t antena2, int x, int y, void *contexto)
+{
+    (void)antena1;
+    (void)antena2;
+    fprintf((FILE *)contexto, "%d %d\n", x, y);
+
+    return 0;
+}
+
+/**
+ * @brief Responde a um pedido de percurso (LARGURA/PROFUNDIDADE) sobre a versão atual da cidade.
+ */
+static int responderPercurso(Servidor *servidor, int x, int y, bool largura, FILE *saida)
+{
+    Versao *versao = adquirirVersao((*servidor).publicador);
+    const GrafoCompacto *grafo = (*versao).grafo;
+    uint32_t inicio = GC_procurarAntena(grafo, x, y);
+    int resultado = ERRO_ANTENA_INICIO_INVALIDA;
+
+    if (inicio != GC_SEM_VERTICE)
+    {
+        uint32_t *ordem = malloc((*grafo).numVertices * sizeof(uint32_t));
+
+        if (ordem == NULL) resultado = SERVIDOR_ERRO_ALOCACAO_MEMORIA;
+        else
+        {
+            resultado = largura ? GC_procurarLargura(grafo, inicio, ordem) : GC_procurarProfundidade(grafo, inicio, ordem);
+            for (int i = 0; i < resultado; i++) escreverAntenaVersao(saida, grafo, ordem[i]);
+            free(ordem);
+        }
+    }
+
+    libertarVersao(versao);
+
+    return resultado;
+}
+
+/**
+ * @brief Responde a um pedido de distâncias (DISTANCIAS) sobre a versão atual da cidade.
+ *
+ * @note A versão publicada já tem as arestas de entrada, pelo que a procura pode usar a expansão ascendente.
+ *       Os processadores são repartidos pelos trabalhadores (pelo menos uma thread por pedido).
+ */
+static int responderDistancias(Servidor *servidor, int x, int y, FILE *saida)
+{
+    Versao *versao = adquirirVersao((*servidor).publicador);
+    const GrafoCompacto *grafo = (*versao).grafo;
+    uint32_t inicio = GC_procurarAntena(grafo, x, y);
+    int resultado = ERRO_ANTENA_INICIO_INVALIDA;
+
+    if (inicio != GC_SEM_VERTICE)
+    {
+        int32_t *distancias = malloc((*grafo).numVertices * sizeof(int32_t));
+        int numThreads = PP_numeroProcessadores() / (*servidor).numTrabalhadores;
+
+        if (distancias == NULL) resultado = SERVIDOR_ERRO_ALOCACAO_MEMORIA;
+        else
+        {
+            resultado = PP_procurarLarguraParalela(grafo, inicio, distancias, (numThreads > 0) ? numThreads : 1, NULL);
+            for (uint32_t v = 0; resultado >= 0 && v < (*grafo).numVertices; v++)
+            {
+                if (distancias[v] >= 0) fprintf(saida, "%c %d %d %d\n", (*grafo).frequencias[v], GC_coordenadaX(grafo, v), GC_coordenadaY(grafo, v), distancias[v]);
+            }
+            free(distancias);
+        }
+    }
+
+    libertarVersao(versao);
+
+    return resultado;
+}
+
+/**
+ * @brief Responde a um pedido de componentes (COMPONENTES) sobre a versão atual da cidade.
+ */
+static int responderComponentes(Servidor *servidor, int maximo, FILE *saida)
+{
+    Versao *versao = adquirirVersao((*servidor).publicador);
+    const GrafoCompacto *grafo = (*versao).grafo;
+    int resultado;
+    Componentes *componentes = CC_calcularComponentes(grafo, &resultado);
+    uint32_t *ordem = (componentes != NULL) ? malloc(((*componentes).numComponentes > 0 ? (*componentes).numComponentes : 1) * sizeof(uint32_t)) : NULL;
+
+    if (componentes != NULL && ordem == NULL) resultado = SERVIDOR_ERRO_ALOCACAO_MEMORIA;
+    else if (componentes != NULL)
+    {
+        resultado = CC_ordenarComponentes(componentes, ordem);
+        if (resultado > maximo) resultado = maximo;
+
+        for (int i = 0; i < resultado; i++)
+        {
+            uint32_t c = ordem[i];
+            uint32_t representante = (*componentes).representante[c];
+
+            fprintf(saida, "%u %d %d", (*componentes).tamanho[c], GC_coordenadaX(grafo, representante), GC_coordenadaY(grafo, representante));
+            for (uint32_t f = (*componentes).inicioFrequencias[c]; f < (*componentes).inicioFrequencias[c + 1]; f++)
+            {
+                fprintf(saida, " %c:%u", (*componentes).frequencias[f].frequencia, (*componentes).frequencias[f].quantidade);
+            }
+            fprintf(saida, "\n");
+        }
+    }
+
+    free(ordem);
+    CC_libertarComponentes(componentes);
+    libertarVersao(versao);
+
+    return resultado;
+}
+
+/**
+ * @brief Responde a um pedido do protocolo (ver "Servidor.h"), escrevendo a resposta em "saida".
+ *
+ * @param servidor Apontador para o servidor.
+ * @param linha Pedido (sem ou com '\n' final).
+ * @param saida Ficheiro onde é escrita a resposta.
+ *
+ * @note Pode ser chamada por vários trabalhadores em simultâneo.
+ *
+ * @return 0 se a ligação deve continuar; 1 se o pedido foi "SAIR".
+ * @return "SERVIDOR_ERRO_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ */
+int responderPedido(Servidor *servidor, const char *linha, FILE *saida)
+{
+    // Verifica se os apontadores são válidos
+    if (servidor == NULL || linha == NULL || saida == NULL) return SERVIDOR_ERRO_PONTEIRO_INVALIDO;
+
+    char comando[16] = "";
+    int x1, y1, x2, y2, maximo, lidos, resultado = SERVIDOR_ERRO_PEDIDO_INVALIDO;
+    char frequencia1, frequencia2;
+
+    if (sscanf(linha, "%15s%n", comando, &lidos) != 1) comando[0] = '\0';
+    const char *argumentos = linha + ((comando[0] != '\0') ? lidos : 0);
+
+    if (strcmp(comando, "SAIR") == 0)
+    {
+        fprintf(saida, "OK 0\n");
+        return 1;
+    }
+    else if (strcmp(comando, "PROCURAR") == 0 && sscanf(argumentos, "%d %d", &x1, &y1) == 2)
+    {
+        Versao *versao = adquirirVersao((*servidor).publicador);
+        uint32_t vertice = GC_procurarAntena((*versao).grafo, x1, y1);
+
+        if (vertice == GC_SEM_VERTICE) resultado = ERRO_ANTENA_NAO_EXISTE;
+        else
+        {
+            escreverAntenaVersao(saida, (*versao).grafo, vertice);
+            resultado = 1;
+        }
+        libertarVersao(versao);
+    }
+    else if (strcmp(comando, "LARGURA") == 0 && sscanf(argumentos, "%d %d", &x1, &y1) == 2)
+    {
+        resultado = responderPercurso(servidor, x1, y1, true, saida);
+    }
+    else if (strcmp(comando, "PROFUNDIDADE") == 0 && sscanf(argumentos, "%d %d", &x1, &y1) == 2)
+    {
+        resultado = responderPercurso(servidor, x1, y1, false, saida);
+    }
+    else if (strcmp(comando, "DISTANCIAS") == 0 && sscanf(argumentos, "%d %d", &x1, &y1) == 2)
+    {
+        resultado = responderDistancias(servidor, x1, y1, saida);
+    }
+    else if (strcmp(comando, "CAMINHOS") == 0 && sscanf(argumentos, "%d %d %d %d", &x1, &y1, &x2, &y2) == 4)
+    {
+        if (sscanf(argumentos, "%*d %*d %*d %*d %d", &maximo) != 1 || maximo <= 0) maximo = SERVIDOR_MAX_CAMINHOS;
+
+        Versao *versao = adquirirVersao((*servidor).publicador);
+        EscritaCaminhos escrita = { saida, (*versao).grafo, maximo };
+
+        resultado = GC_procurarCaminhos((*versao).grafo, GC_procurarAntena((*versao).grafo, x1, y1), GC_procurarAntena((*versao).grafo, x2, y2), escreverCaminho, &escrita);
+        if (resultado == LIMITE_CAMINHOS_ATINGIDO) resultado = maximo;
+        libertarVersao(versao);
+    }
+    else if (strcmp(comando, "INTERSECOES") == 0 && sscanf(argumentos, " %c %c", &frequencia1, &frequencia2) == 2)
+    {
+        // A versão publicada tem o índice por frequência: não bloqueia com as edições
+        Versao *versao = adquirirVersao((*servidor).publicador);
+        resultado = GC_procurarIntersecoes((*versao).grafo, frequencia1, frequencia2, escreverIntersecao, saida);
+        libertarVersao(versao);
+    }
+    else if (strcmp(comando, "NEFASTOS") == 0)
+    {
+        // As posições são copiadas com o trinco e só são escritas depois (um cliente lento não bloqueia a rede)
+        int *posicoes = NULL;
+
+        pthread_mutex_lock(&(*servidor).trincoRede);
+        if (!(*servidor).nefastosAtualizados)
+        {
+            LL_libertarNefastos((*servidor).rede);
+            resultado = LL_calcularNefastosMapa((*servidor).rede);
+            (*servidor).nefastosAtualizados = (resultado == 0);
+        }
+        if ((*servidor).nefastosAtualizados)
+        {
+            resultado = (*(*servidor).rede).numNefastos;
+            posicoes = malloc(((size_t)resultado * 2 + 1) * sizeof(int));
+
+            // Verifica se foi possível alocar a memória
+            if (posicoes == NULL) resultado = SERVIDOR_ERRO_ALOCACAO_MEMORIA;
+            else
+            {
+                int i = 0;
+                for (Nefasto *nefastoAtual = (*(*servidor).rede).primeiroNefasto; nefastoAtual != NULL; nefastoAtual = (*nefastoAtual).prox)
+                {
+                    posicoes[i++] = (*nefastoAtual).x;
+                    posicoes[i++] = (*nefastoAtual).y;
+                }
+            }
+        }
+        pthread_mutex_unlock(&(*servidor).trincoRede);
+
+        for (int i = 0; i < resultado; i++) fprintf(saida, "%d %d\n", posicoes[2 * i], posicoes[2 * i + 1]);
+        free(posicoes);
+    }
+    else if (strcmp(comando, "COMPONENTES") == 0)
+    {
+        if (sscanf(argumentos, "%d", &maximo) != 1 || maximo <= 0) maximo = CC_NUM_COMPONENTES_APRESENTAR;
+        resultado = responderComponentes(servidor, maximo, saida);
+    }
+    else if (strcmp(comando, "INSERIR") == 0 && sscanf(argumentos, " %c %d %d", &frequencia1, &x1, &y1) == 3)
+    {
+        // A antena é inserida na cidade e na rede, ou em nenhuma (a inserção na cidade é desfeita se a da rede falhar)
+        Grafo *cidade = iniciarEdicao((*servidor).publicador);
+        frequencia2 = frequencia1;
+        resultado = adicionarAntenaOrdenada(cidade, &frequencia1, x1, y1);
+
+        if (resultado == 0)
+        {
+            pthread_mutex_lock(&(*servidor).trincoRede);
+            resultado = LL_adicionarAntenaOrdenada((*servidor).rede, &frequencia2, x1, y1);
+            if (resultado == 0) (*servidor).nefastosAtualizados = false;
+            pthread_mutex_unlock(&(*servidor).trincoRede);
+
+            if (resultado < 0) removerAntena(cidade, &frequencia1, x1, y1);
+        }
+
+        int erro = terminarEdicao((*servidor).publicador, resultado == 0);
+        if (resultado == 0) resultado = (erro < 0) ? erro : 1;
+    }
+    else if (strcmp(comando, "REMOVER") == 0 && sscanf(argumentos, "%d %d", &x1, &y1) == 2)
+    {
+        // A antena é removida da rede e da cidade, ou de nenhuma: a rede é editada primeiro porque a remoção
+        // na cidade (que também apaga as arestas da antena) não pode ser desfeita
+        Grafo *cidade = iniciarEdicao((*servidor).publicador);
+        resultado = 0;
+        procurarAntena(cidade, x1, y1, &resultado); /* "ERRO_ANTENA_NAO_EXISTE" se não existir */
+
+        if (resultado == 0)
+        {
+            pthread_mutex_lock(&(*servidor).trincoRede);
+            resultado = LL_removerAntena((*servidor).rede, &frequencia2, x1, y1);
+            if (resultado == 0) (*servidor).nefastosAtualizados = false;
+            pthread_mutex_unlock(&(*servidor).trincoRede);
+        }
+
+        if (resultado == 0) resultado = removerAntena(cidade, &frequencia1, x1, y1);
+
+        int erro = terminarEdicao((*servidor).publicador, resultado == 0);
+        if (resultado == 0)
+        {
+            fprintf(saida, "%c %d %d\n", frequencia1, x1, y1);
+            resultado = (erro < 0) ? erro : 1;
+        }
+    }
+
+    if (resultado >= 0) fprintf(saida, "OK %d\n", resultado);
+    else fprintf(saida, "ERRO %d %s\n", resultado, mensagemErro(resultado));
+
+    return 0;
+}
+
+/**
+ * @brief Ligações inativas à espera de pedidos (só usadas por "executarServidor").
+ *
+ * @note "descritores" tem mais duas posições do que "ligacoes": o socket do servidor e o "despertar".
+ */
+typedef struct EsperaLigacoes
+{
+    LigacaoServidor **ligacoes;
+    struct pollfd *descritores;
+    int numLigacoes;
+    int capacidade;
+
+} EsperaLigacoes;
+
+/**
+ * @brief Duplica a capacidade das ligações à espera (16 na primeira vez).
+ *
+ * @return true se foi possível alocar a memória.
+ */
+static bool aumentarEspera(EsperaLigacoes *espera)
+{
+    int capacidade = ((*espera).capacidade > 0) ? (*espera).capacidade * 2 : 16;
+    LigacaoServidor **ligacoes = realloc((*espera).ligacoes, capacidade * sizeof(LigacaoServidor *));
+    if (ligacoes != NULL) (*espera).ligacoes = ligacoes;
+
+    struct pollfd *descritores = realloc((*espera).descritores, ((size_t)capacidade + 2) * sizeof(struct pollfd));
+    if (descritores != NULL) (*espera).descritores = descritores;
+
+    // Verifica se foi possível alocar a memória
+    if (ligacoes == NULL || descritores == NULL) return false;
+
+    (*espera).capacidade = capacidade;
+
+    return true;
+}
+
+/**
+ * @brief Acrescenta uma ligação às ligações à espera de pedidos.
+ *
+ * @return true se a ligação foi acrescentada; false se não foi possível alocar a memória.
+ */
+static bool acrescentarEspera(EsperaLigacoes *espera, LigacaoServidor *ligacao)
+{
+    if ((*espera).numLigacoes == (*espera).capacidade && !aumentarEspera(espera)) return false;
+
+    (*espera).ligacoes[(*espera).numLigacoes++] = ligacao;
+
+    return true;
+}
+
+/**
+ * @brief Cria o estado de uma ligação aceite.
+ *
+ * @return Apontador para a ligação, ou NULL se não for possível alocar a memória (o descritor não é fechado).
+ */
+static LigacaoServidor *criarLigacao(int descritor)
+{
+    LigacaoServidor *ligacao = malloc(sizeof(LigacaoServidor));
+    int copia = (ligacao != NULL) ? dup(descritor) : -1;
+    FILE *saida = (copia >= 0) ? fdopen(copia, "w") : NULL;
+
+    // Verifica se foi possível alocar a memória
+    if (saida == NULL)
+    {
+        if (copia >= 0) close(copia);
+        free(ligacao);
+        return NULL;
+    }
+
+    (*ligacao).descritor = descritor;
+    (*ligacao).saida = saida;
+    (*ligacao).tamanho = 0;
+    (*ligacao).descartar = false;
+    (*ligacao).ultimaAtividade = time(NULL);
+    (*ligacao).prox = NULL;
+
+    return ligacao;
+}
+
+/**
+ * @brief Fecha uma ligação e liberta o seu estado.
+ */
+static void fecharLigacao(LigacaoServidor *ligacao)
+{
+    fclose((*ligacao).saida);
+    close((*ligacao).descritor);
+    free(ligacao);
+}
+
+/**
+ * @brief Acorda o "poll" de "executarServidor" (pode ser chamada num tratamento de sinal).
+ */
+static void despertarServidor(Servidor *servidor)
+{
+    char sinal = 1;
+
+    // Se o "despertar" estiver cheio, o "poll" já vai acordar
+    if (write((*servidor).despertar[1], &sinal, 1) < 0) return;
+}
+
+/**
+ * @brief Coloca uma ligação com pedidos na fila dos trabalhadores (espera se estiver cheia).
+ *
+ * @return true se a ligação foi colocada na fila; false se o servidor está a terminar.
+ */
+static bool entregarLigacao(Servidor *servidor, LigacaoServidor *ligacao)
+{
+    pthread_mutex_lock(&(*servidor).trincoFila);
+
+    while ((*servidor).numFila == SERVIDOR_CAPACIDADE_FILA && !atomic_load(&(*servidor).terminar))
+    {
+        pthread_cond_wait(&(*servidor).filaComEspaco, &(*servidor).trincoFila);
+    }
+
+    bool entregue = !atomic_load(&(*servidor).terminar);
+
+    if (entregue)
+    {
+        (*servidor).fila[((*servidor).inicioFila + (*servidor).numFila) % SERVIDOR_CAPACIDADE_FILA] = ligacao;
+        (*servidor).numFila++;
+        pthread_cond_signal(&(*servidor).filaComLigacoes);
+    }
+
+    pthread_mutex_unlock(&(*servidor).trincoFila);
+
+    return entregue;
+}
+
+/**
+ * @brief Responde ao pedido completo que está em "pedido" (com "tamanho" bytes, sem o '\n').
+ *
+ * @return 1 se o pedido foi "SAIR"; 0 caso contrário.
+ */
+static int responderLinha(Servidor *servidor, LigacaoServidor *ligacao)
+{
+    // Os pedidos demasiado longos já foram rejeitados (e são descartados até ao fim da linha)
+    if ((*ligacao).descartar)
+    {
+        (*ligacao).descartar = false;
+        return 0;
+    }
+
+    (*ligacao).pedido[(*ligacao).tamanho] = '\0';
+
+    return (responderPedido(servidor, (*ligacao).pedido, (*ligacao).saida) == 1) ? 1 : 0;
+}
+
+/**
+ * @brief Recebe os dados disponíveis numa ligação e responde a todos os pedidos completos.
+ *
+ * @note Só é chamada quando "poll" indica que a ligação tem dados (ou foi fechada), pelo que a leitura
+ *       não bloqueia; um pedido incompleto fica em "pedido" até a ligação voltar a ter dados.
+ *
+ * @return true se a ligação deve voltar a esperar por pedidos; false se deve ser fechada.
+ */
+static bool atenderLigacao(Servidor *servidor, LigacaoServidor *ligacao)
+{
+    char dados[SERVIDOR_TAMANHO_LINHA];
+    ssize_t recebidos = recv((*ligacao).descritor, dados, sizeof(dados), MSG_DONTWAIT);
+
+    if (recebidos < 0) return (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR);
+
+    // O cliente fechou a ligação: responde ao último pedido (sem '\n'), como "fgets"
+    if (recebidos == 0)
+    {
+        if ((*ligacao).tamanho > 0 || (*ligacao).descartar) responderLinha(servidor, ligacao);
+        fflush((*ligacao).saida);
+        return false;
+    }
+
+    (*ligacao).ultimaAtividade = time(NULL);
+    bool manter = true;
+
+    for (ssize_t i = 0; i < recebidos && manter; i++)
+    {
+        if (dados[i] == '\n')
+        {
+            manter = (responderLinha(servidor, ligacao) == 0);
+            (*ligacao).tamanho = 0;
+        }
+        else if ((*ligacao).descartar) continue;
+        else if ((*ligacao).tamanho == SERVIDOR_TAMANHO_LINHA - 1)
+        {
+            // Rejeita (e descarta até ao fim da linha) os pedidos demasiado longos
+            fprintf((*ligacao).saida, "ERRO %d %s\n", SERVIDOR_ERRO_PEDIDO_INVALIDO, mensagemErro(SERVIDOR_ERRO_PEDIDO_INVALIDO));
+            (*ligacao).descartar = true;
+            (*ligacao).tamanho = 0;
+        }
+        else (*ligacao).pedido[(*ligacao).tamanho++] = dados[i];
+    }
+
+    return (fflush((*ligacao).saida) != EOF) && manter;
+}
+
+/**
+ * @brief Ciclo de cada trabalhador: retira ligações com pedidos da fila, responde-lhes e devolve-as.
+ */
+static void *trabalhador(void *argumento)
+{
+    Servidor *servidor = argumento;
+
+    while (true)
+    {
+        pthread_mutex_lock(&(*servidor).trincoFila);
+
+        while ((*servidor).numFila == 0 && !atomic_load(&(*servidor).terminar))
+        {
+            pthread_cond_wait(&(*servidor).filaComLigacoes, &(*servidor).trincoFila);
+        }
+
+        if ((*servidor).numFila == 0)
+        {
+            pthread_mutex_unlock(&(*servidor).trincoFila);
+            break;
+        }
+
+        // Retira a ligação da fila e regista-a como ativa (para poder ser interrompida em "pararServidor")
+        LigacaoServidor *ligacao = (*servidor).fila[(*servidor).inicioFila];
+        (*servidor).inicioFila = ((*servidor).inicioFila + 1) % SERVIDOR_CAPACIDADE_FILA;
+        (*servidor).numFila--;
+
+        int posicao = 0;
+        while ((*servidor).ligacoesAtivas[posicao] >= 0) posicao++;
+        (*servidor).ligacoesAtivas[posicao] = (*ligacao).descritor;
+
+        pthread_cond_signal(&(*servidor).filaComEspaco);
+        pthread_mutex_unlock(&(*servidor).trincoFila);
+
+        // Uma ligação interrompida antes de ser atendida é apenas fechada
+        bool manter = !atomic_load(&(*servidor).terminar) && atenderLigacao(servidor, ligacao);
+
+        // A ligação deixa de estar registada antes de ser fechada, para que "pararServidor" nunca
+        // interrompa um descritor já reutilizado
+        pthread_mutex_lock(&(*servidor).trincoFila);
+        (*servidor).ligacoesAtivas[posicao] = -1;
+        if (manter)
+        {
+            (*ligacao).prox = (*servidor).devolvidas;
+            (*servidor).devolvidas = ligacao;
+        }
+        pthread_mutex_unlock(&(*servidor).trincoFila);
+
+        if (manter) despertarServidor(servidor);
+        else fecharLigacao(ligacao);
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Cria o servidor: abre o socket UNIX em "caminho" e arranca os trabalhadores.
+ *
+ * @param caminho Caminho do socket (NULL usa "SERVIDOR_CAMINHO_PREDEFINIDO"); um ficheiro existente é substituído.
+ * @param cidade Cidade a servir (o servidor passa a ser o seu dono).
+ * @param rede Rede a servir (o servidor passa a ser o seu dono; pode ser NULL).
+ * @param numTrabalhadores Número de trabalhadores (<= 0 usa "SERVIDOR_NUM_TRABALHADORES").
+ * @param erro Apontador para a variável que recebe o código de erro (0 em caso de sucesso).
+ *
+ * @note Em caso de erro, a cidade e a rede não são libertadas.
+ * @note Se só for possível arrancar alguns trabalhadores, o servidor fica com esses ("numTrabalhadores").
+ *
+ * @return Apontador para o servidor criado.
+ * @return NULL em caso de erro ("SERVIDOR_ERRO_SOCKET", "SERVIDOR_ERRO_ALOCACAO_MEMORIA",
+ *         "SERVIDOR_ERRO_TRABALHADORES" se não arrancar nenhum trabalhador, ...).
+ */
+Servidor *criarServidor(const char *caminho, Grafo *cidade, Rede *rede, int numTrabalhadores, int *erro)
+{
+    // Verifica se os apontadores são válidos
+    if (cidade == NULL)
+    {
+        *erro = SERVIDOR_ERRO_PONTEIRO_INVALIDO;
+        return NULL;
+    }
+    if (caminho == NULL) caminho = SERVIDOR_CAMINHO_PREDEFINIDO;
+    if (numTrabalhadores <= 0) numTrabalhadores = SERVIDOR_NUM_TRABALHADORES;
+
+    // Aloca o espaço na memória para o servidor (e inicializa as variáveis)
+    Servidor *servidor = calloc(1, sizeof(Servidor));
+    Rede *redeServidor = (rede != NULL) ? rede : LL_criarRede();
+
+    if (servidor == NULL || redeServidor == NULL || strlen(caminho) >= sizeof((*servidor).caminho))
+    {
+        if (rede == NULL) LL_libertarRede(redeServidor);
+        free(servidor);
+        *erro = (servidor == NULL || redeServidor == NULL) ? SERVIDOR_ERRO_ALOCACAO_MEMORIA : SERVIDOR_ERRO_SOCKET;
+        return NULL;
+    }
+
+    (*servidor).rede = redeServidor;
+    (*servidor).numTrabalhadores = numTrabalhadores;
+    strcpy((*servidor).caminho, caminho);
+    atomic_init(&(*servidor).terminar, false);
+
+    // Abre o socket
+    struct sockaddr_un endereco;
+    memset(&endereco, 0, sizeof(endereco));
+    endereco.sun_family = AF_UNIX;
+    strcpy(endereco.sun_path, caminho);
+
+    (*servidor).descritor = socket(AF_UNIX, SOCK_STREAM, 0);
+    (*servidor).despertar[0] = (*servidor).despertar[1] = -1;
+    unlink(caminho);
+
+    bool aberto = (*servidor).descritor >= 0 && bind((*servidor).descritor, (struct sockaddr *)&endereco, sizeof(endereco)) == 0
+                  && listen((*servidor).descritor, SERVIDOR_CAPACIDADE_FILA) == 0 && pipe((*servidor).despertar) == 0;
+
+    // O socket e o "despertar" não bloqueiam ("executarServidor" só lhes acede depois de "poll")
+    for (int i = 0; aberto && i < 3; i++)
+    {
+        int descritor = (i == 0) ? (*servidor).descritor : (*servidor).despertar[i - 1];
+        aberto = (fcntl(descritor, F_SETFL, fcntl(descritor, F_GETFL) | O_NONBLOCK) == 0);
+    }
+
+    if (!aberto)
+    {
+        if ((*servidor).descritor >= 0) close((*servidor).descritor);
+        if ((*servidor).despertar[0] >= 0) close((*servidor).despertar[0]);
+        if ((*servidor).despertar[1] >= 0) close((*servidor).despertar[1]);
+        if (rede == NULL) LL_libertarRede(redeServidor);
+        free(servidor);
+        *erro = SERVIDOR_ERRO_SOCKET;
+        return NULL;
+    }
+
+    // Publica a versão inicial da cidade
+    (*servidor).publicador = criarPublicador(cidade, erro);
+    (*servidor).trabalhadores = malloc(numTrabalhadores * sizeof(pthread_t));
+    (*servidor).ligacoesAtivas = malloc(numTrabalhadores * sizeof(int));
+
+    if ((*servidor).publicador == NULL || (*servidor).trabalhadores == NULL || (*servidor).ligacoesAtivas == NULL)
+    {
+        if ((*servidor).publicador != NULL)
+        {
+            (*(*servidor).publicador).cidade = NULL; /* A cidade continua a pertencer a quem chamou */
+            libertarPublicador((*servidor).publicador);
+            *erro = SERVIDOR_ERRO_ALOCACAO_MEMORIA;
+        }
+        free((*servidor).trabalhadores);
+        free((*servidor).ligacoesAtivas);
+        close((*servidor).descritor);
+        close((*servidor).despertar[0]);
+        close((*servidor).despertar[1]);
+        unlink(caminho);
+        if (rede == NULL) LL_libertarRede(redeServidor);
+        free(servidor);
+        return NULL;
+    }
+
+    for (int i = 0; i < numTrabalhadores; i++) (*servidor).ligacoesAtivas[i] = -1;
+
+    pthread_mutex_init(&(*servidor).trincoRede, NULL);
+    pthread_mutex_init(&(*servidor).trincoFila, NULL);
+    pthread_cond_init(&(*servidor).filaComLigacoes, NULL);
+    pthread_cond_init(&(*servidor).filaComEspaco, NULL);
+
+    // Arranca os trabalhadores
+    for (int i = 0; i < numTrabalhadores; i++)
+    {
+        if (pthread_create(&(*servidor).trabalhadores[i], NULL, trabalhador, servidor) != 0)
+        {
+            (*servidor).numTrabalhadores = i;
+            break;
+        }
+    }
+
+    // Sem trabalhadores os pedidos nunca seriam atendidos: desfaz a criação
+    if ((*servidor).numTrabalhadores == 0)
+    {
+        (*(*servidor).publicador).cidade = NULL; /* A cidade continua a pertencer a quem chamou */
+        if (rede != NULL) (*servidor).rede = NULL; /* Tal como a rede, se foi indicada */
+        libertarServidor(servidor);
+        *erro = SERVIDOR_ERRO_TRABALHADORES;
+        return NULL;
+    }
+
+    *erro = 0;
+
+    return servidor;
+}
+
+/**
+ * @brief Aceita ligações e entrega aos trabalhadores as que têm pedidos, até o servidor ser parado.
+ *
+ * @param servidor Apontador para o servidor.
+ *
+ * @note As ligações inativas esperam num único "poll" (com o socket do servidor e o "despertar"), e não
+ *       num trabalhador; são fechadas ao fim de "SERVIDOR_TEMPO_INATIVIDADE" segundos sem pedidos.
+ * @note Quando termina, espera que os trabalhadores terminem os pedidos em curso.
+ *
+ * @return 0 quando o servidor é parado ("pararServidor" ou sinal).
+ * @return "SERVIDOR_ERRO_PONTEIRO_INVALIDO" se o servidor for inválido.
+ * @return "SERVIDOR_ERRO_SOCKET" se o socket deixar de aceitar ligações.
+ * @return "SERVIDOR_ERRO_ALOCACAO_MEMORIA" se não for possível alocar memória.
+ */
+int executarServidor(Servidor *servidor)
+{
+    // Verifica se o apontador é válido
+    if (servidor == NULL) return SERVIDOR_ERRO_PONTEIRO_INVALIDO;
+
+    int resultado = 0;
+    EsperaLigacoes espera = { NULL, NULL, 0, 0 };
+
+    if (!aumentarEspera(&espera)) resultado = SERVIDOR_ERRO_ALOCACAO_MEMORIA;
+
+    while (resultado == 0 && !atomic_load(&(*servidor).terminar))
+    {
+        // Recolhe as ligações devolvidas pelos trabalhadores
+        pthread_mutex_lock(&(*servidor).trincoFila);
+        LigacaoServidor *devolvidas = (*servidor).devolvidas;
+        (*servidor).devolvidas = NULL;
+        pthread_mutex_unlock(&(*servidor).trincoFila);
+
+        while (devolvidas != NULL)
+        {
+            LigacaoServidor *ligacao = devolvidas;
+            devolvidas = (*ligacao).prox;
+            if (!acrescentarEspera(&espera, ligacao)) fecharLigacao(ligacao);
+        }
+
+        // Espera por uma nova ligação, por pedidos nas ligações inativas ou por uma ligação devolvida
+        espera.descritores[0] = (struct pollfd){ .fd = (*servidor).descritor, .events = POLLIN };
+        espera.descritores[1] = (struct pollfd){ .fd = (*servidor).despertar[0], .events = POLLIN };
+        for (int i = 0; i < espera.numLigacoes; i++) espera.descritores[i + 2] = (struct pollfd){ .fd = (*espera.ligacoes[i]).descritor, .events = POLLIN };
+
+        if (poll(espera.descritores, (nfds_t)espera.numLigacoes + 2, 1000) < 0)
+        {
+            if (errno != EINTR) resultado = SERVIDOR_ERRO_SOCKET;
+            continue;
+        }
+        if (atomic_load(&(*servidor).terminar)) break;
+
+        // Esvazia o "despertar" (as ligações devolvidas são recolhidas no início do ciclo)
+        char sinais[64];
+        if (espera.descritores[1].revents != 0) while (read((*servidor).despertar[0], sinais, sizeof(sinais)) > 0);
+
+        // Entrega as ligações com pedidos aos trabalhadores e fecha as que estão inativas há demasiado tempo
+        // (do fim para o início, porque a última ligação passa para a posição da que sai)
+        time_t agora = time(NULL);
+
+        for (int i = espera.numLigacoes - 1; i >= 0; i--)
+        {
+            LigacaoServidor *ligacao = espera.ligacoes[i];
+            bool comPedidos = (espera.descritores[i + 2].revents != 0);
+
+            if (!comPedidos && agora - (*ligacao).ultimaAtividade < SERVIDOR_TEMPO_INATIVIDADE) continue;
+
+            espera.ligacoes[i] = espera.ligacoes[--espera.numLigacoes];
+            if (!comPedidos || !entregarLigacao(servidor, ligacao)) fecharLigacao(ligacao);
+        }
+
+        // Aceita uma nova ligação
+        if (espera.descritores[0].revents == 0) continue;
+
+        int descritor = accept((*servidor).descritor, NULL, NULL);
+
+        if (descritor < 0)
+        {
+            if (atomic_load(&(*servidor).terminar)) break;
+            if (errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK || errno == ECONNABORTED || errno == EMFILE || errno == ENFILE) continue;
+
+            resultado = SERVIDOR_ERRO_SOCKET;
+            break;
+        }
+
+        LigacaoServidor *ligacao = criarLigacao(descritor);
+
+        if (ligacao == NULL) close(descritor);
+        else if (!acrescentarEspera(&espera, ligacao)) fecharLigacao(ligacao);
+    }
+
+    // Acorda os trabalhadores e espera que terminem
+    pararServidor(servidor);
+
+    for (int i = 0; i < (*servidor).numTrabalhadores; i++) pthread_join((*servidor).trabalhadores[i], NULL);
+
+    pthread_mutex_lock(&(*servidor).trincoFila);
+    (*servidor).numTrabalhadores = 0;
+    pthread_mutex_unlock(&(*servidor).trincoFila);
+
+    // Fecha as ligações que ficaram na fila, as devolvidas e as inativas
+    for (; (*servidor).numFila > 0; (*servidor).numFila--)
+    {
+        fecharLigacao((*servidor).fila[(*servidor).inicioFila]);
+        (*servidor).inicioFila = ((*servidor).inicioFila + 1) % SERVIDOR_CAPACIDADE_FILA;
+    }
+
+    while ((*servidor).devolvidas != NULL)
+    {
+        LigacaoServidor *ligacao = (*servidor).devolvidas;
+        (*servidor).devolvidas = (*ligacao).prox;
+        fecharLigacao(ligacao);
+    }
+
+    for (int i = 0; i < espera.numLigacoes; i++) fecharLigacao(espera.ligacoes[i]);
+    free(espera.ligacoes);
+    free(espera.descritores);
+
+    return resultado;
+}
+
+/**
+ * @brief Pede ao servidor para terminar: deixa de aceitar ligações e interrompe as ligações ativas.
+ *
+ * @param servidor Apontador para o servidor.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "SERVIDOR_ERRO_PONTEIRO_INVALIDO" se o servidor for inválido.
+ */
+int pararServidor(Servidor *servidor)
+{
+    // Verifica se o apontador é válido
+    if (servidor == NULL) return SERVIDOR_ERRO_PONTEIRO_INVALIDO;
+
+    atomic_store(&(*servidor).terminar, true);
+    despertarServidor(servidor); /* Acorda o "poll" */
+
+    pthread_mutex_lock(&(*servidor).trincoFila);
+    for (int i = 0; i < (*servidor).numTrabalhadores; i++)
+    {
+        if ((*servidor).ligacoesAtivas[i] >= 0) shutdown((*servidor).ligacoesAtivas[i], SHUT_RDWR);
+    }
+    pthread_cond_broadcast(&(*servidor).filaComLigacoes);
+    pthread_cond_broadcast(&(*servidor).filaComEspaco);
+    pthread_mutex_unlock(&(*servidor).trincoFila);
+
+    return 0;
+}
+
+/**
+ * @brief Liberta o servidor, a cidade e a rede, e remove o ficheiro do socket.
+ *
+ * @param servidor Apontador para o servidor (pode ser NULL).
+ *
+ * @note Só pode ser chamada depois de "executarServidor" terminar (ou se nunca foi executado).
+ *
+ * @return NULL para indicar que o servidor foi libertado com sucesso.
+ */
+Servidor *libertarServidor(Servidor *servidor)
+{
+    // Verifica se o apontador é válido
+    if (servidor == NULL) return NULL;
+
+    // Termina os trabalhadores (caso o servidor nunca tenha sido executado)
+    if ((*servidor).numTrabalhadores > 0)
+    {
+        pararServidor(servidor);
+        for (int i = 0; i < (*servidor).numTrabalhadores; i++) pthread_join((*servidor).trabalhadores[i], NULL);
+    }
+
+    close((*servidor).descritor);
+    close((*servidor).despertar[0]);
+    close((*servidor).despertar[1]);
+    unlink((*servidor).caminho);
+
+    libertarPublicador((*servidor).publicador);
+    LL_libertarRede((*servidor).rede);
+
+    pthread_mutex_destroy(&(*servidor).trincoRede);
+    pthread_mutex_destroy(&(*servidor).trincoFila);
+    pthread_cond_destroy(&(*servidor).filaComLigacoes);
+    pthread_cond_destroy(&(*servidor).filaComEspaco);
+
+    free((*servidor).trabalhadores);
+    free((*servidor).ligacoesAtivas);
+    free(servidor);
+
+    return NULL;
+}
+
+/**
+ * @brief Trata SIGINT/SIGTERM: pede ao servidor para terminar (só usa funções seguras em sinais).
+ */
+static void tratarSinal(int sinal)
+{
+    (void)sinal;
+
+    if (servidorSinais != NULL)
+    {
+        atomic_store(&(*servidorSinais).terminar, true);
+        despertarServidor(servidorSinais);
+    }
+}
+
+/**
+ * @brief Carrega a cidade e a rede uma única vez e serve pedidos até receber SIGINT/SIGTERM.
+ *
+ * A cidade é interligada por frequências iguais, como na opção 5 do menu.
+ *
+ * @param caminho Caminho do socket (NULL usa "SERVIDOR_CAMINHO_PREDEFINIDO").
+ * @param ficheiroCidade Ficheiro com o mapa da cidade.
+ * @param ficheiroAntenas Ficheiro com o mapa das antenas da rede.
+ * @param numTrabalhadores Número de trabalhadores (<= 0 usa "SERVIDOR_NUM_TRABALHADORES").
+ *
+ * @return 0 quando o servidor termina normalmente.
+ * @return Código de erro do carregamento, da criação ou da execução do servidor.
+ */
+int iniciarServidor(const char *caminho, const char *ficheiroCidade, const char *ficheiroAntenas, int numTrabalhadores)
+{
+    Grafo *cidade = criarCidade();
+    Rede *rede = LL_criarRede();
+
+    if (cidade == NULL || rede == NULL)
+    {
+        libertarCidade(cidade);
+        LL_libertarRede(rede);
+        return SERVIDOR_ERRO_ALOCACAO_MEMORIA;
+    }
+
+    // Carrega a cidade e a rede
+    int erro = carregarCidade(cidade, ficheiroCidade);
+    if (erro == 0) erro = interligarAntenas(cidade, true, false, false);
+    if (erro == 0) erro = LL_carregarAntenas(rede, ficheiroAntenas);
+
+    Servidor *servidor = (erro == 0) ? criarServidor(caminho, cidade, rede, numTrabalhadores, &erro) : NULL;
+
+    if (servidor == NULL)
+    {
+        libertarCidade(cidade);
+        LL_libertarRede(rede);
+        return erro;
+    }
+
+    // Termina de forma ordenada com SIGINT/SIGTERM; ignora SIGPIPE (clientes que fecham a meio)
+    struct sigaction acao;
+    memset(&acao, 0, sizeof(acao));
+    acao.sa_handler = tratarSinal;
+    sigemptyset(&acao.sa_mask);
+    servidorSinais = servidor;
+    sigaction(SIGINT, &acao, NULL);
+    sigaction(SIGTERM, &acao, NULL);
+    signal(SIGPIPE, SIG_IGN);
+
+    printf("Servidor à escuta em \"%s\" com %d trabalhadores (Ctrl+C para terminar).\n", (*servidor).caminho, (*servidor).numTrabalhadores);
+
+    erro = executarServidor(servidor);
+
+    servidorSinais = NULL;
+    libertarServidor(servidor);
+
+    return erro;
+}
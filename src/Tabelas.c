@@ -0,0 +1,434 @@
+/**
+ * @file Tabelas.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação da apresentação de tabelas (com buffer e paginação)
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Tabelas.h"
+
+/**
+ * @def TB_TAMANHO_MINIMO
+ * @brief Tamanho mínimo do buffer (tem de conter, pelo menos, uma linha completa).
+ */
+#define TB_TAMANHO_MINIMO 256
+
+/**
+ * @brief Escreve "tamanho" bytes no descritor (repetindo as escritas parciais ou interrompidas).
+ */
+static int escreverDescritor(int descritor, const char *dados, size_t tamanho)
+{
+    while (tamanho > 0)
+    {
+        ssize_t escritos = write(descritor, dados, tamanho);
+
+        if (escritos < 0)
+        {
+            if (errno == EINTR) continue;
+            return TB_ERRO_ESCRITA;
+        }
+
+        dados += escritos;
+        tamanho -= (size_t)escritos;
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Acrescenta texto ao buffer da tabela (despejando-o primeiro, se não houver espaço).
+ */
+static int acrescentar(Tabela *tabela, const char *texto, size_t tamanho)
+{
+    if ((*tabela).erro < 0) return (*tabela).erro;
+
+    if ((*tabela).usado + tamanho > (*tabela).tamanhoBuffer)
+    {
+        if (TB_despejarTabela(tabela) < 0) return (*tabela).erro;
+
+        // Texto maior do que o buffer (escrito diretamente)
+        if (tamanho > (*tabela).tamanhoBuffer)
+        {
+            (*tabela).erro = escreverDescritor((*tabela).descritor, texto, tamanho);
+            return (*tabela).erro;
+        }
+    }
+
+    memcpy((*tabela).buffer + (*tabela).usado, texto, tamanho);
+    (*tabela).usado += tamanho;
+
+    return 0;
+}
+
+/**
+ * @brief Garante que o texto pendente no "stdout" sai antes do texto da tabela (e vice-versa).
+ */
+static void sincronizarTerminal(const Tabela *tabela)
+{
+    if ((*tabela).descritor == STDOUT_FILENO) fflush(stdout);
+}
+
+/**
+ * @brief Acrescenta a linha de separação ("-" × (1 + 13 × colunas)), precedida de "\n" se "novaLinha".
+ */
+static int acrescentarSeparador(Tabela *tabela, bool novaLinha)
+{
+    char separador[1 + 1 + 13 * 32];
+    int colunas = ((*tabela).numColunas < 32) ? (*tabela).numColunas : 32;
+    size_t tamanho = 0;
+
+    if (novaLinha) separador[tamanho++] = '\n';
+    memset(separador + tamanho, '-', (size_t)(1 + 13 * colunas));
+    tamanho += (size_t)(1 + 13 * colunas);
+
+    return acrescentar(tabela, separador, tamanho);
+}
+
+/**
+ * @brief Acrescenta o cabeçalho completo (separador, títulos e separador).
+ */
+static int acrescentarCabecalho(Tabela *tabela)
+{
+    acrescentarSeparador(tabela, false);
+    acrescentar(tabela, "\n", 1);
+    acrescentar(tabela, (*tabela).cabecalho, strlen((*tabela).cabecalho));
+
+    return acrescentarSeparador(tabela, true);
+}
+
+/**
+ * @brief Acrescenta uma coluna com o texto indicado, alinhado à esquerda (e fecha a linha na última coluna).
+ */
+static int acrescentarColuna(Tabela *tabela, const char *texto, int tamanho)
+{
+    // "| " + texto + espaços até "TB_LARGURA_COLUNA" (+ "|" na última coluna)
+    char coluna[2 + 16 + TB_LARGURA_COLUNA + 1];
+    int posicao = 0;
+
+    coluna[posicao++] = '|';
+    coluna[posicao++] = ' ';
+    memcpy(coluna + posicao, texto, (size_t)tamanho);
+    posicao += tamanho;
+    while (tamanho++ < TB_LARGURA_COLUNA) coluna[posicao++] = ' ';
+
+    if (++(*tabela).colunaAtual == (*tabela).numColunas) coluna[posicao++] = '|';
+
+    return acrescentar(tabela, coluna, (size_t)posicao);
+}
+
+/**
+ * @brief Cria uma tabela que escreve no descritor indicado.
+ *
+ * @param descritor Descritor de ficheiro (ex.: "STDOUT_FILENO"); não é fechado ao libertar a tabela.
+ * @param tamanhoBuffer Tamanho do buffer (0 usa "TB_TAMANHO_BUFFER").
+ *
+ * @return Apontador para a tabela criada.
+ * @return NULL se a alocação falhar.
+ */
+Tabela *TB_criarTabela(int descritor, size_t tamanhoBuffer)
+{
+    if (tamanhoBuffer == 0) tamanhoBuffer = TB_TAMANHO_BUFFER;
+    if (tamanhoBuffer < TB_TAMANHO_MINIMO) tamanhoBuffer = TB_TAMANHO_MINIMO;
+
+    // Aloca o espaço na memória para a tabela (e inicializa as variáveis)
+    Tabela *tabela = calloc(1, sizeof(Tabela));
+
+    // Verifica se foi possível alocar a memória
+    if (tabela == NULL) return NULL;
+
+    (*tabela).buffer = malloc(tamanhoBuffer);
+
+    if ((*tabela).buffer == NULL)
+    {
+        free(tabela);
+        return NULL;
+    }
+
+    (*tabela).descritor = descritor;
+    (*tabela).tamanhoBuffer = tamanhoBuffer;
+    (*tabela).maximoLinhas = -1;
+    (*tabela).terminada = true;
+
+    return tabela;
+}
+
+/**
+ * @brief Liberta a tabela (escrevendo antes o texto que ainda está no buffer).
+ *
+ * @param tabela Apontador para a tabela (pode ser NULL).
+ *
+ * @return NULL para indicar que a tabela foi libertada com sucesso.
+ */
+Tabela *TB_libertarTabela(Tabela *tabela)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL) return NULL;
+
+    TB_despejarTabela(tabela);
+    free((*tabela).buffer);
+    free(tabela);
+
+    return NULL;
+}
+
+/**
+ * @brief Define a paginação das tabelas seguintes.
+ *
+ * @param tabela Apontador para a tabela.
+ * @param linhasPorPagina Número de linhas por página (<= 0 desativa a paginação).
+ * @param funcaoPagina Função chamada no fim de cada página (NULL continua sempre).
+ * @param contexto Apontador passado a "funcaoPagina".
+ *
+ * @return 0 em caso de sucesso.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" se a tabela for inválida.
+ */
+int TB_definirPaginacao(Tabela *tabela, int linhasPorPagina, FuncaoPagina funcaoPagina, void *contexto)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    (*tabela).linhasPorPagina = (linhasPorPagina > 0) ? linhasPorPagina : 0;
+    (*tabela).funcaoPagina = funcaoPagina;
+    (*tabela).contexto = contexto;
+
+    return 0;
+}
+
+/**
+ * @brief Define o intervalo de linhas apresentado nas tabelas seguintes.
+ *
+ * @param tabela Apontador para a tabela.
+ * @param primeiraLinha Primeira linha a apresentar (a contar de 0).
+ * @param maximoLinhas Número máximo de linhas a apresentar (< 0 apresenta até ao fim).
+ *
+ * @return 0 em caso de sucesso.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" se a tabela for inválida.
+ */
+int TB_definirIntervalo(Tabela *tabela, int primeiraLinha, int maximoLinhas)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    (*tabela).primeiraLinha = (primeiraLinha > 0) ? primeiraLinha : 0;
+    (*tabela).maximoLinhas = (maximoLinhas >= 0) ? maximoLinhas : -1;
+
+    return 0;
+}
+
+/**
+ * @brief Inicia uma nova tabela (escreve o cabeçalho no buffer).
+ *
+ * @param tabela Apontador para a tabela.
+ * @param cabecalho Linha dos títulos, já formatada (ex.: "| X          | Y          |").
+ * @param numColunas Número de colunas de cada linha.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ * @return "TB_ERRO_ESCRITA" se ocorrer um erro de escrita.
+ */
+int TB_iniciarTabela(Tabela *tabela, const char *cabecalho, int numColunas)
+{
+    // Verifica se os apontadores são válidos
+    if (tabela == NULL || cabecalho == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    sincronizarTerminal(tabela);
+
+    (*tabela).erro = 0;
+    (*tabela).cabecalho = cabecalho;
+    (*tabela).numColunas = numColunas;
+    (*tabela).colunaAtual = numColunas;
+    (*tabela).numLinhas = 0;
+    (*tabela).linhasApresentadas = 0;
+    (*tabela).linhasPagina = 0;
+    (*tabela).pagina = 0;
+    (*tabela).terminada = false;
+    (*tabela).interrompida = false;
+
+    return acrescentarCabecalho(tabela);
+}
+
+/**
+ * @brief Salta as linhas anteriores ao intervalo (sem as formatar).
+ *
+ * @param tabela Apontador para a tabela.
+ *
+ * @return Número de linhas que quem produz as linhas deve saltar (0 se não houver intervalo).
+ */
+int TB_saltarLinhas(Tabela *tabela)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL || (*tabela).numLinhas >= (*tabela).primeiraLinha) return 0;
+
+    int saltar = (*tabela).primeiraLinha - (*tabela).numLinhas;
+    (*tabela).numLinhas = (*tabela).primeiraLinha;
+
+    return saltar;
+}
+
+/**
+ * @brief Inicia uma linha da tabela (seguida de "numColunas" chamadas a "TB_coluna...").
+ *
+ * Muda de página quando a página atual está cheia (chamando "funcaoPagina").
+ *
+ * @param tabela Apontador para a tabela.
+ *
+ * @return "true" se a linha deve ser preenchida.
+ * @return "false" se a tabela terminou (fim do intervalo, fim pedido por "funcaoPagina" ou erro);
+ *         as linhas anteriores ao intervalo também devolvem "false", mas estas são evitadas com
+ *         "TB_saltarLinhas".
+ */
+bool TB_iniciarLinha(Tabela *tabela)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL || (*tabela).terminada || (*tabela).erro < 0) return false;
+
+    // Linha anterior ao intervalo
+    if ((*tabela).numLinhas++ < (*tabela).primeiraLinha) return false;
+
+    // Fim do intervalo
+    if ((*tabela).maximoLinhas >= 0 && (*tabela).linhasApresentadas >= (*tabela).maximoLinhas)
+    {
+        (*tabela).terminada = true;
+        return false;
+    }
+
+    // Muda de página
+    if ((*tabela).linhasPorPagina > 0 && (*tabela).linhasPagina == (*tabela).linhasPorPagina)
+    {
+        acrescentarSeparador(tabela, true);
+        if (TB_despejarTabela(tabela) < 0) return false;
+
+        (*tabela).pagina++;
+        (*tabela).linhasPagina = 0;
+
+        if ((*tabela).funcaoPagina != NULL && (*tabela).funcaoPagina((*tabela).pagina, (*tabela).contexto) == false)
+        {
+            (*tabela).terminada = true;
+            (*tabela).interrompida = true;
+            return false;
+        }
+
+        sincronizarTerminal(tabela);
+        acrescentarCabecalho(tabela);
+    }
+
+    (*tabela).colunaAtual = 0;
+    (*tabela).linhasApresentadas++;
+    (*tabela).linhasPagina++;
+
+    return acrescentar(tabela, "\n", 1) == 0;
+}
+
+/**
+ * @brief Acrescenta uma coluna com um caracter à linha atual.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" se a tabela for inválida.
+ * @return "TB_ERRO_ESCRITA" se ocorrer um erro de escrita.
+ */
+int TB_colunaCaracter(Tabela *tabela, char caracter)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    return acrescentarColuna(tabela, &caracter, 1);
+}
+
+/**
+ * @brief Acrescenta uma coluna com um inteiro à linha atual (como "%-11d", sem "printf").
+ *
+ * @return 0 em caso de sucesso.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" se a tabela for inválida.
+ * @return "TB_ERRO_ESCRITA" se ocorrer um erro de escrita.
+ */
+int TB_colunaInteiro(Tabela *tabela, int valor)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    // Algarismos escritos do fim para o início (o valor absoluto em "unsigned" cobre "INT_MIN")
+    char digitos[16];
+    int posicao = sizeof(digitos);
+    unsigned int absoluto = (valor < 0) ? 0u - (unsigned int)valor : (unsigned int)valor;
+
+    do
+    {
+        digitos[--posicao] = (char)('0' + absoluto % 10);
+        absoluto /= 10;
+    } while (absoluto > 0);
+
+    if (valor < 0) digitos[--posicao] = '-';
+
+    return acrescentarColuna(tabela, digitos + posicao, (int)sizeof(digitos) - posicao);
+}
+
+/**
+ * @brief Termina a tabela atual (linha vazia se não foi apresentada nenhuma linha) e escreve o buffer.
+ *
+ * @param tabela Apontador para a tabela.
+ *
+ * @return Número de linhas apresentadas.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" se a tabela for inválida.
+ * @return "TB_ERRO_ESCRITA" se ocorrer um erro de escrita.
+ */
+int TB_terminarTabela(Tabela *tabela)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    // Tabela fechada no fim da última página (pedido de "funcaoPagina")
+    if ((*tabela).terminada && (*tabela).linhasPagina == 0 && (*tabela).pagina > 0) return (*tabela).erro < 0 ? (*tabela).erro : (*tabela).linhasApresentadas;
+
+    if ((*tabela).linhasApresentadas == 0)
+    {
+        acrescentar(tabela, "\n", 1);
+        (*tabela).colunaAtual = 0;
+        for (int i = 0; i < (*tabela).numColunas; i++) acrescentarColuna(tabela, "", 0);
+    }
+    acrescentarSeparador(tabela, true);
+
+    (*tabela).terminada = true;
+    TB_despejarTabela(tabela);
+
+    return (*tabela).erro < 0 ? (*tabela).erro : (*tabela).linhasApresentadas;
+}
+
+/**
+ * @brief Acrescenta texto livre (ex.: títulos entre tabelas) ao buffer da tabela.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" se algum dos apontadores for inválido.
+ * @return "TB_ERRO_ESCRITA" se ocorrer um erro de escrita.
+ */
+int TB_escreverTexto(Tabela *tabela, const char *texto)
+{
+    // Verifica se os apontadores são válidos
+    if (tabela == NULL || texto == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    return acrescentar(tabela, texto, strlen(texto));
+}
+
+/**
+ * @brief Escreve (com "write") o texto acumulado no buffer da tabela.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "TB_ERRO_TABELA_PONTEIRO_INVALIDO" se a tabela for inválida.
+ * @return "TB_ERRO_ESCRITA" se ocorrer um erro de escrita (as escritas seguintes são ignoradas).
+ */
+int TB_despejarTabela(Tabela *tabela)
+{
+    // Verifica se o apontador é válido
+    if (tabela == NULL) return TB_ERRO_TABELA_PONTEIRO_INVALIDO;
+
+    if ((*tabela).erro < 0) return (*tabela).erro;
+    if ((*tabela).usado == 0) return 0;
+
+    size_t usado = (*tabela).usado;
+    (*tabela).usado = 0;
+    (*tabela).erro = escreverDescritor((*tabela).descritor, (*tabela).buffer, usado);
+
+    return (*tabela).erro;
+}
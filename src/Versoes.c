@@ -0,0 +1,243 @@
+/**
+ * @file Versoes.c
+ * @author Gonçalo Carvalho (a31537@alunos.ipca.pt)
+ * @brief Implementação da publicação de versões (snapshots) da cidade com contagem de referências
+ * @version 2.0
+ * @date 2025-05-25
+ *
+ * @copyright Copyright (c) 2025
+ *
+ */
+#include "../include/Versoes.h"
+
+/**
+ * @brief Constrói uma versão a partir da cidade e substitui a versão atual.
+ *
+ * @note Tem de ser chamada com "trincoEscrita" adquirido (a cidade não pode mudar durante a cópia).
+ *       A versão anterior só é libertada quando o último leitor a devolver.
+ * @note As arestas de entrada (CSR inverso) e o índice por frequência são criados antes de publicar, porque
+ *       a versão passa a ser partilhada e não pode ser alterada pelos leitores (ex.: expansão ascendente de
+ *       "PP_procurarLarguraParalela", "GC_procurarIntersecoes").
+ * @note A versão é reconstruída por inteiro (O(V + E)) em cada publicação, mesmo que a edição só tenha
+ *       mudado uma antena ou aresta; várias alterações devem ser agrupadas numa só edição.
+ */
+static int publicarVersaoBloqueado(PublicadorVersoes *publicador)
+{
+    Versao *nova = malloc(sizeof(Versao));
+
+    // Verifica se foi possível alocar a memória
+    if (nova == NULL) return VERSOES_ERRO_ALOCACAO_MEMORIA;
+
+    // Constrói a cópia imutável fora de "trincoVersao" (os leitores continuam a usar a versão atual)
+    int erro;
+    (*nova).grafo = GC_criarGrafoCompacto((*publicador).cidade, true, &erro);
+
+    if ((*nova).grafo == NULL)
+    {
+        free(nova);
+        return erro;
+    }
+
+    erro = GC_criarArestasEntrada((*nova).grafo);
+    if (erro == 0) erro = GC_criarIndiceFrequencias((*nova).grafo);
+
+    if (erro < 0)
+    {
+        GC_libertarGrafoCompacto((*nova).grafo);
+        free(nova);
+        return erro;
+    }
+
+    atomic_init(&(*nova).referencias, 1); /* Referência do publicador */
+
+    // Troca o apontador da versão atual
+    pthread_mutex_lock(&(*publicador).trincoVersao);
+    Versao *anterior = (*publicador).atual;
+    (*nova).numero = (*publicador).proximoNumero++;
+    (*publicador).atual = nova;
+    pthread_mutex_unlock(&(*publicador).trincoVersao);
+
+    // Devolve a referência do publicador à versão anterior
+    libertarVersao(anterior);
+
+    return 0;
+}
+
+/**
+ * @brief Cria um publicador de versões para uma cidade e publica a versão inicial.
+ *
+ * @param cidade Cidade a gerir (o publicador passa a ser o seu dono e liberta-a em "libertarPublicador").
+ * @param erro Apontador para a variável que recebe o código de erro (0 em caso de sucesso).
+ *
+ * @return Apontador para o publicador criado.
+ * @return NULL em caso de erro ("VERSOES_ERRO_ALOCACAO_MEMORIA" ou erro da conversão em "erro").
+ */
+PublicadorVersoes *criarPublicador(Grafo *cidade, int *erro)
+{
+    // Verifica se o apontador é válido
+    if (cidade == NULL)
+    {
+        *erro = GC_ERRO_CIDADE_PONTEIRO_INVALIDO;
+        return NULL;
+    }
+
+    // Aloca o espaço na memória para o publicador (e inicializa as variáveis)
+    PublicadorVersoes *publicador = calloc(1, sizeof(PublicadorVersoes));
+
+    // Verifica se foi possível alocar a memória
+    if (publicador == NULL)
+    {
+        *erro = VERSOES_ERRO_ALOCACAO_MEMORIA;
+        return NULL;
+    }
+
+    (*publicador).cidade = cidade;
+    pthread_mutex_init(&(*publicador).trincoEscrita, NULL);
+    pthread_mutex_init(&(*publicador).trincoVersao, NULL);
+
+    // Publica a versão inicial
+    *erro = publicarVersaoBloqueado(publicador);
+
+    if (*erro < 0)
+    {
+        pthread_mutex_destroy(&(*publicador).trincoEscrita);
+        pthread_mutex_destroy(&(*publicador).trincoVersao);
+        free(publicador);
+        return NULL;
+    }
+
+    return publicador;
+}
+
+/**
+ * @brief Liberta o publicador e a cidade que gere.
+ *
+ * @param publicador Apontador para o publicador (pode ser NULL).
+ *
+ * @note Não pode haver edições em curso. As versões ainda adquiridas por leitores continuam válidas
+ *       e são libertadas quando forem devolvidas com "libertarVersao".
+ *
+ * @return NULL para indicar que o publicador foi libertado com sucesso.
+ */
+PublicadorVersoes *libertarPublicador(PublicadorVersoes *publicador)
+{
+    // Verifica se o apontador é válido
+    if (publicador == NULL) return NULL;
+
+    libertarVersao((*publicador).atual);
+    libertarCidade((*publicador).cidade);
+
+    pthread_mutex_destroy(&(*publicador).trincoEscrita);
+    pthread_mutex_destroy(&(*publicador).trincoVersao);
+    free(publicador);
+
+    return NULL;
+}
+
+/**
+ * @brief Inicia uma edição da cidade (bloqueia até não haver outra edição em curso).
+ *
+ * @param publicador Apontador para o publicador.
+ *
+ * @note Cada chamada tem de ser terminada com "terminarEdicao". Os leitores não são bloqueados.
+ *
+ * @return Apontador para a cidade editável.
+ * @return NULL se o publicador for inválido.
+ */
+Grafo *iniciarEdicao(PublicadorVersoes *publicador)
+{
+    // Verifica se o apontador é válido
+    if (publicador == NULL) return NULL;
+
+    pthread_mutex_lock(&(*publicador).trincoEscrita);
+
+    return (*publicador).cidade;
+}
+
+/**
+ * @brief Termina uma edição da cidade e, opcionalmente, publica uma nova versão.
+ *
+ * @param publicador Apontador para o publicador.
+ * @param publicar Se verdadeiro, as alterações ficam visíveis para os novos leitores.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "VERSOES_ERRO_PUBLICADOR_PONTEIRO_INVALIDO" se o publicador for inválido.
+ * @return "VERSOES_ERRO_ALOCACAO_MEMORIA" se não for possível construir a nova versão (a anterior mantém-se).
+ */
+int terminarEdicao(PublicadorVersoes *publicador, bool publicar)
+{
+    // Verifica se o apontador é válido
+    if (publicador == NULL) return VERSOES_ERRO_PUBLICADOR_PONTEIRO_INVALIDO;
+
+    int erro = publicar ? publicarVersaoBloqueado(publicador) : 0;
+
+    pthread_mutex_unlock(&(*publicador).trincoEscrita);
+
+    return erro;
+}
+
+/**
+ * @brief Publica uma nova versão com o estado atual da cidade.
+ *
+ * @param publicador Apontador para o publicador.
+ *
+ * @return 0 em caso de sucesso.
+ * @return "VERSOES_ERRO_PUBLICADOR_PONTEIRO_INVALIDO" se o publicador for inválido.
+ * @return "VERSOES_ERRO_ALOCACAO_MEMORIA" se não for possível construir a nova versão.
+ */
+int publicarVersao(PublicadorVersoes *publicador)
+{
+    // Verifica se o apontador é válido
+    if (publicador == NULL) return VERSOES_ERRO_PUBLICADOR_PONTEIRO_INVALIDO;
+
+    pthread_mutex_lock(&(*publicador).trincoEscrita);
+    int erro = publicarVersaoBloqueado(publicador);
+    pthread_mutex_unlock(&(*publicador).trincoEscrita);
+
+    return erro;
+}
+
+/**
+ * @brief Adquire uma referência para a versão publicada mais recente.
+ *
+ * @param publicador Apontador para o publicador.
+ *
+ * @note A versão mantém-se válida (e inalterada) até ser devolvida com "libertarVersao",
+ *       mesmo que entretanto sejam publicadas outras versões.
+ *
+ * @return Apontador para a versão.
+ * @return NULL se o publicador for inválido.
+ */
+Versao *adquirirVersao(PublicadorVersoes *publicador)
+{
+    // Verifica se o apontador é válido
+    if (publicador == NULL) return NULL;
+
+    pthread_mutex_lock(&(*publicador).trincoVersao);
+    Versao *versao = (*publicador).atual;
+    atomic_fetch_add_explicit(&(*versao).referencias, 1, memory_order_relaxed);
+    pthread_mutex_unlock(&(*publicador).trincoVersao);
+
+    return versao;
+}
+
+/**
+ * @brief Devolve uma referência para uma versão, libertando-a se for a última.
+ *
+ * @param versao Apontador para a versão (pode ser NULL).
+ *
+ * @return NULL para facilitar a reatribuição do apontador original.
+ */
+Versao *libertarVersao(Versao *versao)
+{
+    // Verifica se o apontador é válido
+    if (versao == NULL) return NULL;
+
+    if (atomic_fetch_sub_explicit(&(*versao).referencias, 1, memory_order_acq_rel) == 1)
+    {
+        GC_libertarGrafoCompacto((*versao).grafo);
+        free(versao);
+    }
+
+    return NULL;
+}